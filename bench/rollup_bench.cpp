@@ -0,0 +1,111 @@
+/**
+ * Măsurarea lui Project_Task::RecomputeRollup pe un arbore mare de proiecte
+ *
+ * Construiește un arbore complet de proiecte (implicit adâncime 6 și 10 sub-sarcini pe
+ * nivel, adică 1.111.111 sarcini, cu o treime dintre frunze finalizate), apoi măsoară
+ * recalcularea serială și recalcularea cu pool-uri de 1, 2, 4, ... fire, până la
+ * numărul de nuclee (sau până la valoarea dată). Pentru fiecare configurație se
+ * păstrează cel mai bun timp din mai multe rulări, iar rezultatele sunt comparate cu
+ * cele seriale.
+ *
+ * Compilare (din rădăcina proiectului):
+ *   g++ -std=c++11 -O2 -pthread -I./include bench/rollup_bench.cpp \
+ *       $(find src -name '*.cpp' ! -name main.cpp) -o rollup_bench
+ *
+ * Utilizare: ./rollup_bench [adâncime] [sub-sarcini pe nivel] [număr maxim de fire]
+ */
+
+#include "project_task.h"
+#include "simple_task.h"
+#include "work_stealing_pool.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Task_Management;
+
+namespace {
+
+const int RUN_COUNT = 5;  // Rulările pentru fiecare configurație
+
+/**
+ * Construiește recursiv un subarbore complet
+ * @param owned Primește toate sarcinile create (pentru eliberare)
+ */
+Project_Task* BuildTree(int depth, int fanout, std::vector<std::unique_ptr<Task>>& owned) {
+    Project_Task* project = new Project_Task("project", "", Priority::MEDIUM);
+    owned.emplace_back(project);
+    for (int i = 0; i < fanout; ++i) {
+        if (depth > 1) {
+            project->AddSubtask(BuildTree(depth - 1, fanout, owned));
+        } else {
+            Simple_Task* task = new Simple_Task("task", "", Priority::LOW);
+            owned.emplace_back(task);
+            if (owned.size() % 3 == 0) {
+                task->SetStatus(TaskStatus::COMPLETED);
+            }
+            project->AddSubtask(task);
+        }
+    }
+    return project;
+}
+
+/**
+ * Cel mai bun timp (în milisecunde) din RUN_COUNT recalculări
+ */
+double BestTime(Project_Task* root, Work_Stealing_Pool* pool, Rollup_Stats& stats) {
+    double best = 0.0;
+    for (int run = 0; run < RUN_COUNT; ++run) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        stats = root->RecomputeRollup(pool);
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (run == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+bool SameStats(const Rollup_Stats& a, const Rollup_Stats& b) {
+    return a.task_count == b.task_count && a.completed_task_count == b.completed_task_count &&
+           a.leaf_count == b.leaf_count && a.max_depth == b.max_depth &&
+           a.completion_percentage == b.completion_percentage;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int depth = argc > 1 ? std::atoi(argv[1]) : 6;
+    int fanout = argc > 2 ? std::atoi(argv[2]) : 10;
+    size_t max_threads = argc > 3 ? static_cast<size_t>(std::atoi(argv[3])) : std::thread::hardware_concurrency();
+    max_threads = std::max<size_t>(max_threads, 1);
+
+    std::vector<std::unique_ptr<Task>> owned;
+    Project_Task* root = BuildTree(depth, fanout, owned);
+    std::printf("tree: %zu tasks, depth %d, fanout %d, %u hardware threads\n",
+                owned.size(), depth, fanout, std::thread::hardware_concurrency());
+
+    Rollup_Stats serial;
+    double serial_time = BestTime(root, nullptr, serial);
+    std::printf("%-10s %10.1f ms  %6.2fx\n", "serial", serial_time, 1.0);
+
+    bool consistent = true;
+    std::vector<size_t> thread_counts;
+    for (size_t threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+    for (size_t threads : thread_counts) {
+        Work_Stealing_Pool pool(threads);
+        Rollup_Stats parallel;
+        double time = BestTime(root, &pool, parallel);
+        consistent = consistent && SameStats(serial, parallel);
+        std::printf("%2zu threads %10.1f ms  %6.2fx\n", threads, time, serial_time / time);
+    }
+    std::printf("results %s\n", consistent ? "identical" : "DIFFERENT");
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "inotifier.h"
+
+namespace Task_Management {
+
+/**
+ * Clasa Async_Notifier - trimiterea asincronă a notificărilor prin alt INotifier
+ *
+ * Se așază în fața oricărui notificator (ex: Task_List::SetNotifier(&async_notifier)):
+ * SendNotification doar pune notificarea într-o coadă și returnează imediat, iar unul
+ * sau mai multe fire de execuție proprii o trimit prin notificatorul înlocuit.
+ *
+ * Coada este un inel circular de dimensiune fixă, fără lacăte (algoritmul lui Vyukov
+ * pentru mai mulți producători și mai mulți consumatori): fiecare celulă are un număr
+ * de secvență care arată dacă este liberă sau ocupată, deci o inserare costă o singură
+ * operație compare-and-swap. Lacătul intern este folosit doar când un fir trebuie
+ * adormit sau trezit. Firele de trimitere golesc coada în loturi de cel mult BATCH_SIZE
+ * notificări, trimise împreună prin INotifier::SendNotifications.
+ *
+ * Când coada este plină, comportamentul depinde de Overflow_Policy. Cu COALESCE,
+ * notificările care nu încap în inel așteaptă într-o zonă de depășire, în ordinea
+ * sosirii și limitată tot la capacitatea cozii; o notificare nouă înlocuiește doar una
+ * aflată deja în depășire, cu același destinatar și subiect. Când și depășirea este
+ * plină, apelantul așteaptă, ca la BLOCK. Rezultatul fiecărei
+ * notificări poate fi primit printr-un callback (Send) sau un std::future (SendAsync).
+ *
+ * Notificatorul înlocuit trebuie să poată fi apelat din mai multe fire dacă
+ * worker_count > 1. Destructorul trimite notificările rămase, apoi oprește firele.
+ */
+class Async_Notifier : public INotifier {
+public:
+    /**
+     * Enumerație pentru comportamentul la coada plină
+     */
+    enum class Overflow_Policy {
+        BLOCK,    // Apelantul așteaptă eliberarea unui loc
+        DROP,     // Notificarea este respinsă
+        COALESCE  // Notificarea înlocuiește una din depășire cu același destinatar și subiect, altfel așteaptă în ordine
+    };
+
+    /**
+     * Enumerație pentru rezultatul unei notificări
+     */
+    enum class Delivery_Status {
+        DELIVERED,  // Trimisă cu succes de notificatorul înlocuit
+        FAILED,     // Notificatorul înlocuit a raportat eșecul
+        DROPPED,    // Respinsă, coada era plină (Overflow_Policy::DROP)
+        COALESCED   // Înlocuită de o notificare mai nouă (Overflow_Policy::COALESCE)
+    };
+
+    /**
+     * Funcția apelată cu rezultatul unei notificări
+     * Este apelată dintr-un fir de trimitere (sau din firul apelant, pentru DROPPED și
+     * COALESCED) și nu trebuie să trimită notificări noi cu Overflow_Policy::BLOCK
+     * sau Overflow_Policy::COALESCE (care pot bloca).
+     */
+    typedef std::function<void(Delivery_Status)> Delivery_Callback;
+
+    /**
+     * Numărul maxim de notificări trimise împreună
+     */
+    static const size_t BATCH_SIZE = 64;
+
+    /**
+     * Constructor - pornește firele de trimitere
+     * @param notifier Notificatorul prin care se trimit notificările (nu este deținut)
+     * @param capacity Numărul de locuri din coadă (rotunjit la o putere a lui 2)
+     * @param policy Comportamentul la coada plină
+     * @param worker_count Numărul de fire de trimitere (cel puțin 1)
+     */
+    Async_Notifier(INotifier* notifier, size_t capacity = 4096,
+                   Overflow_Policy policy = Overflow_Policy::BLOCK, size_t worker_count = 1);
+
+    /**
+     * Destructor - trimite notificările rămase și oprește firele
+     */
+    virtual ~Async_Notifier();
+
+    /**
+     * Implementarea metodei din INotifier - pune notificarea în coadă
+     * @param recipient Destinatarul notificării
+     * @param subject Subiectul notificării
+     * @param message Conținutul notificării
+     * @return true dacă notificarea a fost acceptată, false dacă a fost respinsă
+     */
+    virtual bool SendNotification(const std::string& recipient, const std::string& subject, const std::string& message) const override;
+
+    /**
+     * Implementarea metodei din INotifier
+     * @return Tipul notificatorului înlocuit
+     */
+    virtual std::string GetNotificationType() const override;
+
+    /**
+     * Pune o notificare în coadă, cu un callback pentru rezultat
+     * @param notification Notificarea (este mutată în coadă)
+     * @param callback Funcția apelată cu rezultatul (poate fi goală)
+     * @return true dacă notificarea a fost acceptată, false dacă a fost respinsă
+     */
+    bool Send(Notification notification, Delivery_Callback callback) const;
+
+    /**
+     * Pune o notificare în coadă și întoarce rezultatul ca std::future
+     * @param notification Notificarea (este mutată în coadă)
+     * @return Rezultatul, disponibil după trimitere (imediat, dacă a fost respinsă)
+     */
+    std::future<Delivery_Status> SendAsync(Notification notification) const;
+
+    /**
+     * Așteaptă trimiterea notificărilor acceptate înaintea apelului
+     * Cu mai multe fire de trimitere, notificările pot fi tratate în altă ordine decât
+     * au fost acceptate; metoda așteaptă atunci până când au fost tratate cel puțin
+     * tot atâtea notificări câte fuseseră acceptate.
+     */
+    void Flush() const;
+
+    /**
+     * Obține numărul de locuri din coadă
+     * @return Capacitatea cozii
+     */
+    size_t GetCapacity() const;
+
+    /**
+     * Obține numărul de notificări respinse
+     * @return Numărul de notificări cu rezultatul DROPPED
+     */
+    std::uint64_t GetDroppedCount() const;
+
+    /**
+     * Obține numărul de notificări înlocuite de altele mai noi
+     * @return Numărul de notificări cu rezultatul COALESCED
+     */
+    std::uint64_t GetCoalescedCount() const;
+
+private:
+    /**
+     * O notificare în așteptare, împreună cu callback-ul ei
+     */
+    struct Pending {
+        Notification notification;  // Notificarea
+        Delivery_Callback callback; // Funcția apelată cu rezultatul (poate fi goală)
+    };
+
+    /**
+     * O celulă a inelului
+     * Secvența este egală cu poziția de inserare când celula este liberă și cu
+     * poziția plus 1 când celula conține o notificare gata de scos
+     */
+    struct Cell {
+        std::atomic<size_t> sequence;  // Starea celulei
+        Pending pending;               // Notificarea din celulă
+    };
+
+    INotifier* m_notifier;             // Notificatorul înlocuit
+    Overflow_Policy m_policy;          // Comportamentul la coada plină
+    size_t m_mask;                     // Capacitatea minus 1 (capacitatea este o putere a lui 2)
+    std::unique_ptr<Cell[]> m_cells;   // Inelul
+
+    // Pozițiile de inserare și de extragere sunt separate de o linie de cache,
+    // pentru ca producătorii și consumatorii să nu invalideze reciproc aceeași linie
+    mutable std::atomic<size_t> m_enqueue_position;
+    char m_padding[64];
+    mutable std::atomic<size_t> m_dequeue_position;
+
+    /**
+     * O notificare din depășire, cu cheia ei (destinatarul și subiectul)
+     */
+    struct Overflow_Entry {
+        std::string key;  // Cheia după care se face înlocuirea
+        Pending pending;  // Notificarea
+    };
+
+    // Notificările care nu au încăput în inel (Overflow_Policy::COALESCE), în ordinea sosirii,
+    // cel mult cât capacitatea inelului; indexul găsește notificarea cu aceeași cheie
+    mutable std::mutex m_overflow_mutex;
+    mutable std::list<Overflow_Entry> m_overflow;
+    mutable std::unordered_map<std::string, std::list<Overflow_Entry>::iterator> m_overflow_index;
+    mutable std::condition_variable m_overflow_space;  // Trezește producătorii care așteaptă loc în depășire
+    mutable size_t m_overflow_waiters;                 // Producătorii care așteaptă (protejat de m_overflow_mutex)
+    mutable std::atomic<size_t> m_overflow_count;
+
+    // Adormirea și trezirea firelor
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_has_work;    // Trezește firele de trimitere
+    mutable std::condition_variable m_has_space;   // Trezește producătorii blocați (Overflow_Policy::BLOCK)
+    mutable std::condition_variable m_flushed;     // Trezește firele din Flush()
+    mutable std::atomic<size_t> m_idle_workers;    // Firele de trimitere adormite
+    mutable std::atomic<size_t> m_blocked_senders; // Producătorii care așteaptă un loc
+    mutable std::atomic<size_t> m_flush_waiters;   // Firele care așteaptă în Flush()
+    bool m_stopping;                               // Destructorul a fost apelat (protejat de m_mutex)
+
+    mutable std::atomic<std::uint64_t> m_accepted;   // Notificările acceptate
+    mutable std::atomic<std::uint64_t> m_completed;  // Notificările trimise sau înlocuite
+    mutable std::atomic<std::uint64_t> m_dropped;    // Notificările respinse
+    mutable std::atomic<std::uint64_t> m_coalesced;  // Notificările înlocuite
+
+    std::vector<std::thread> m_workers;  // Firele de trimitere
+
+    /**
+     * Încearcă să insereze o notificare în inel
+     * @param pending Notificarea (mutată doar dacă inserarea reușește)
+     * @return true dacă a fost inserată, false dacă inelul este plin
+     */
+    bool _TryEnqueue(Pending& pending) const;
+
+    /**
+     * Încearcă să scoată o notificare din inel
+     * @param pending Primește notificarea
+     * @return true dacă a fost scoasă, false dacă inelul este gol
+     */
+    bool _TryDequeue(Pending& pending) const;
+
+    /**
+     * Verifică, fără a o scoate, dacă există o notificare în inel sau în depășire
+     */
+    bool _HasWork() const;
+
+    /**
+     * Adaugă o notificare la sfârșitul depășirii sau înlocuiește notificarea din depășire
+     * cu același destinatar și subiect; așteaptă dacă depășirea este plină
+     */
+    void _Coalesce(Pending& pending) const;
+
+    /**
+     * Trezește un fir de trimitere dacă vreunul doarme
+     */
+    void _WakeWorker() const;
+
+    /**
+     * Trezește firele din Flush() după ce notificări au fost tratate sau respinse
+     */
+    void _NotifyCompleted() const;
+
+    void _WorkerLoop();
+
+    // Copierea este interzisă - notificatorul deține firele de execuție
+    Async_Notifier(const Async_Notifier&) = delete;
+    Async_Notifier& operator=(const Async_Notifier&) = delete;
+};
+
+} // namespace Task_Management
@@ -2,6 +2,8 @@
 
 #include <string>
 #include <vector>
+#include "entity_id.h"
+#include "task_collection.h"
 
 namespace Task_Management {
 
@@ -65,9 +67,9 @@ public:
     
     /**
      * Obține ID-ul unic al categoriei
-     * @return ID-ul categoriei ca string
+     * @return ID-ul categoriei (forma text se obține cu ToString())
      */
-    std::string GetId() const;
+    Entity_Id GetId() const;
     
     /**
      * Adaugă o sarcină la această categorie
@@ -77,12 +79,27 @@ public:
      */
     void AddTask(Task* task);
     
+    /**
+     * Adaugă mai multe sarcini odată la această categorie
+     * Spațiul este rezervat o singură dată, apoi legăturile inverse (Task::AddCategory)
+     * sunt actualizate într-o singură parcurgere; pointerii null sunt ignorați
+     * @param tasks Începutul intervalului de sarcini
+     * @param count Numărul de sarcini din interval
+     */
+    void AddTasks(Task* const* tasks, size_t count);
+    
+    /**
+     * Adaugă toate sarcinile dintr-un vector la această categorie
+     * @param tasks Sarcinile de adăugat
+     */
+    void AddTasks(const std::vector<Task*>& tasks);
+    
     /**
      * Elimină o sarcină din această categorie
      * @param task_id ID-ul sarcinii de eliminat
      * @return true dacă sarcina a fost găsită și eliminată, false în caz contrar
      */
-    bool RemoveTask(const std::string& task_id);
+    bool RemoveTask(const Entity_Id& task_id);
     
     /**
      * Obține toate sarcinile din această categorie
@@ -90,6 +107,13 @@ public:
      */
     const std::vector<Task*>& GetTasks() const;
     
+    /**
+     * Setează modul de stocare al sarcinilor din categorie
+     * Modul INDEXED face căutarea și eliminarea după ID O(1) în medie
+     * @param mode Noul mod de stocare
+     */
+    void SetStorageMode(Task_Collection::Storage_Mode mode);
+    
     /**
      * Obține numărul de sarcini din această categorie
      * @return Numărul de sarcini
@@ -108,23 +132,27 @@ public:
      */
     friend std::ostream& operator<<(std::ostream& os, const Category& category);
     
-private:
-    std::string m_name;         // Numele categoriei
-    std::string m_description;  // Descrierea categoriei
-    std::string m_id;           // ID-ul unic al categoriei
-    std::vector<Task*> m_tasks; // Sarcinile din această categorie
+    /**
+     * Snapshot citește și restaurează câmpurile private (inclusiv ID-ul)
+     */
+    friend class Snapshot;
     
     /**
-     * Contor static pentru generarea ID-urilor unice
-     * Static înseamnă că este partajat între toate instanțele clasei
+     * Task_Importer adaugă sarcinile importate după ce a setat deja legăturile inverse
      */
-    static int s_id_counter;
+    friend class Task_Importer;
+    
+private:
+    std::string m_name;         // Numele categoriei
+    std::string m_description;  // Descrierea categoriei
+    Entity_Id m_id;             // ID-ul unic al categoriei
+    Task_Collection m_tasks;    // Sarcinile din această categorie
     
     /**
      * Generează un ID unic pentru categorie
-     * @return ID-ul generat ca string
+     * @return ID-ul generat
      */
-    std::string _GenerateId();
+    Entity_Id _GenerateId();
 };
 
 } // namespace Task_Management
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "inotifier.h"
+
+namespace Task_Management {
+
+/**
+ * Clasa Coalescing_Notifier - grupează notificările pentru același destinatar într-un rezumat
+ *
+ * Se așază în fața unui notificator (canalul: email, SMS etc.). Prima notificare pentru
+ * un destinatar deschide o fereastră de durată fixă; notificările următoare pentru același
+ * destinatar sunt adăugate la rezumatul lui, iar la închiderea ferestrei rezumatul este
+ * trimis ca o singură notificare. O rafală de modificări (ex: statusul a zeci de sarcini
+ * dintr-o listă) devine astfel un singur mesaj pentru fiecare destinatar.
+ *
+ * Un rezumat cu o singură notificare este trimis neschimbat. Un rezumat care atinge
+ * max_digest_size notificări este trimis imediat, fără a aștepta închiderea ferestrei.
+ *
+ * Ferestrele au aceeași durată, deci se închid în ordinea deschiderii: o coadă FIFO ține
+ * locul unui heap. Un fir de execuție propriu trimite rezumatele expirate, în loturi,
+ * prin INotifier::SendNotifications. Destructorul trimite rezumatele rămase.
+ *
+ * Pentru mai multe canale se folosește câte un Coalescing_Notifier pentru fiecare;
+ * notificatorul înlocuit poate fi și un Async_Notifier.
+ */
+class Coalescing_Notifier : public INotifier {
+public:
+    /**
+     * Constructor - pornește firul care trimite rezumatele
+     * @param notifier Notificatorul prin care se trimit rezumatele (nu este deținut)
+     * @param window Durata ferestrei de grupare
+     * @param max_digest_size Numărul maxim de notificări dintr-un rezumat
+     */
+    Coalescing_Notifier(INotifier* notifier, std::chrono::milliseconds window, size_t max_digest_size = 100);
+
+    /**
+     * Destructor - trimite rezumatele rămase și oprește firul
+     */
+    virtual ~Coalescing_Notifier();
+
+    /**
+     * Implementarea metodei din INotifier - adaugă notificarea la rezumatul destinatarului
+     * @param recipient Destinatarul notificării
+     * @param subject Subiectul notificării
+     * @param message Conținutul notificării
+     * @return true (notificarea este întotdeauna acceptată)
+     */
+    virtual bool SendNotification(const std::string& recipient, const std::string& subject, const std::string& message) const override;
+
+    /**
+     * Implementarea metodei din INotifier
+     * @return Tipul notificatorului înlocuit
+     */
+    virtual std::string GetNotificationType() const override;
+
+    /**
+     * Trimite imediat toate rezumatele, fără a aștepta închiderea ferestrelor
+     */
+    void Flush() const;
+
+    /**
+     * Obține numărul de notificări primite
+     * @return Numărul de apeluri SendNotification
+     */
+    std::uint64_t GetReceivedCount() const;
+
+    /**
+     * Obține numărul de notificări trimise prin notificatorul înlocuit
+     * @return Numărul de rezumate trimise
+     */
+    std::uint64_t GetSentCount() const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * Rezumatul unui destinatar, construit pe măsură ce sosesc notificările
+     */
+    struct Digest {
+        std::uint64_t sequence;   // Identifică fereastra (intrările vechi din m_windows sunt ignorate)
+        size_t count;             // Numărul de notificări din rezumat
+        std::string subject;      // Subiectul primei notificări
+        std::string message;      // Mesajul primei notificări, apoi textul rezumatului
+    };
+
+    /**
+     * O fereastră deschisă, în ordinea închiderii
+     */
+    struct Window {
+        Clock::time_point closes_at;  // Momentul închiderii
+        std::string recipient;        // Destinatarul
+        std::uint64_t sequence;       // Fereastra rezumatului la deschidere
+    };
+
+    INotifier* m_notifier;               // Notificatorul înlocuit
+    Clock::duration m_window;            // Durata ferestrei
+    size_t m_max_digest_size;            // Numărul maxim de notificări dintr-un rezumat
+    std::thread m_sender;                // Firul care trimite rezumatele expirate
+
+    mutable std::mutex m_mutex;                                // Protejează câmpurile de mai jos
+    mutable std::condition_variable m_changed;                 // Trezește firul de trimitere
+    mutable std::unordered_map<std::string, Digest> m_digests; // Rezumatele deschise, după destinatar
+    mutable std::deque<Window> m_windows;                      // Ferestrele, în ordinea închiderii
+    mutable std::vector<Notification> m_ready;                 // Rezumatele pline, de trimis imediat
+    mutable std::uint64_t m_next_sequence;                     // Numărul următoarei ferestre
+    mutable std::uint64_t m_received;                          // Notificările primite
+    bool m_stopping;                                           // Destructorul a fost apelat
+
+    mutable std::mutex m_send_mutex;                 // Păstrează ordinea trimiterilor
+    mutable std::atomic<std::uint64_t> m_sent;       // Rezumatele trimise
+
+    /**
+     * Mută un rezumat în lotul de trimis, cu subiectul și textul finale
+     */
+    static void _Close(Digest& digest, const std::string& recipient, std::vector<Notification>& batch);
+
+    /**
+     * Trimite un lot prin notificatorul înlocuit (apelată cu m_send_mutex luat)
+     */
+    void _SendBatch(std::vector<Notification>& batch) const;
+
+    void _SenderLoop();
+
+    // Copierea este interzisă - notificatorul deține firul de execuție
+    Coalescing_Notifier(const Coalescing_Notifier&) = delete;
+    Coalescing_Notifier& operator=(const Coalescing_Notifier&) = delete;
+};
+
+} // namespace Task_Management
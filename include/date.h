@@ -10,12 +10,15 @@ namespace Task_Management {
  * Această structură demonstrează utilizarea structurilor (struct) alături de clase în POO.
  * În C++, structurile sunt similare cu clasele, dar membrii sunt publici în mod implicit.
  * Structurile sunt folosite de obicei pentru date simple, fără comportament complex.
+ *
+ * Pe lângă an, lună și zi, data reține numărul zilei (zile de la 1970-01-01, în
+ * calendarul gregorian proleptic), calculat o singură dată la construcție. Comparațiile,
+ * AddDays și DaysBetween lucrează doar cu acest număr, fără mktime/localtime, deci nu
+ * depind de fusul orar (sau de ora de vară) și pot fi apelate din orice fir.
+ * Anul, luna și ziua sunt private și se citesc prin GetYear, GetMonth și GetDay, pentru
+ * ca numărul zilei să rămână mereu în acord cu ele (o dată se modifică doar prin atribuire).
  */
 struct Date {
-    int year;   // Anul
-    int month;  // Luna (1-12)
-    int day;    // Ziua (1-31)
-    
     /**
      * Constructor implicit
      * Inițializează toate câmpurile cu 0
@@ -36,6 +39,37 @@ struct Date {
      */
     Date(const Date& other);
     
+    /**
+     * Creează data corespunzătoare unui număr de zi
+     * @param day_number Numărul de zile de la 1970-01-01 (poate fi negativ)
+     * @return Data corespunzătoare
+     */
+    static Date FromDayNumber(int day_number);
+    
+    /**
+     * Obține numărul zilei
+     * @return Numărul de zile de la 1970-01-01 (negativ pentru datele anterioare)
+     */
+    int GetDayNumber() const;
+    
+    /**
+     * Obține anul
+     * @return Anul
+     */
+    int GetYear() const;
+    
+    /**
+     * Obține luna
+     * @return Luna (1-12)
+     */
+    int GetMonth() const;
+    
+    /**
+     * Obține ziua din lună
+     * @return Ziua (1-31)
+     */
+    int GetDay() const;
+    
     /**
      * Convertește data în string formatat
      * @return Data formatată ca string (ex: "2025-05-15")
@@ -51,6 +85,7 @@ struct Date {
     /**
      * Metodă statică pentru obținerea datei curente
      * Demonstrează conceptul de metode statice în C++
+     * Data este citită din Today_Clock, deci nu apelează localtime la fiecare apel
      * @return Obiect Date reprezentând data curentă
      */
     static Date GetCurrentDate();
@@ -112,6 +147,94 @@ struct Date {
      * @return true dacă această dată este mai mare sau egală cu other, false în caz contrar
      */
     bool operator>=(const Date& other) const;
+    
+    /**
+     * Calculează numărul zilei pentru o dată din calendarul gregorian proleptic
+     * Algoritmul "days from civil": anul este considerat a începe la 1 martie, astfel
+     * încât ziua bisectă să fie ultima, iar calculul folosește doar înmulțiri și împărțiri
+     * întregi (ciclul de 400 de ani are exact 146097 de zile).
+     * Lunile și zilele din afara intervalului sunt normalizate (ex: 31 aprilie = 1 mai).
+     * @param year Anul
+     * @param month Luna (1-12)
+     * @param day Ziua
+     * @return Numărul de zile de la 1970-01-01
+     */
+    static constexpr int DaysFromCivil(int year, int month, int day) {
+        return _DaysFromMarchYear(year - (month <= 2 ? 1 : 0), month, day);
+    }
+    
+    /**
+     * Calculează anul corespunzător unui număr de zi (inversul lui DaysFromCivil)
+     * @param day_number Numărul de zile de la 1970-01-01
+     * @return Anul
+     */
+    static constexpr int YearFromDays(int day_number) {
+        return _YearOfEra(_DayOfEra(day_number + EPOCH_SHIFT)) + _Era(day_number + EPOCH_SHIFT) * 400 +
+               (MonthFromDays(day_number) <= 2 ? 1 : 0);
+    }
+    
+    /**
+     * Calculează luna corespunzătoare unui număr de zi
+     * @param day_number Numărul de zile de la 1970-01-01
+     * @return Luna (1-12)
+     */
+    static constexpr int MonthFromDays(int day_number) {
+        return _MonthFromIndex(_MonthIndex(_DayOfMarchYear(_DayOfEra(day_number + EPOCH_SHIFT))));
+    }
+    
+    /**
+     * Calculează ziua din lună corespunzătoare unui număr de zi
+     * @param day_number Numărul de zile de la 1970-01-01
+     * @return Ziua (1-31)
+     */
+    static constexpr int DayFromDays(int day_number) {
+        return _DayFromDayOfYear(_DayOfMarchYear(_DayOfEra(day_number + EPOCH_SHIFT)));
+    }
+    
+private:
+    int m_year;        // Anul
+    int m_month;       // Luna (1-12)
+    int m_day;         // Ziua (1-31)
+    int m_day_number;  // Numărul zilei, folosit la comparații și calcule
+    
+    /**
+     * Numărul zilei pentru 1970-01-01 în numărătoarea de la 0000-03-01
+     */
+    static constexpr int EPOCH_SHIFT = 719468;
+    
+    // Pașii algoritmilor de mai sus; anul "martie" începe la 1 martie
+    static constexpr int _Era(int days) {
+        return (days >= 0 ? days : days - 146096) / 146097;
+    }
+    static constexpr int _DayOfEra(int days) {
+        return days - _Era(days) * 146097;
+    }
+    static constexpr int _YearOfEra(int day_of_era) {
+        return (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    }
+    static constexpr int _DayOfMarchYear(int day_of_era) {
+        return day_of_era - (365 * _YearOfEra(day_of_era) + _YearOfEra(day_of_era) / 4 - _YearOfEra(day_of_era) / 100);
+    }
+    static constexpr int _MonthIndex(int day_of_year) {
+        return (5 * day_of_year + 2) / 153;
+    }
+    static constexpr int _MonthFromIndex(int month_index) {
+        return month_index < 10 ? month_index + 3 : month_index - 9;
+    }
+    static constexpr int _DayFromDayOfYear(int day_of_year) {
+        return day_of_year - (153 * _MonthIndex(day_of_year) + 2) / 5 + 1;
+    }
+    static constexpr int _YearEra(int year) {
+        return (year >= 0 ? year : year - 399) / 400;
+    }
+    static constexpr int _DaysFromMarchYear(int year, int month, int day) {
+        return _YearEra(year) * 146097 +
+               _DaysOfYearOfEra(year - _YearEra(year) * 400) +
+               (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1 - EPOCH_SHIFT;
+    }
+    static constexpr int _DaysOfYearOfEra(int year_of_era) {
+        return year_of_era * 365 + year_of_era / 4 - year_of_era / 100;
+    }
 };
 
 } // namespace Task_Management
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+#include "itask_observer.h"
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class Task;
+class Deadline_Task;
+struct Date;
+
+/**
+ * Clasa Deadline_Index - index ordonat după termenul limită al sarcinilor Deadline_Task
+ *
+ * Sarcinile deschise (care nu sunt COMPLETED sau CANCELLED) sunt grupate pe zile: un
+ * arbore ordonat (std::map) are câte o intrare pentru fiecare zi cu termene, iar fiecare
+ * intrare reține vectorul sarcinilor din acea zi. Numărul de zile distincte este mic față
+ * de numărul de sarcini, deci căutarea unei zile este rapidă, iar o sarcină ocupă doar un
+ * pointer în index. Fiecare sarcină își reține poziția din vectorul zilei, astfel încât
+ * mutarea și eliminarea se fac în timp constant (prin interschimbare cu ultimul element).
+ *
+ * Interogările costă O(log Z + K), unde Z este numărul de zile distincte și K numărul de
+ * sarcini întoarse. Ordinea sarcinilor din aceeași zi nu este definită.
+ *
+ * Indexul este un ITask_Observer: SetDeadline și SetStatus îl actualizează automat.
+ * O sarcină poate face parte dintr-un singur index; sarcina se scoate singură din
+ * index la distrugere. Metodele pot fi apelate din mai multe fire de execuție, iar
+ * indexul poate fi creat și distrus în timp ce alte fire modifică sarcini.
+ */
+class Deadline_Index : public ITask_Observer {
+public:
+    /**
+     * Constructor - înregistrează indexul ca observator al sarcinilor
+     */
+    Deadline_Index();
+
+    /**
+     * Destructor - scoate toate sarcinile din index
+     */
+    ~Deadline_Index();
+
+    /**
+     * Adaugă o sarcină în index
+     * @param task Sarcina de adăugat
+     * @return true dacă sarcina a fost adăugată, false dacă pointerul este null sau
+     *         sarcina face deja parte dintr-un index
+     */
+    bool Add(Deadline_Task* task);
+
+    /**
+     * Adaugă toate sarcinile Deadline_Task dintr-un vector oarecare de sarcini
+     * @param tasks Sarcinile (celelalte tipuri sunt ignorate)
+     * @return Numărul de sarcini adăugate
+     */
+    size_t AddTasks(const std::vector<Task*>& tasks);
+
+    /**
+     * Elimină o sarcină din index
+     * @param task Sarcina de eliminat
+     * @return true dacă sarcina a fost găsită și eliminată, false în caz contrar
+     */
+    bool Remove(Deadline_Task* task);
+
+    /**
+     * Verifică dacă o sarcină face parte din acest index
+     * @param task Sarcina căutată
+     * @return true dacă sarcina este în index
+     */
+    bool Contains(const Deadline_Task* task) const;
+
+    /**
+     * Obține numărul de sarcini din index (deschise și închise)
+     * @return Numărul de sarcini
+     */
+    size_t Size() const;
+
+    /**
+     * Obține numărul de sarcini deschise, adică cele întoarse de interogări
+     * @return Numărul de sarcini deschise
+     */
+    size_t GetOpenCount() const;
+
+    /**
+     * Obține sarcinile deschise al căror termen limită a trecut (înainte de ziua curentă)
+     * @return Sarcinile, în ordinea crescătoare a termenului
+     */
+    std::vector<Deadline_Task*> GetOverdue() const;
+
+    /**
+     * Obține sarcinile deschise cu termenul într-un interval de zile
+     * @param first Prima zi din interval
+     * @param last Ultima zi din interval (inclusă)
+     * @return Sarcinile, în ordinea crescătoare a termenului
+     */
+    std::vector<Deadline_Task*> GetDueBetween(const Date& first, const Date& last) const;
+
+    /**
+     * Obține primele sarcini deschise care urmează, începând cu ziua curentă
+     * @param count Numărul maxim de sarcini
+     * @return Cel mult count sarcini, în ordinea crescătoare a termenului
+     */
+    std::vector<Deadline_Task*> GetNextDue(size_t count) const;
+
+    /**
+     * Implementarea metodei din ITask_Observer - actualizează poziția sarcinii
+     * la schimbarea termenului sau a statusului
+     */
+    void OnTaskChanged(const Task& task, Task_Change change, const Entity_Id& related) override;
+
+private:
+    mutable std::mutex m_mutex;                            // Protejează indexul și pozițiile din sarcini
+    std::map<int, std::vector<Deadline_Task*>> m_days;     // Ziua -> sarcinile deschise din acea zi
+    std::vector<Deadline_Task*> m_closed;                  // Sarcinile finalizate sau anulate
+    size_t m_open_count;                                   // Numărul de sarcini deschise
+
+    /**
+     * Așază o sarcină în lista zilei ei sau în lista sarcinilor închise
+     */
+    void _Place(Deadline_Task* task);
+
+    /**
+     * Scoate o sarcină din lista în care se află (fără a o elimina din index)
+     */
+    void _Unplace(Deadline_Task* task);
+
+    /**
+     * Adaugă în result sarcinile zilelor din [first, last), cel mult limit sarcini
+     */
+    void _Collect(std::map<int, std::vector<Deadline_Task*>>::const_iterator first,
+                  std::map<int, std::vector<Deadline_Task*>>::const_iterator last,
+                  size_t limit, std::vector<Deadline_Task*>& result) const;
+
+    // Copierea este interzisă - sarcinile rețin un pointer către index
+    Deadline_Index(const Deadline_Index&) = delete;
+    Deadline_Index& operator=(const Deadline_Index&) = delete;
+};
+
+} // namespace Task_Management
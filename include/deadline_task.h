@@ -2,10 +2,14 @@
 
 #include "task.h"
 #include "date.h"
+#include <cstdint>
 #include <string>
 
 namespace Task_Management {
 
+// Declarații anticipate (forward declarations)
+class Deadline_Index;
+
 /**
  * Clasa Deadline_Task - reprezintă o sarcină cu termen limită
  * 
@@ -93,8 +97,19 @@ protected:
      */
     virtual void _WriteDetailsToStream(std::ostream& os) const override;
     
+    /**
+     * Deadline_Index reține direct în sarcină poziția ei din index
+     */
+    friend class Deadline_Index;
+    
 private:
     Date m_deadline;  // Data limită pentru finalizarea sarcinii
+    
+    // Poziția sarcinii în Deadline_Index (gestionată doar de index)
+    Deadline_Index* m_index;      // Indexul care conține sarcina (nullptr dacă nu este indexată)
+    int m_index_day;              // Ziua sub care este indexată
+    std::uint32_t m_index_slot;   // Poziția în lista zilei (sau în lista sarcinilor închise)
+    bool m_index_open;            // Sarcina este în lista zilei (nu este finalizată sau anulată)
 };
 
 } // namespace Task_Management
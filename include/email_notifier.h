@@ -2,9 +2,13 @@
 
 #include "inotifier.h"
 #include <string>
+#include <vector>
 
 namespace Task_Management {
 
+// Declarații anticipate (forward declarations)
+class Smtp_Transport;
+
 /**
  * Clasa Email_Notifier - implementare a interfeței INotifier pentru notificări prin email
  * 
@@ -41,6 +45,17 @@ public:
      */
     virtual std::string GetNotificationType() const override;
     
+    /**
+     * Trimite un lot de notificări
+     * Suprascrie metoda din interfața INotifier: email-urile lotului sunt formatate
+     * împreună și scrise printr-o singură operație de ieșire
+     * 
+     * @param notifications Notificările de trimis
+     * @param delivered Primește, pentru fiecare notificare, rezultatul trimiterii
+     * @return Numărul de notificări trimise cu succes
+     */
+    virtual size_t SendNotifications(const std::vector<Notification>& notifications, std::vector<bool>& delivered) const override;
+    
     /**
      * Obține adresa de email a expeditorului
      * @return Adresa de email a expeditorului ca string
@@ -53,8 +68,21 @@ public:
      */
     void SetSenderEmail(const std::string& sender_email);
     
+    /**
+     * Setează transportul SMTP prin care se trimit email-urile
+     * Fără transport, email-urile sunt doar afișate
+     * @param transport Transportul (nu este deținut; nullptr pentru afișare)
+     */
+    void SetTransport(Smtp_Transport* transport);
+    
 private:
     std::string m_sender_email;  // Adresa de email a expeditorului
+    Smtp_Transport* m_transport; // Transportul SMTP (nullptr = afișare)
+    
+    /**
+     * Adaugă textul afișat pentru o notificare la finalul unui buffer
+     */
+    void _Format(const std::string& recipient, const std::string& subject, const std::string& message, std::string& out) const;
 };
 
 } // namespace Task_Management
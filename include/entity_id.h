@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <iosfwd>
+
+namespace Task_Management {
+
+/**
+ * Enumerație pentru tipul entității identificate de un Entity_Id
+ * Tipul determină prefixul formei text ("TASK-", "USER-", "CAT-", "LIST-")
+ */
+enum class Entity_Kind : std::uint8_t {
+    NONE = 0,   // ID invalid
+    TASK,       // Sarcină (Task și clasele derivate)
+    USER,       // Utilizator (User și clasele derivate)
+    CATEGORY,   // Categorie
+    TASK_LIST   // Listă de sarcini
+};
+
+/**
+ * Clasa Entity_Id - identificator compact pe 64 de biți pentru entitățile sistemului
+ *
+ * Cei mai semnificativi 8 biți rețin tipul entității, iar ceilalți 56 de biți numărul
+ * acesteia. Comparațiile și hash-ul lucrează direct pe întregul de 64 de biți;
+ * forma text (ex: "TASK-42") este produsă doar la afișare sau export, prin ToString(),
+ * și poate fi citită înapoi cu Parse().
+ *
+ * Metodele mici sunt definite inline deoarece sunt apelate pe toate căile de căutare.
+ */
+class Entity_Id {
+public:
+    /**
+     * Numărul maxim reprezentabil (56 de biți)
+     */
+    static const std::uint64_t MAX_NUMBER = (static_cast<std::uint64_t>(1) << 56) - 1;
+
+    /**
+     * Lungimea maximă a formei text (prefixul și 17 cifre), fără terminatorul '\0'
+     */
+    static const size_t MAX_TEXT_SIZE = 24;
+
+    /**
+     * Constructor implicit - creează un ID invalid (tip NONE, număr 0)
+     */
+    Entity_Id() : m_value(0) {}
+
+    /**
+     * Constructor cu tipul și numărul entității
+     * @param kind Tipul entității
+     * @param number Numărul entității (se păstrează doar cei 56 de biți inferiori)
+     */
+    Entity_Id(Entity_Kind kind, std::uint64_t number)
+        : m_value((static_cast<std::uint64_t>(kind) << 56) | (number & MAX_NUMBER)) {}
+
+    /**
+     * Creează un ID din valoarea brută pe 64 de biți (ex: la citirea din fișier)
+     * @param value Valoarea brută
+     * @return ID-ul corespunzător
+     */
+    static Entity_Id FromValue(std::uint64_t value) {
+        Entity_Id id;
+        id.m_value = value;
+        return id;
+    }
+
+    /**
+     * Obține valoarea brută pe 64 de biți
+     * @return Valoarea brută
+     */
+    std::uint64_t GetValue() const { return m_value; }
+
+    /**
+     * Obține tipul entității
+     * @return Tipul entității
+     */
+    Entity_Kind GetKind() const { return static_cast<Entity_Kind>(m_value >> 56); }
+
+    /**
+     * Obține numărul entității
+     * @return Numărul entității
+     */
+    std::uint64_t GetNumber() const { return m_value & MAX_NUMBER; }
+
+    /**
+     * Verifică dacă ID-ul este valid
+     * @return true dacă tipul nu este NONE, false în caz contrar
+     */
+    bool IsValid() const { return GetKind() != Entity_Kind::NONE; }
+
+    /**
+     * Convertește ID-ul în forma text (ex: "TASK-42")
+     * @return Forma text a ID-ului sau "INVALID" pentru un ID invalid
+     */
+    std::string ToString() const;
+
+    /**
+     * Scrie forma text a ID-ului într-un buffer, fără alocări (ex: la export)
+     * @param buffer Buffer de cel puțin MAX_TEXT_SIZE caractere (nu se adaugă '\0')
+     * @return Numărul de caractere scrise
+     */
+    size_t FormatTo(char* buffer) const;
+
+    /**
+     * Citește un ID din forma text
+     * @param text Textul de citit (ex: "CAT-3")
+     * @param id ID-ul rezultat, modificat doar în caz de succes
+     * @return true dacă textul este un ID valid, false în caz contrar
+     */
+    static bool TryParse(const std::string& text, Entity_Id& id);
+
+    /**
+     * Citește un ID din forma text
+     * @param text Textul de citit
+     * @return ID-ul citit sau un ID invalid dacă textul nu poate fi interpretat
+     */
+    static Entity_Id Parse(const std::string& text);
+
+    bool operator==(const Entity_Id& other) const { return m_value == other.m_value; }
+    bool operator!=(const Entity_Id& other) const { return m_value != other.m_value; }
+    bool operator<(const Entity_Id& other) const { return m_value < other.m_value; }
+
+    /**
+     * Supraîncărcarea operatorului << - scrie forma text a ID-ului
+     */
+    friend std::ostream& operator<<(std::ostream& os, const Entity_Id& id);
+
+private:
+    std::uint64_t m_value;  // Tipul (8 biți) și numărul (56 de biți)
+};
+
+/**
+ * Functor de hash pentru Entity_Id
+ * Amestecă biții (înmulțire Fibonacci) pentru ca numerele consecutive
+ * să se distribuie uniform și în biții superiori
+ */
+struct Entity_Id_Hash {
+    size_t operator()(const Entity_Id& id) const {
+        std::uint64_t x = id.GetValue() * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(x ^ (x >> 32));
+    }
+};
+
+} // namespace Task_Management
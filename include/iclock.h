@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Task_Management {
+
+/**
+ * Interfața IClock - sursa timpului curent și a datei locale
+ *
+ * Implementările pot fi înlocuite (ex: în teste, un ceas controlat manual) prin
+ * Today_Clock::SetClock. Metodele pot fi apelate simultan din mai multe fire.
+ */
+class IClock {
+public:
+    /**
+     * Destructor virtual pentru curățarea corectă a resurselor în clasele derivate
+     */
+    virtual ~IClock() {}
+
+    /**
+     * Obține timpul curent
+     * @return Numărul de secunde de la epoca Unix (1970-01-01 00:00:00 UTC)
+     */
+    virtual std::int64_t GetTime() const = 0;
+
+    /**
+     * Obține ziua locală care conține un moment dat
+     * @param time Momentul, în secunde de la epoca Unix
+     * @param next_day Primește momentul în care începe ziua locală următoare
+     * @return Numărul zilei locale (vezi Date::GetDayNumber)
+     */
+    virtual int GetLocalDay(std::int64_t time, std::int64_t& next_day) const = 0;
+};
+
+} // namespace Task_Management
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include "entity_id.h"
+
+namespace Task_Management {
+
+/**
+ * Clasa Id_Allocator - generatorul de ID-uri unice pentru toate tipurile de entități
+ *
+ * Înlocuiește contoarele statice de tip int din Task, User, Category și Task_List,
+ * care produceau curse de date și ID-uri duplicate la construirea obiectelor
+ * din mai multe fire de execuție.
+ *
+ * Pentru fiecare tip de entitate există un contor atomic global. Fiecare fir de execuție
+ * rezervă din el blocuri de BLOCK_SIZE numere și le consumă local, fără operații atomice,
+ * astfel încât generarea nu devine un punct de contenție între nuclee. Într-un singur
+ * fir de execuție ID-urile rămân consecutive (1, 2, 3, ...); între fire diferite sunt
+ * unice, dar nu neapărat în ordinea creării.
+ *
+ * Singleton, ca Task_Manager.
+ */
+class Id_Allocator {
+public:
+    /**
+     * Numărul de ID-uri rezervate odată de un fir de execuție
+     */
+    static const std::uint64_t BLOCK_SIZE = 1024;
+
+    /**
+     * Numărul de tipuri de entități (inclusiv NONE)
+     */
+    static const int KIND_COUNT = 5;
+
+    /**
+     * Obține instanța unică a generatorului
+     * @return Referință către instanța unică
+     */
+    static Id_Allocator& GetInstance();
+
+    /**
+     * Generează un ID nou pentru tipul de entitate specificat
+     * Thread-safe; în cazul obișnuit nu folosește nicio operație atomică de scriere
+     * @param kind Tipul entității
+     * @return ID-ul generat
+     */
+    Entity_Id Allocate(Entity_Kind kind);
+
+    /**
+     * Continuă numerotarea după cel mai mare ID persistat (ex: la repornire)
+     * ID-urile generate ulterior pentru tipul respectiv vor fi strict mai mari.
+     * Blocurile deja rezervate de firele de execuție sunt abandonate.
+     * Trebuie apelată înainte ca alte fire să genereze ID-uri de același tip.
+     * @param highest Cel mai mare ID existent
+     */
+    void ResumeFrom(const Entity_Id& highest);
+
+    /**
+     * Obține cel mai mare număr rezervat până acum pentru un tip de entitate
+     * Toate ID-urile generate au numere mai mici sau egale cu această valoare
+     * @param kind Tipul entității
+     * @return Cel mai mare număr rezervat (0 dacă nu s-a generat niciun ID)
+     */
+    std::uint64_t GetHighWaterMark(Entity_Kind kind) const;
+
+private:
+    std::atomic<std::uint64_t> m_next[KIND_COUNT];  // Următorul număr nerezervat pentru fiecare tip
+    std::atomic<std::uint64_t> m_epoch;             // Crește la ResumeFrom, invalidând blocurile locale
+
+    /**
+     * Constructor privat - instanța se obține doar prin GetInstance()
+     */
+    Id_Allocator();
+
+    // Copierea și atribuirea sunt interzise pentru un Singleton
+    Id_Allocator(const Id_Allocator&) = delete;
+    Id_Allocator& operator=(const Id_Allocator&) = delete;
+};
+
+} // namespace Task_Management
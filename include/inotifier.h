@@ -1,9 +1,19 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 namespace Task_Management {
 
+/**
+ * Structura Notification - o notificare care așteaptă trimiterea
+ */
+struct Notification {
+    std::string recipient;  // Destinatarul notificării
+    std::string subject;    // Subiectul notificării
+    std::string message;    // Conținutul notificării
+};
+
 /**
  * Interfața INotifier - definește contractul pentru diferite metode de notificare
  * 
@@ -37,6 +47,26 @@ public:
      * @return Tipul notificării ca string
      */
     virtual std::string GetNotificationType() const = 0;
+    
+    /**
+     * Trimite un lot de notificări
+     * Implicit, fiecare notificare este trimisă cu SendNotification; implementările
+     * pot suprascrie metoda pentru a trimite lotul printr-o singură operație de ieșire.
+     * 
+     * @param notifications Notificările de trimis
+     * @param delivered Primește, pentru fiecare notificare, rezultatul trimiterii
+     * @return Numărul de notificări trimise cu succes
+     */
+    virtual size_t SendNotifications(const std::vector<Notification>& notifications, std::vector<bool>& delivered) const {
+        size_t sent = 0;
+        delivered.assign(notifications.size(), false);
+        for (size_t i = 0; i < notifications.size(); ++i) {
+            const Notification& notification = notifications[i];
+            delivered[i] = SendNotification(notification.recipient, notification.subject, notification.message);
+            sent += delivered[i] ? 1 : 0;
+        }
+        return sent;
+    }
 };
 
 } // namespace Task_Management
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "entity_id.h"
+
+namespace Task_Management {
+
+// Declarații anticipate (forward declarations)
+class Task;
+
+/**
+ * Enumerație pentru tipurile de modificări ale unei sarcini
+ */
+enum class Task_Change {
+    TITLE,            // SetTitle
+    DESCRIPTION,      // SetDescription
+    PRIORITY,         // SetPriority
+    STATUS,           // SetStatus
+    ASSIGNED_USER,    // AssignTo (related = utilizatorul sau un ID invalid)
+    CATEGORY_ADDED,   // AddCategory (related = categoria)
+    SUBTASK_ADDED,    // Project_Task::AddSubtask (related = sub-sarcina)
+    SUBTASK_REMOVED,  // Project_Task::RemoveSubtask (related = sub-sarcina)
+    DEADLINE,         // Deadline_Task::SetDeadline
+    CREATED,          // Constructorul unei sarcini (nu și constructorul de copiere)
+    DELETED           // Destructorul unei sarcini, inclusiv al copiilor (înaintea distrugerii ei)
+};
+
+/**
+ * Interfața ITask_Observer - primește modificările sarcinilor, după aplicarea lor
+ *
+ * Observatorii se înregistrează global cu Task::AddObserver și sunt apelați din
+ * firul de execuție care a modificat sarcina, înainte ca setter-ul să returneze.
+ * Înregistrarea și eliminarea (Task::RemoveObserver) pot avea loc oricând, din orice fir;
+ * după RemoveObserver observatorul nu mai este apelat și poate fi distrus.
+ * La CREATED sarcina este construită complet; la DELETED destructorul clasei derivate
+ * a rulat deja, deci observatorul poate folosi doar adresa și ID-ul sarcinii.
+ * Copiile (constructorul de copiere) păstrează ID-ul originalului: crearea lor nu este
+ * anunțată, iar distrugerea lor este anunțată (pentru observatorii care rețin adresa
+ * sarcinii, ca Ready_Queue), deși ID-ul poate aparține încă originalului.
+ */
+class ITask_Observer {
+public:
+    /**
+     * Destructor virtual pentru curățarea corectă a resurselor în clasele derivate
+     */
+    virtual ~ITask_Observer() {}
+
+    /**
+     * Apelată după fiecare modificare a unei sarcini
+     * Valoarea nouă se citește din sarcină (GetTitle, GetStatus etc.)
+     * @param task Sarcina modificată
+     * @param change Tipul modificării
+     * @param related ID-ul obiectului implicat (utilizator, categorie, sub-sarcină)
+     */
+    virtual void OnTaskChanged(const Task& task, Task_Change change, const Entity_Id& related) = 0;
+};
+
+} // namespace Task_Management
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class Task_Notes;
+class Work_Stealing_Pool;
+
+/**
+ * Structura Keyword_Match - un cuvânt cheie găsit în textele unei sarcini
+ */
+struct Keyword_Match {
+    /**
+     * Valoarea lui note când cuvântul apare în titlul sau descrierea sarcinii
+     */
+    static const size_t TASK_TEXT = static_cast<size_t>(-1);
+
+    size_t task;            // Indexul sarcinii în vectorul dat lui ScanTasks
+    size_t note;            // Poziția notei în Task_Notes::GetNotes() sau TASK_TEXT
+    std::uint32_t keyword;  // Indexul cuvântului cheie în vectorul dat constructorului
+};
+
+/**
+ * Clasa Keyword_Automaton - căutarea simultană a mai multor cuvinte cheie (Aho-Corasick)
+ *
+ * Cuvintele cheie sunt compilate o singură dată într-un automat finit determinist: fiecare
+ * octet al textului face o singură tranziție, indiferent de numărul cuvintelor, deci un text
+ * este parcurs o singură dată pentru toate cuvintele (în loc de câte o căutare pentru
+ * fiecare cuvânt). Octeții sunt grupați în clase (octeții care nu apar în niciun cuvânt
+ * formează o singură clasă), astfel încât tabelul de tranziții rămâne mic.
+ *
+ * Automatul nu se modifică după construire, deci poate fi folosit simultan din mai multe
+ * fire. Opțional, literele ASCII sunt comparate fără diferențe între mari și mici, ca în
+ * Text_Matcher. Cuvintele goale nu sunt raportate niciodată.
+ */
+class Keyword_Automaton {
+public:
+    /**
+     * Constructor - compilează automatul
+     * Tabelul de tranziții are (numărul de stări) x (numărul claselor de octeți) intrări,
+     * limitat la 2^31; numărul de stări este cel mult lungimea totală a cuvintelor plus unu.
+     * @param keywords Cuvintele cheie (indexul fiecăruia identifică cuvântul în rezultate)
+     * @param ignore_case true pentru comparații fără diferențe între literele mari și mici ASCII
+     */
+    explicit Keyword_Automaton(const std::vector<std::string>& keywords, bool ignore_case = false);
+
+    /**
+     * Obține numărul de cuvinte cheie
+     * @return Numărul de cuvinte
+     */
+    size_t GetKeywordCount() const;
+
+    /**
+     * Obține un cuvânt cheie, așa cum a fost dat constructorului
+     * @param index Indexul cuvântului
+     * @return Cuvântul cheie
+     */
+    const std::string& GetKeyword(size_t index) const;
+
+    /**
+     * Obține numărul de stări ale automatului
+     * @return Numărul de stări
+     */
+    size_t GetStateCount() const;
+
+    /**
+     * Caută toate cuvintele cheie într-un text
+     * @param text Începutul textului
+     * @param size Lungimea textului
+     * @param keywords Primește indexurile cuvintelor găsite, fără repetări, în ordine crescătoare
+     */
+    void Scan(const char* text, size_t size, std::vector<std::uint32_t>& keywords) const;
+
+    /**
+     * Caută toate cuvintele cheie într-un text
+     * @param text Textul
+     * @return Indexurile cuvintelor găsite, fără repetări, în ordine crescătoare
+     */
+    std::vector<std::uint32_t> Scan(const std::string& text) const;
+
+    /**
+     * Caută cuvintele cheie în toate textele mai multor sarcini: titlul și descrierea
+     * sarcinii asociate (tratate împreună, ca TASK_TEXT) și fiecare notă. Fiecare text este
+     * parcurs o singură dată, fără a fi copiat. Sarcinile sunt împărțite în blocuri
+     * procesate în paralel, dacă există un pool.
+     * @param tasks Notele sarcinilor (pointerii null sunt ignorați; notele fără sarcină
+     *              asociată au doar textele notelor)
+     * @param pool Pool-ul folosit pentru căutarea în paralel (nullptr pentru firul curent)
+     * @return Potrivirile, ordonate după sarcină, apoi text (TASK_TEXT înaintea notelor),
+     *         apoi cuvânt; fiecare cuvânt apare cel mult o dată pentru un text
+     */
+    std::vector<Keyword_Match> ScanTasks(const std::vector<const Task_Notes*>& tasks,
+                                         Work_Stealing_Pool* pool = nullptr) const;
+
+private:
+    std::vector<std::string> m_keywords;          // Cuvintele cheie, așa cum au fost date
+    bool m_ignore_case;                           // Literele ASCII sunt comparate fără diferențe
+    size_t m_class_count;                         // Numărul claselor de octeți
+    std::uint16_t m_classes[256];                 // Octet -> clasa lui
+    std::vector<std::uint32_t> m_transitions;     // Rândul stării următoare (vezi constructorul), m_class_count intrări pe stare
+    std::vector<std::uint32_t> m_output_begin;    // Începutul cuvintelor fiecărei stări în m_outputs
+    std::vector<std::uint32_t> m_outputs;         // Cuvintele recunoscute în fiecare stare
+
+    /**
+     * Parcurge un text și raportează cuvintele găsite care nu au fost deja raportate
+     * @param seen Pentru fiecare cuvânt, ultimul text (stamp) în care a fost raportat
+     * @param stamp Identificatorul textului curent
+     * @param keywords Primește indexurile cuvintelor noi, în ordinea găsirii
+     */
+    void _Scan(const char* text, size_t size, std::vector<std::uint32_t>& seen, std::uint32_t stamp,
+               std::vector<std::uint32_t>& keywords) const;
+};
+
+} // namespace Task_Management
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "iclock.h"
+#include <atomic>
+
+namespace Task_Management {
+
+struct Date;
+
+/**
+ * Clasa Manual_Clock - ceas controlat explicit, folosit în teste
+ *
+ * Timpul avansează doar prin SetTime, SetDate sau Advance. Zilele sunt calculate
+ * în UTC, deci rezultatul nu depinde de fusul orar al mașinii.
+ */
+class Manual_Clock : public IClock {
+public:
+    /**
+     * Constructor
+     * @param time Timpul inițial, în secunde de la epoca Unix
+     */
+    explicit Manual_Clock(std::int64_t time = 0);
+
+    /**
+     * Setează timpul curent
+     * @param time Numărul de secunde de la epoca Unix
+     */
+    void SetTime(std::int64_t time);
+
+    /**
+     * Setează timpul la începutul unei zile
+     * @param date Data dorită
+     */
+    void SetDate(const Date& date);
+
+    /**
+     * Avansează (sau, cu o valoare negativă, dă înapoi) timpul curent
+     * @param seconds Numărul de secunde
+     */
+    void Advance(std::int64_t seconds);
+
+    /**
+     * Implementarea metodei din IClock - timpul setat
+     */
+    virtual std::int64_t GetTime() const override;
+
+    /**
+     * Implementarea metodei din IClock - ziua UTC
+     */
+    virtual int GetLocalDay(std::int64_t time, std::int64_t& next_day) const override;
+
+private:
+    std::atomic<std::int64_t> m_time;  // Timpul curent, în secunde
+};
+
+} // namespace Task_Management
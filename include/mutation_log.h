@@ -0,0 +1,183 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "itask_observer.h"
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+struct Task_Graph;
+class Task_Factory;
+
+/**
+ * Clasa Mutation_Log - jurnal de scriere anticipată (write-ahead log) pentru modificările sarcinilor
+ *
+ * După Open, jurnalul este înregistrat ca ITask_Observer și adaugă la sfârșitul fișierului
+ * câte o înregistrare pentru fiecare modificare (SetTitle, SetStatus, AssignTo,
+ * AddCategory, AddSubtask, SetDeadline etc.). Înregistrările sunt scrise pe disc de un fir de execuție
+ * dedicat: toate modificările acumulate cât timp firul scrie lotul anterior ajung în
+ * același write() și același fdatasync() (group commit), deci costul sincronizării cu
+ * discul este împărțit între toate firele care modifică sarcini în acel moment.
+ *
+ * În modul SYNC, fiecare setter returnează doar după ce modificarea este pe disc; în
+ * modul ASYNC setter-ii nu așteaptă, iar durabilitatea se confirmă explicit cu
+ * WaitDurable sau Flush.
+ *
+ * Jurnalul completează Snapshot: la pornire se încarcă ultimul snapshot, se aplică
+ * jurnalul cu Replay, apoi se deschide jurnalul cu Open. După un Snapshot::Save reușit,
+ * Reset golește jurnalul.
+ *
+ * Crearea sarcinilor (tipul și câmpurile constructorului) și distrugerea lor sunt și ele
+ * jurnalizate, deci Replay recreează sarcinile create după ultimul snapshot și le
+ * distruge pe cele șterse. Copiile sarcinilor (același ID) nu sunt jurnalizate. La
+ * oprirea aplicației, Close trebuie apelată înainte de distrugerea sarcinilor, altfel
+ * distrugerea lor ar fi jurnalizată. Utilizatorii, categoriile, listele și notele nu
+ * sunt jurnalizate, ci salvate prin snapshot-uri.
+ *
+ * În modul ASYNC, dacă discul nu ține pasul, setter-ii așteaptă când înregistrările
+ * nescrise depășesc câțiva megaocteți, ca memoria să nu crească nelimitat.
+ *
+ * Fiecare înregistrare: dimensiunea (4 octeți), suma de control (4 octeți), tipul
+ * modificării, ID-ul sarcinii și valoarea nouă. O înregistrare incompletă sau coruptă
+ * la sfârșitul fișierului (scriere întreruptă de o cădere) este ignorată și eliminată
+ * de Replay.
+ *
+ * Folosește API-ul POSIX (open, write, fdatasync).
+ */
+class Mutation_Log : public ITask_Observer {
+public:
+    /**
+     * Identificatorul de la începutul fiecărui fișier jurnal
+     */
+    static const char MAGIC[8];
+
+    /**
+     * Enumerație pentru momentul în care o modificare este confirmată
+     */
+    enum class Durability {
+        SYNC,   // Setter-ul așteaptă scrierea pe disc
+        ASYNC   // Setter-ul nu așteaptă; confirmarea se face cu WaitDurable/Flush
+    };
+
+    Mutation_Log();
+
+    /**
+     * Destructor - scrie modificările rămase și închide fișierul
+     */
+    ~Mutation_Log();
+
+    /**
+     * Deschide (sau creează) jurnalul și începe înregistrarea modificărilor
+     * Trebuie apelată după Snapshot::Load și Replay, altfel modificările făcute de
+     * acestea ar fi jurnalizate din nou.
+     * @param path Calea fișierului
+     * @param durability Modul de confirmare a modificărilor
+     * @return true dacă jurnalul a fost deschis, false la eroare
+     */
+    bool Open(const std::string& path, Durability durability = Durability::SYNC);
+
+    /**
+     * Oprește înregistrarea, scrie modificările rămase și închide fișierul
+     */
+    void Close();
+
+    bool IsOpen() const;
+
+    /**
+     * Adaugă modificarea în jurnal (apelată de Task)
+     */
+    void OnTaskChanged(const Task& task, Task_Change change, const Entity_Id& related) override;
+
+    /**
+     * Obține numărul de ordine al ultimei modificări adăugate
+     * @return Numărul de ordine (0 dacă nu s-a adăugat nimic)
+     */
+    std::uint64_t GetLastSequence() const;
+
+    /**
+     * Așteaptă ca toate modificările până la un număr de ordine să fie pe disc
+     * @param sequence Numărul de ordine (ex: GetLastSequence() după un set de modificări)
+     * @return true dacă modificările sunt pe disc, false dacă scrierea a eșuat
+     */
+    bool WaitDurable(std::uint64_t sequence);
+
+    /**
+     * Așteaptă scrierea pe disc a tuturor modificărilor adăugate până acum
+     * @return true la succes, false dacă scrierea a eșuat
+     */
+    bool Flush();
+
+    /**
+     * Golește jurnalul, după ce starea curentă a fost salvată într-un snapshot
+     * Ordinea este: Snapshot::Save, apoi Reset doar dacă Save a întors true. Save scrie
+     * snapshot-ul într-un fișier temporar sincronizat (fsync), îl redenumește și
+     * sincronizează directorul, deci după true snapshot-ul nou supraviețuiește unei căderi;
+     * un Reset după un Save eșuat ar pierde modificările din jurnal.
+     * Sarcinile nu trebuie modificate între Snapshot::Save și Reset.
+     * @return true la succes, false la eroare
+     */
+    bool Reset();
+
+    /**
+     * Verifică dacă o scriere a eșuat; după un eșec, modificările nu mai sunt confirmate
+     * @return true dacă jurnalul a întâlnit o eroare de scriere
+     */
+    bool HasFailed() const;
+
+    /**
+     * Aplică un jurnal peste un graf încărcat din snapshot
+     * Sarcinile create sunt adăugate în graph.tasks cu ID-ul lor inițial; sarcinile șterse
+     * sunt scoase din graf (liste, categorii, utilizatori, note) și distruse. Înregistrările
+     * care referă obiecte absente din graf nu pot fi aplicate și sunt numărate în skipped.
+     * Finalul incomplet al fișierului (după ultima înregistrare validă) este eliminat.
+     * @param path Calea fișierului jurnal (un fișier inexistent înseamnă un jurnal gol)
+     * @param graph Graful peste care se aplică modificările
+     * @param factory Fabrica sarcinilor grafului (ca la Snapshot::Load), sau nullptr pentru new/delete
+     * @param applied Dacă nu este nullptr, primește numărul de modificări aplicate
+     * @param skipped Dacă nu este nullptr, primește numărul de înregistrări care nu au putut fi aplicate
+     * @return true la succes, false dacă fișierul nu este un jurnal valid
+     */
+    static bool Replay(const std::string& path, Task_Graph& graph, Task_Factory* factory = nullptr,
+                       size_t* applied = nullptr, size_t* skipped = nullptr);
+
+private:
+    int m_fd;                              // Descriptorul fișierului (-1 dacă este închis)
+    Durability m_durability;               // Modul de confirmare
+    std::thread m_flusher;                 // Firul care scrie loturile pe disc
+
+    mutable std::mutex m_mutex;            // Protejează câmpurile de mai jos
+    std::condition_variable m_has_work;    // Semnalează firului de scriere înregistrări noi
+    std::condition_variable m_durable;     // Semnalează firelor care așteaptă un lot scris
+    std::condition_variable m_has_space;   // Semnalează setter-ilor că m_pending s-a golit
+    std::vector<char> m_pending;           // Înregistrările care așteaptă scrierea
+    std::uint64_t m_appended_sequence;     // Numărul de ordine al ultimei înregistrări adăugate
+    std::uint64_t m_durable_sequence;      // Numărul de ordine al ultimei înregistrări pe disc
+    bool m_stopping;                       // Close() a fost apelată
+    bool m_failed;                         // O scriere a eșuat
+
+    std::mutex m_io_mutex;                 // Serializează scrierea unui lot cu Reset()
+
+    class Replayer;  // Aplicarea înregistrărilor la Replay (definită în mutation_log.cpp)
+
+    void _FlusherLoop();
+
+    /**
+     * Adaugă la înregistrare tipul sarcinii create și câmpurile necesare recreării ei
+     * @return false dacă tipul sarcinii nu poate fi recreat
+     */
+    static bool _AppendCreated(std::string& record, const Task& task);
+
+    // Copierea este interzisă - jurnalul deține fișierul și firul de execuție
+    Mutation_Log(const Mutation_Log&) = delete;
+    Mutation_Log& operator=(const Mutation_Log&) = delete;
+};
+
+} // namespace Task_Management
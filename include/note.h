@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include "text_matcher.h"
+
 namespace Task_Management {
 
 /**
@@ -44,10 +47,21 @@ struct Note {
     /**
      * Verifică dacă nota conține un anumit cuvânt cheie
      * @param keyword Cuvântul cheie de căutat
+     * @param ignore_case true pentru a nu face diferențe între literele mari și mici ASCII
+     * @return true dacă nota conține cuvântul cheie, false în caz contrar
+     */
+    bool ContainsKeyword(const std::string& keyword, bool ignore_case = false) const {
+        return Text_Matcher(keyword, ignore_case).Matches(text);
+    }
+
+    /**
+     * Verifică dacă nota conține cuvântul cheie al unui Text_Matcher deja pregătit
+     * (folosit la căutarea aceluiași cuvânt în multe note)
+     * @param matcher Cuvântul cheie pregătit
      * @return true dacă nota conține cuvântul cheie, false în caz contrar
      */
-    bool ContainsKeyword(const std::string& keyword) const {
-        return text.find(keyword) != std::string::npos;
+    bool ContainsKeyword(const Text_Matcher& matcher) const {
+        return matcher.Matches(text);
     }
 };
 
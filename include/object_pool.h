@@ -0,0 +1,193 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Task_Management {
+
+/**
+ * Clasa Object_Pool - alocator de obiecte de un singur tip, pe blocuri mari (slab-uri)
+ *
+ * Obiectele sunt construite în sloturi aflate unul lângă altul în blocuri de SLAB_SIZE
+ * sloturi, deci obiectele create succesiv sunt contigue în memorie. Sloturile eliberate
+ * sunt refolosite printr-o listă de sloturi libere, fără apeluri către alocatorul global.
+ *
+ * Create și Destroy pot fi apelate din mai multe fire de execuție: lista de sloturi
+ * este protejată de un mutex, iar constructorii și destructorii rulează în afara lui.
+ *
+ * @tparam T Tipul obiectelor alocate
+ */
+template <typename T>
+class Object_Pool {
+public:
+    /**
+     * Numărul de sloturi dintr-un bloc
+     */
+    static const size_t SLAB_SIZE = 1024;
+
+    Object_Pool() : m_free_list(nullptr), m_current_slab(0), m_next_in_slab(0), m_live_count(0) {}
+
+    /**
+     * Destructor - distruge obiectele rămase și eliberează blocurile
+     */
+    ~Object_Pool() {
+        ReleaseAll();
+    }
+
+    /**
+     * Construiește un obiect nou într-un slot liber
+     * @param args Argumentele constructorului lui T
+     * @return Pointer către obiectul construit
+     */
+    template <typename... Args>
+    T* Create(Args&&... args) {
+        Slot* slot = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            slot = _AcquireSlot();
+        }
+
+        // Constructorul rulează în afara lacătului; dacă aruncă o excepție, slotul revine în pool
+        T* object = nullptr;
+        try {
+            object = new (&slot->storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            _ReturnSlot(slot);
+            throw;
+        }
+
+        // Slotul aparține exclusiv acestui fir până la returnarea obiectului
+        slot->live = true;
+        m_live_count.fetch_add(1, std::memory_order_relaxed);
+        return object;
+    }
+
+    /**
+     * Distruge un obiect creat de acest pool și îi eliberează slotul
+     * @param object Obiectul de distrus (ignorat dacă este nullptr)
+     */
+    void Destroy(T* object) {
+        if (!object) {
+            return;
+        }
+
+        // Destructorul rulează în afara lacătului (poate apela alte pool-uri)
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        slot->live = false;
+        m_live_count.fetch_sub(1, std::memory_order_relaxed);
+        object->~T();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        _ReturnSlot(slot);
+    }
+
+    /**
+     * Distruge toate obiectele încă existente; blocurile sunt păstrate pentru refolosire
+     * Nu trebuie apelată în paralel cu Create sau Destroy
+     */
+    void ReleaseAll() {
+        // Obiectele sunt distruse în ordinea creării, bloc cu bloc
+        for (size_t i = 0; i < m_slabs.size(); ++i) {
+            Slot* slab = m_slabs[i].get();
+            for (size_t j = 0; j < SLAB_SIZE; ++j) {
+                if (slab[j].live) {
+                    slab[j].live = false;
+                    reinterpret_cast<T*>(&slab[j].storage)->~T();
+                }
+            }
+        }
+
+        // Toate sloturile devin din nou disponibile, în ordine
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_free_list = nullptr;
+        m_current_slab = 0;
+        m_next_in_slab = 0;
+        m_live_count = 0;
+    }
+
+    /**
+     * Rezervă blocuri pentru un număr de obiecte, înaintea unei creări masive
+     * @param count Numărul total de obiecte estimat
+     */
+    void Reserve(size_t count) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t slab_count = (count + SLAB_SIZE - 1) / SLAB_SIZE;
+        while (m_slabs.size() < slab_count) {
+            _AddSlab();
+        }
+    }
+
+    /**
+     * Obține numărul de obiecte existente
+     * @return Numărul de obiecte create și încă nedistruse
+     */
+    size_t GetLiveCount() const {
+        return m_live_count.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * Un slot al pool-ului; obiectul se află la începutul slotului, deci un pointer
+     * către obiect este și un pointer către slot
+     */
+    struct Slot {
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        Slot* next_free;  // Următorul slot liber (valid doar pentru sloturile libere)
+        bool live;        // true dacă slotul conține un obiect construit
+    };
+
+    mutable std::mutex m_mutex;                 // Protejează starea pool-ului
+    std::vector<std::unique_ptr<Slot[]>> m_slabs; // Blocurile alocate
+    Slot* m_free_list;                          // Sloturile eliberate, refolosite primele
+    size_t m_current_slab;                      // Blocul din care se alocă secvențial
+    size_t m_next_in_slab;                      // Primul slot nefolosit din blocul curent
+    std::atomic<size_t> m_live_count;           // Numărul de obiecte existente
+
+    Slot* _AcquireSlot() {
+        if (m_free_list) {
+            Slot* slot = m_free_list;
+            m_free_list = slot->next_free;
+            return slot;
+        }
+
+        // Alocare secvențială din blocul curent, trecând la următorul bloc când se umple
+        if (m_next_in_slab == SLAB_SIZE) {
+            ++m_current_slab;
+            m_next_in_slab = 0;
+        }
+        if (m_current_slab == m_slabs.size()) {
+            _AddSlab();
+        }
+        return &m_slabs[m_current_slab][m_next_in_slab++];
+    }
+
+    void _ReturnSlot(Slot* slot) {
+        slot->next_free = m_free_list;
+        m_free_list = slot;
+    }
+
+    void _AddSlab() {
+        std::unique_ptr<Slot[]> slab(new Slot[SLAB_SIZE]);
+        for (size_t i = 0; i < SLAB_SIZE; ++i) {
+            slab[i].next_free = nullptr;
+            slab[i].live = false;
+        }
+        m_slabs.push_back(std::move(slab));
+    }
+
+    // Copierea este interzisă - pool-ul deține obiectele
+    Object_Pool(const Object_Pool&) = delete;
+    Object_Pool& operator=(const Object_Pool&) = delete;
+};
+
+template <typename T>
+const size_t Object_Pool<T>::SLAB_SIZE;
+
+} // namespace Task_Management
@@ -1,11 +1,37 @@
 #pragma once
 
 #include "task.h"
+#include "task_collection.h"
+#include <atomic>
+#include <cstddef>
 #include <string>
 #include <vector>
 
 namespace Task_Management {
 
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class Work_Stealing_Pool;
+
+/**
+ * Agregatele unui subarbore de sarcini, calculate de Project_Task::RecomputeRollup
+ * O sarcină care apare în mai multe proiecte este numărată la fiecare apariție
+ */
+struct Rollup_Stats {
+    double completion_percentage;  // Procentul de finalizare al rădăcinii subarborelui
+    bool is_completed;             // Starea de finalizare a rădăcinii
+    size_t task_count;             // Numărul de sarcini din subarbore (inclusiv rădăcina)
+    size_t completed_task_count;   // Câte dintre acestea sunt finalizate
+    size_t leaf_count;             // Numărul de sarcini fără sub-sarcini
+    size_t max_depth;              // Adâncimea subarborelui (1 pentru o singură sarcină)
+    
+    Rollup_Stats()
+        : completion_percentage(0.0), is_completed(false), task_count(0),
+          completed_task_count(0), leaf_count(0), max_depth(0) {}
+};
+
 /**
  * Clasa Project_Task - reprezintă o sarcină complexă cu mai multe sub-sarcini
  * 
@@ -15,6 +41,11 @@ namespace Task_Management {
  */
 class Project_Task : public Task {
 public:
+    /**
+     * Dimensiunea implicită a subarborelui sub care RecomputeRollup evaluează serial
+     */
+    static const size_t DEFAULT_SERIAL_THRESHOLD = 4096;
+    
     /**
      * Constructor cu parametri necesari
      * @param title Titlul proiectului
@@ -49,6 +80,7 @@ public:
     /**
      * Implementarea funcției virtuale pure pentru verificarea dacă proiectul este finalizat
      * Un proiect este finalizat doar dacă toate sub-sarcinile sale sunt finalizate
+     * Răspunsul vine din agregatele păstrate în cache, deci este O(1)
      * @return true dacă toate sub-sarcinile sunt finalizate, false în caz contrar
      */
     virtual bool IsCompleted() const override;
@@ -56,6 +88,7 @@ public:
     /**
      * Implementarea funcției virtuale pure pentru calcularea procentului de finalizare
      * Pentru proiecte, aceasta se bazează pe finalizarea sub-sarcinilor
+     * Răspunsul vine din agregatele păstrate în cache, deci este O(1)
      * @return Procentul mediu de finalizare al tuturor sub-sarcinilor
      */
     virtual double GetCompletionPercentage() const override;
@@ -72,7 +105,7 @@ public:
      * @param subtask_id ID-ul sub-sarcinii de eliminat
      * @return true dacă sub-sarcina a fost găsită și eliminată, false în caz contrar
      */
-    bool RemoveSubtask(const std::string& subtask_id);
+    bool RemoveSubtask(const Entity_Id& subtask_id);
     
     /**
      * Obține toate sub-sarcinile
@@ -80,12 +113,44 @@ public:
      */
     const std::vector<Task*>& GetSubtasks() const;
     
+    /**
+     * Setează modul de stocare al sub-sarcinilor
+     * Modul INDEXED face căutarea și eliminarea după ID O(1) în medie
+     * @param mode Noul mod de stocare
+     */
+    void SetStorageMode(Task_Collection::Storage_Mode mode);
+    
     /**
      * Obține numărul de sub-sarcini
      * @return Numărul de sub-sarcini
      */
     size_t GetSubtaskCount() const;
     
+    /**
+     * Obține numărul de sub-sarcini directe finalizate
+     * @return Numărul de sub-sarcini finalizate (din cache, O(1))
+     */
+    size_t GetCompletedSubtaskCount() const;
+    
+    /**
+     * Obține numărul de sarcini din subarborele proiectului (inclusiv proiectul)
+     * @return Numărul de sarcini (din cache, O(1))
+     */
+    size_t GetSubtreeTaskCount() const;
+    
+    /**
+     * Recalculează de la zero agregatele întregului subarbore (ex: după un import masiv)
+     * Cu un pool, subarborii mari sunt împărțiți între firele acestuia; subarborii
+     * cu mai puțin de serial_threshold sarcini sunt evaluați serial.
+     * Ierarhia nu trebuie modificată în timpul recalculării, iar sub-proiectele
+     * trebuie să fie accesibile doar prin acest proiect.
+     * @param pool Pool-ul de fire folosit (nullptr pentru evaluare serială)
+     * @param serial_threshold Dimensiunea minimă a unui subarbore evaluat în paralel
+     * @return Agregatele subarborelui
+     */
+    Rollup_Stats RecomputeRollup(Work_Stealing_Pool* pool = nullptr,
+                                 size_t serial_threshold = DEFAULT_SERIAL_THRESHOLD);
+    
     /**
      * Supraîncărcarea operatorului + pentru combinarea a două proiecte
      * Demonstrează conceptul de supraîncărcare a operatorilor în C++
@@ -103,7 +168,99 @@ protected:
     virtual void _WriteDetailsToStream(std::ostream& os) const override;
     
 private:
-    std::vector<Task*> m_subtasks;  // Lista de sub-sarcini ale proiectului
+    Task_Collection m_subtasks;  // Lista de sub-sarcini ale proiectului
+    
+    /**
+     * Agregatele de finalizare ale sub-sarcinilor directe
+     * Sunt actualizate incremental când o sub-sarcină își schimbă starea,
+     * astfel încât IsCompleted și GetCompletionPercentage nu mai parcurg arborele
+     */
+    double m_completion_sum;      // Suma procentelor de finalizare ale sub-sarcinilor
+    size_t m_completed_subtasks;  // Numărul de sub-sarcini finalizate
+    size_t m_subtree_task_count;  // Numărul de sarcini din subarbore, inclusiv proiectul
+    
+    /**
+     * Epoca ultimei recalculări care a scris agregatele acestui proiect
+     * Un proiect întâlnit de mai multe ori în aceeași recalculare este scris o singură dată
+     */
+    std::atomic<unsigned> m_rollup_epoch;
+    
+    /**
+     * Totalurile parțiale ale unui interval de sub-sarcini (definite în project_task.cpp)
+     */
+    struct Subtask_Totals;
+    
+    /**
+     * Task apelează metodele de mai jos când finalizarea unei sub-sarcini se schimbă
+     */
+    friend class Task;
+    
+    /**
+     * Snapshot citește și restaurează câmpurile private (inclusiv ID-ul)
+     */
+    friend class Snapshot;
+    
+    /**
+     * Leagă o sub-sarcină de acest proiect și îi adaugă contribuția la agregate
+     * @param subtask Sub-sarcina nou adăugată
+     */
+    void _AttachSubtask(Task* subtask);
+    
+    /**
+     * Actualizează agregatele după schimbarea unei sub-sarcini și propagă mai sus
+     * @param delta_percentage Diferența procentului de finalizare al sub-sarcinii
+     * @param delta_completed Diferența stării de finalizare (-1, 0 sau 1)
+     * @param delta_task_count Diferența numărului de sarcini din subarborele sub-sarcinii
+     */
+    void _OnSubtaskChanged(double delta_percentage, int delta_completed, std::ptrdiff_t delta_task_count);
+    
+    /**
+     * Elimină o sub-sarcină care este distrusă și îi scade contribuția
+     * @param subtask Sub-sarcina distrusă
+     */
+    void _OnSubtaskDestroyed(Task* subtask);
+    
+    /**
+     * Scade contribuția unei sub-sarcini deja eliminate din m_subtasks
+     * @param subtask Sub-sarcina eliminată
+     */
+    void _SubtractContribution(const Task* subtask);
+    
+    /**
+     * Elimină o apariție a acestui proiect din lista de părinți a unei sub-sarcini
+     * @param subtask Sub-sarcina
+     */
+    void _UnlinkFrom(Task* subtask);
+    
+    /**
+     * Obține numărul de sarcini din subarborele unei sub-sarcini (1 pentru sarcini simple)
+     * @param subtask Sub-sarcina
+     * @return Numărul de sarcini
+     */
+    static size_t _SubtreeTaskCountOf(const Task* subtask);
+    
+    /**
+     * Recalculează agregatele acestui proiect din sub-sarcinile sale
+     * @param pool Pool-ul de fire (nullptr pentru evaluare serială)
+     * @param serial_threshold Dimensiunea minimă a unui subarbore evaluat în paralel
+     * @param epoch Epoca recalculării curente
+     * @param update_reported Dacă se actualizează și valorile raportate părinților
+     * @return Agregatele subarborelui
+     */
+    Rollup_Stats _Recompute(Work_Stealing_Pool* pool, size_t serial_threshold,
+                            unsigned epoch, bool update_reported);
+    
+    /**
+     * Evaluează un interval de sub-sarcini, împărțindu-l între fire când este util
+     * @param subtasks Începutul intervalului
+     * @param count Numărul de sub-sarcini din interval
+     * @param pool Pool-ul de fire (nullptr pentru evaluare serială)
+     * @param serial_threshold Dimensiunea minimă a unui subarbore evaluat în paralel
+     * @param epoch Epoca recalculării curente
+     * @param totals Totalurile în care se adună rezultatele
+     */
+    static void _RecomputeRange(Task* const* subtasks, size_t count, Work_Stealing_Pool* pool,
+                                size_t serial_threshold, unsigned epoch, Subtask_Totals& totals);
 };
 
 } // namespace Task_Management
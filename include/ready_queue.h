@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "itask_observer.h"
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class Task;
+
+/**
+ * Clasa Ready_Queue - coada sarcinilor care pot fi lucrate, ordonată după importanță
+ *
+ * Răspunde la întrebarea "ce urmează?" pentru un set de sarcini, de obicei sarcinile
+ * unui utilizator (User::GetAssignedTasks) sau ale unui Task_List. Ordinea este:
+ * prioritatea (URGENT întâi), apoi termenul limită al sarcinilor Deadline_Task (cel mai
+ * apropiat întâi; sarcinile fără termen vin după cele cu termen), apoi vechimea (ordinea
+ * creării, Task::GetCreationSequence). Sarcinile COMPLETED, CANCELLED și DEFERRED rămân
+ * în coadă, dar sunt ținute deoparte și nu sunt întoarse până când statusul lor nu se
+ * schimbă.
+ *
+ * Sarcinile active formează un heap binar indexat: coada reține poziția fiecărei sarcini
+ * într-un tabel propriu (sarcina nu știe în ce cozi se află), iar cheia de ordonare este
+ * copiată în element, astfel încât comparațiile nu citesc sarcinile. Coada este un
+ * ITask_Observer: SetPriority, SetStatus și SetDeadline mută doar sarcina modificată,
+ * în O(log n), fără reordonarea întregului set.
+ *
+ * O sarcină poate face parte din oricâte cozi (ex: coada utilizatorului și coada
+ * listei); la distrugere (Task_Change::DELETED) este scoasă din toate. Metodele pot
+ * fi apelate din mai multe fire de execuție, iar coada poate fi creată și distrusă
+ * în timp ce alte fire modifică sarcini.
+ */
+class Ready_Queue : public ITask_Observer {
+public:
+    /**
+     * Constructor - înregistrează coada ca observator al sarcinilor
+     */
+    Ready_Queue();
+
+    /**
+     * Destructor - oprește observarea sarcinilor
+     */
+    ~Ready_Queue();
+
+    /**
+     * Adaugă o sarcină în coadă
+     * @param task Sarcina de adăugat
+     * @return true dacă sarcina a fost adăugată, false dacă pointerul este null sau
+     *         sarcina face deja parte din această coadă
+     */
+    bool Add(Task* task);
+
+    /**
+     * Adaugă mai multe sarcini deodată; heap-ul este reconstruit o singură dată, în O(n)
+     * @param tasks Sarcinile de adăugat (pointerii null și sarcinile aflate deja în coadă sunt ignorate)
+     * @return Numărul de sarcini adăugate
+     */
+    size_t AddTasks(const std::vector<Task*>& tasks);
+
+    /**
+     * Elimină o sarcină din coadă
+     * @param task Sarcina de eliminat
+     * @return true dacă sarcina a fost găsită și eliminată, false în caz contrar
+     */
+    bool Remove(Task* task);
+
+    /**
+     * Verifică dacă o sarcină face parte din această coadă
+     * @param task Sarcina căutată
+     * @return true dacă sarcina este în coadă
+     */
+    bool Contains(const Task* task) const;
+
+    /**
+     * Obține numărul de sarcini din coadă (active și puse deoparte)
+     * @return Numărul de sarcini
+     */
+    size_t Size() const;
+
+    /**
+     * Obține numărul de sarcini care pot fi lucrate, adică cele întoarse de Peek și Pop
+     * @return Numărul de sarcini active
+     */
+    size_t GetReadyCount() const;
+
+    /**
+     * Obține cea mai importantă sarcină care poate fi lucrată, fără a o elimina
+     * @return Sarcina sau nullptr dacă nu există nicio sarcină activă
+     */
+    Task* Peek() const;
+
+    /**
+     * Elimină din coadă și întoarce cea mai importantă sarcină care poate fi lucrată
+     * @return Sarcina sau nullptr dacă nu există nicio sarcină activă
+     */
+    Task* Pop();
+
+    /**
+     * Obține primele sarcini active, fără a le elimina
+     * Costul este O(count log count), independent de dimensiunea cozii.
+     * @param count Numărul maxim de sarcini
+     * @return Cel mult count sarcini, în ordinea importanței
+     */
+    std::vector<Task*> GetNext(size_t count) const;
+
+    /**
+     * Implementarea metodei din ITask_Observer - actualizează poziția sarcinii
+     * la schimbarea priorității, a statusului sau a termenului limită și o scoate
+     * din coadă la distrugere
+     */
+    void OnTaskChanged(const Task& task, Task_Change change, const Entity_Id& related) override;
+
+private:
+    /**
+     * Poziția unei sarcini în coadă
+     */
+    struct Slot {
+        std::uint32_t index;  // Poziția în heap (sau în lista sarcinilor inactive)
+        bool active;          // Sarcina este în heap (poate fi lucrată)
+    };
+
+    /**
+     * Elementul heap-ului: sarcina, cheia ei de ordonare și poziția ei din tabel
+     * (nodurile unordered_map nu se mută, deci pointerul rămâne valid)
+     */
+    struct Entry {
+        std::uint64_t rank;  // Prioritatea inversată (biții superiori) și ziua termenului
+        std::uint64_t age;   // Numărul de ordine al creării sarcinii
+        Task* task;          // Sarcina
+        Slot* slot;          // Poziția sarcinii, actualizată la fiecare mutare
+    };
+
+    mutable std::mutex m_mutex;                        // Protejează coada
+    std::unordered_map<const Task*, Slot> m_slots;     // Pozițiile tuturor sarcinilor din coadă
+    std::vector<Entry> m_heap;          // Sarcinile active (heap după cheie, cea mai importantă în vârf)
+    std::vector<Entry> m_inactive;      // Sarcinile finalizate, anulate sau amânate (fără ordine)
+
+    /**
+     * Așază o sarcină în heap (la final, fără reordonare) sau printre sarcinile inactive
+     * @param slot Poziția sarcinii din m_slots
+     * @return true dacă sarcina a fost pusă în heap
+     */
+    bool _Place(Task* task, Slot* slot);
+
+    /**
+     * Scoate o sarcină din heap sau dintre sarcinile inactive (fără a o elimina din m_slots)
+     */
+    void _Unplace(const Slot& slot);
+
+    /**
+     * Mută elementul de pe poziția slot spre vârf sau spre frunze, până la locul lui
+     */
+    void _SiftUp(size_t slot);
+    void _SiftDown(size_t slot);
+
+    /**
+     * Compară două elemente: true dacă a este mai important decât b
+     */
+    static bool _Before(const Entry& a, const Entry& b);
+
+    /**
+     * Pune elementul pe o poziție din heap și actualizează poziția din tabel
+     */
+    void _Store(size_t slot, const Entry& entry);
+
+    // Copierea este interzisă - coada este înregistrată ca observator
+    Ready_Queue(const Ready_Queue&) = delete;
+    Ready_Queue& operator=(const Ready_Queue&) = delete;
+};
+
+} // namespace Task_Management
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class Recurring_Task;
+
+/**
+ * Clasa Recurrence_Scheduler - declanșează aparițiile sarcinilor recurente la momentul lor
+ *
+ * Planificatorul este o roată de temporizare ierarhică (hierarchical timing wheel):
+ * LEVEL_COUNT niveluri a câte SLOT_COUNT sloturi. Un slot de pe nivelul 0 acoperă un
+ * tick, iar unul de pe nivelul L acoperă SLOT_COUNT^L tick-uri. O sarcină este pusă pe
+ * nivelul cel mai mic care îi cuprinde termenul; când roata ajunge la slotul ei de pe un
+ * nivel superior, sarcinile din slot coboară un nivel (cascadă), până ajung pe nivelul 0.
+ *
+ * Sloturile sunt liste dublu înlănțuite prin câmpuri din sarcini, deci planificarea și
+ * anularea se fac în O(1) și fără alocări, pentru oricâte sarcini.
+ *
+ * Advance procesează tick-urile scurse de la apelul anterior. După o pauză lungă, intervalele
+ * în care nivelurile inferioare sunt goale sunt sărite direct până la următoarea cascadă,
+ * deci recuperarea nu parcurge tick-urile unul câte unul. Aparițiile ratate în pauză sunt
+ * declanșate conform Missed_Policy.
+ *
+ * După declanșare, sarcina trece la apariția următoare (calculată în calendar de
+ * Recurring_Task) și este replanificată. Funcția apelată poate modifica, replanifica,
+ * anula sau distruge orice sarcină.
+ *
+ * Planificatorul nu este sigur între fire: se folosește dintr-un singur fir (ex: bucla
+ * principală a aplicației, care apelează periodic Advance).
+ */
+class Recurrence_Scheduler {
+public:
+    /**
+     * Funcția apelată pentru fiecare apariție: sarcina și momentul apariției
+     */
+    typedef std::function<void(Recurring_Task&, std::chrono::system_clock::time_point)> Callback;
+
+    /**
+     * Enumerație pentru tratarea aparițiilor ratate (ex: după o pauză a aplicației)
+     */
+    enum class Missed_Policy {
+        FIRE_ALL,     // Fiecare apariție ratată este declanșată, în ordine
+        FIRE_LATEST   // Doar ultima apariție ratată este declanșată, celelalte sunt sărite
+    };
+
+    static const int SLOT_BITS = 8;                          // Biții indexului unui slot
+    static const int SLOT_COUNT = 1 << SLOT_BITS;            // Sloturile unui nivel
+    static const int LEVEL_COUNT = 5;                        // Nivelurile roții (2^40 tick-uri)
+
+    /**
+     * Constructor
+     * @param callback Funcția apelată la fiecare apariție
+     * @param tick Durata unui tick (rezoluția planificatorului)
+     * @param policy Tratarea aparițiilor ratate
+     * @param start Momentul de la care pornește roata
+     */
+    explicit Recurrence_Scheduler(Callback callback,
+                                  std::chrono::milliseconds tick = std::chrono::seconds(1),
+                                  Missed_Policy policy = Missed_Policy::FIRE_ALL,
+                                  std::chrono::system_clock::time_point start = std::chrono::system_clock::now());
+
+    /**
+     * Destructor - scoate toate sarcinile din planificator
+     */
+    ~Recurrence_Scheduler();
+
+    /**
+     * Planifică următoarea apariție a unei sarcini
+     * @param task Sarcina de planificat
+     * @return true dacă sarcina a fost planificată, false dacă pointerul este null sau
+     *         sarcina face deja parte dintr-un planificator
+     */
+    bool Schedule(Recurring_Task* task);
+
+    /**
+     * Anulează planificarea unei sarcini
+     * @param task Sarcina de anulat
+     * @return true dacă sarcina era planificată aici, false în caz contrar
+     */
+    bool Cancel(Recurring_Task* task);
+
+    /**
+     * Declanșează toate aparițiile până la un moment dat
+     * @param now Momentul curent
+     * @return Numărul de apariții declanșate
+     */
+    size_t Advance(std::chrono::system_clock::time_point now);
+
+    /**
+     * Declanșează toate aparițiile până la momentul curent al ceasului sistemului
+     * @return Numărul de apariții declanșate
+     */
+    size_t Advance();
+
+    /**
+     * Obține numărul de sarcini planificate
+     * @return Numărul de sarcini
+     */
+    size_t Size() const;
+
+private:
+    /**
+     * Recurring_Task anunță planificatorul când următoarea apariție se schimbă
+     */
+    friend class Recurring_Task;
+
+    Callback m_callback;                                  // Funcția apelată la fiecare apariție
+    std::chrono::system_clock::duration m_tick;           // Durata unui tick
+    Missed_Policy m_policy;                               // Tratarea aparițiilor ratate
+    std::int64_t m_current_tick;                          // Următorul tick de procesat
+    Recurring_Task* m_slots[LEVEL_COUNT][SLOT_COUNT];     // Capetele listelor din sloturi
+    size_t m_level_counts[LEVEL_COUNT];                   // Numărul de sarcini de pe fiecare nivel
+    size_t m_count;                                       // Numărul de sarcini planificate
+    Recurring_Task* m_firing;                             // Sarcina a cărei apariție este declanșată acum
+
+    /**
+     * Pune sarcina în slotul corespunzător termenului ei
+     */
+    void _Insert(Recurring_Task* task);
+
+    /**
+     * Scoate sarcina din slotul în care se află
+     */
+    void _Unlink(Recurring_Task* task);
+
+    /**
+     * Mută sarcina în slotul corespunzător noii apariții (apelată de Recurring_Task)
+     */
+    void _Reschedule(Recurring_Task* task);
+
+    /**
+     * Coboară sarcinile din slotul curent al nivelurilor superioare
+     */
+    void _Cascade();
+
+    /**
+     * Declanșează aparițiile din slotul tick-ului curent de pe nivelul 0
+     */
+    size_t _FireTick(std::int64_t tick, std::chrono::system_clock::time_point now);
+
+    /**
+     * Tick-ul de la care un moment este atins (rotunjire în sus)
+     */
+    std::int64_t _ExpiryTick(std::chrono::system_clock::time_point time) const;
+
+    // Copierea este interzisă - sarcinile rețin un pointer către planificator
+    Recurrence_Scheduler(const Recurrence_Scheduler&) = delete;
+    Recurrence_Scheduler& operator=(const Recurrence_Scheduler&) = delete;
+};
+
+} // namespace Task_Management
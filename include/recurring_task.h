@@ -1,17 +1,52 @@
 #pragma once
 
 #include "task.h"
+#include <cstdint>
 #include <string>
 #include <vector>
+#include <chrono>
 #include "date.h"
 
 namespace Task_Management {
 
+// Declarații anticipate (forward declarations)
+class Recurrence_Scheduler;
+class Work_Stealing_Pool;
+
+/**
+ * Structura Occurrence_Table - aparițiile mai multor sarcini recurente, pe coloane
+ *
+ * Rândul i este apariția din ziua day_numbers[i] a sarcinii tasks[task_indexes[i]]
+ * din vectorul dat lui Recurring_Task::ExpandOccurrences. Rândurile sunt grupate pe
+ * sarcini, în ordinea sarcinilor, iar aparițiile fiecărei sarcini sunt în ordine
+ * cronologică. Vectorii sunt refolosiți între apeluri, deci un tabel folosit repetat
+ * nu mai alocă memorie odată ce a atins dimensiunea necesară.
+ */
+struct Occurrence_Table {
+    std::vector<std::uint32_t> task_indexes;  // Indexul sarcinii în vectorul de intrare
+    std::vector<int> day_numbers;             // Ziua locală a apariției (vezi Date::GetDayNumber)
+    
+    /**
+     * Obține numărul de apariții
+     * @return Numărul de rânduri
+     */
+    size_t Size() const { return day_numbers.size(); }
+};
+
 /**
  * Clasa Recurring_Task - reprezintă o sarcină care se repetă la intervale regulate
  * 
  * Această clasă moștenește din clasa abstractă Task și implementează toate funcțiile virtuale pure.
  * Demonstrează conceptul de moștenire și polimorfism în POO, precum și utilizarea tipurilor de date complexe.
+ *
+ * Aparițiile sunt calculate în calendarul local (ca Date și Today_Clock), păstrând ora
+ * locală din zi, inclusiv peste schimbările orei de vară. O apariție căzută în ora care
+ * lipsește la trecerea la ora de vară este mutată după salt (02:30 -> 03:30), iar
+ * aparițiile următoare păstrează noua oră. Pașii lunari și anuali
+ * respectă lungimea lunilor: o sarcină lunară începută pe 31 apare pe 31 sau, în lunile mai
+ * scurte, în ultima zi a lunii (ex: 31 ian, 28/29 feb, 31 mar). Ziua de referință este cea a
+ * primei apariții, deci scurtarea dintr-o lună nu se propagă în lunile următoare.
+ * Aparițiile sunt declanșate de un Recurrence_Scheduler.
  */
 class Recurring_Task : public Task {
 public:
@@ -32,7 +67,8 @@ public:
      * @param description Descrierea sarcinii
      * @param priority Prioritatea sarcinii
      * @param pattern Modelul de recurență
-     * @param interval Intervalul de recurență (ex: la fiecare 2 săptămâni)
+     * @param interval Intervalul de recurență (ex: la fiecare 2 săptămâni); valorile
+     *                 nepozitive sunt înlocuite cu 1, altfel aparițiile nu ar avansa
      */
     Recurring_Task(const std::string& title, const std::string& description, 
                   Priority priority, RecurrencePattern pattern, int interval);
@@ -104,8 +140,35 @@ public:
      */
     std::string GetNextOccurrence() const;
     
+    /**
+     * Obține momentul următoarei apariții
+     * @return Momentul următoarei apariții
+     */
+    std::chrono::system_clock::time_point GetNextOccurrenceTime() const;
+    
+    /**
+     * Generează toate aparițiile unor sarcini recurente dintr-un interval de zile
+     * Zilele sunt zile locale, ca first și last (Date) și ca Today_Clock, deci o apariție
+     * de seară este în tabel la data ei locală, nu la cea UTC.
+     * Aparițiile pornesc de la următoarea apariție a fiecărei sarcini și sunt calculate
+     * aritmetic, fără a simula pașii unul câte unul: zilele pentru modelele zilnic și
+     * săptămânal, lunile (cu ziua de referință limitată la lungimea lunii) pentru cele
+     * lunar și anual. Prima trecere numără aparițiile fiecărei sarcini, iar a doua le
+     * scrie direct la pozițiile lor din tabel; ambele rulează în paralel pe blocuri de
+     * sarcini, dacă există un pool.
+     * @param tasks Sarcinile (pointerii null sunt ignorați)
+     * @param first Prima zi din interval
+     * @param last Ultima zi din interval (inclusă)
+     * @param table Tabelul rezultat (conținutul anterior este înlocuit)
+     * @param pool Pool-ul folosit pentru calculul în paralel (nullptr pentru firul curent)
+     */
+    static void ExpandOccurrences(const std::vector<Recurring_Task*>& tasks, const Date& first, const Date& last,
+                                  Occurrence_Table& table, Work_Stealing_Pool* pool = nullptr);
+    
     /**
      * Finalizează apariția curentă și programează următoarea
+     * Următoarea apariție se calculează de la apariția curentă (nu de la momentul
+     * finalizării), deci sarcina își păstrează ritmul chiar dacă este finalizată târziu.
      */
     void CompleteCurrentOccurrence();
     
@@ -118,17 +181,94 @@ protected:
     virtual void _WriteDetailsToStream(std::ostream& os) const override;
     
 private:
+    /**
+     * Snapshot citește și restaurează câmpurile private
+     */
+    friend class Snapshot;
+    
+    /**
+     * Recurrence_Scheduler leagă sarcina direct în roata de temporizare și avansează aparițiile
+     */
+    friend class Recurrence_Scheduler;
+    
+    /**
+     * Mutation_Log restaurează aparițiile sarcinilor create după ultimul snapshot, la Replay
+     */
+    friend class Mutation_Log;
+    
     RecurrencePattern m_pattern;  // Modelul de recurență
     int m_interval;               // Intervalul de recurență
     int m_occurrences_completed;  // Numărul de apariții finalizate
+    int m_anchor_day;             // Ziua din lună a primei apariții (pentru pașii lunari și anuali)
     std::chrono::system_clock::time_point m_next_occurrence;  // Data și ora următoarei apariții
     
+    // Poziția sarcinii în Recurrence_Scheduler (gestionată doar de planificator)
+    Recurrence_Scheduler* m_scheduler;  // Planificatorul care conține sarcina (nullptr dacă nu este planificată)
+    Recurring_Task* m_timer_next;       // Următoarea sarcină din slotul roții
+    Recurring_Task** m_timer_pprev;     // Legătura care indică spre această sarcină (nullptr dacă nu este în roată)
+    std::int64_t m_timer_expiry;        // Tick-ul la care apariția trebuie declanșată
+    int m_timer_level;                  // Nivelul roții în care se află sarcina
+    
     /**
-     * Calculează următoarea apariție pe baza modelului și intervalului
+     * Calculează prima apariție, pornind de la momentul curent
      * Metodă privată, utilizată doar intern
      */
     void _CalculateNextOccurrence();
     
+    /**
+     * Setează următoarea apariție și ziua de referință a calendarului
+     * @param occurrence Momentul apariției
+     */
+    void _SetNextOccurrence(std::chrono::system_clock::time_point occurrence);
+    
+    /**
+     * Calculează apariția care urmează după un moment dat, conform modelului și intervalului
+     * @param occurrence Momentul unei apariții
+     * @return Momentul apariției următoare
+     */
+    std::chrono::system_clock::time_point _StepOccurrence(std::chrono::system_clock::time_point occurrence) const;
+    
+    /**
+     * Anunță planificatorul că următoarea apariție s-a schimbat
+     */
+    void _Reschedule();
+    
+    /**
+     * Calculează aparițiile dintr-un interval de zile
+     * Apariția n (n >= 0) este a n-a după următoarea apariție; aparițiile din interval sunt
+     * cele cu n din [first_step, last_step].
+     * @param start_day Ziua locală a următoarei apariții (vezi _StartDay)
+     * @param first_day Prima zi din interval
+     * @param last_day Ultima zi din interval
+     * @param first_step Primește indexul primei apariții din interval
+     * @param last_step Primește indexul ultimei apariții din interval
+     * @return Numărul de apariții din interval
+     */
+    size_t _OccurrenceRange(int start_day, int first_day, int last_day, std::int64_t& first_step,
+                            std::int64_t& last_step) const;
+    
+    /**
+     * Obține ziua locală a următoarei apariții
+     * Calculul datei locale (localtime_r) este scump, deci ExpandOccurrences o calculează
+     * o singură dată pentru fiecare sarcină și o transmite celorlalte metode.
+     * @return Numărul zilei (vezi Date::GetDayNumber)
+     */
+    int _StartDay() const;
+    
+    /**
+     * Obține ziua apariției cu indexul dat
+     * @param start_day Ziua locală a următoarei apariții (vezi _StartDay)
+     * @param step Indexul apariției (0 = următoarea apariție)
+     * @return Numărul zilei apariției
+     */
+    int _OccurrenceDay(int start_day, std::int64_t step) const;
+    
+    /**
+     * Obține numărul de zile dintre două apariții (modelele zilnic și săptămânal)
+     * sau numărul de luni (modelele lunar și anual)
+     */
+    int _StepLength() const;
+    
     /**
      * Convertește modelul de recurență în string
      * Metodă privată, utilizată doar intern
@@ -2,6 +2,7 @@
 
 #include "inotifier.h"
 #include <string>
+#include <vector>
 
 namespace Task_Management {
 
@@ -42,6 +43,17 @@ public:
      */
     virtual std::string GetNotificationType() const override;
     
+    /**
+     * Trimite un lot de notificări
+     * Suprascrie metoda din interfața INotifier: SMS-urile lotului sunt formatate
+     * împreună și scrise printr-o singură operație de ieșire
+     * 
+     * @param notifications Notificările de trimis
+     * @param delivered Primește, pentru fiecare notificare, rezultatul trimiterii
+     * @return Numărul de notificări trimise cu succes
+     */
+    virtual size_t SendNotifications(const std::vector<Notification>& notifications, std::vector<bool>& delivered) const override;
+    
     /**
      * Obține numărul de telefon al expeditorului
      * @return Numărul de telefon al expeditorului ca string
@@ -56,6 +68,11 @@ public:
     
 private:
     std::string m_sender_phone;  // Numărul de telefon al expeditorului
+    
+    /**
+     * Adaugă textul afișat pentru o notificare la finalul unui buffer
+     */
+    void _Format(const std::string& recipient, const std::string& subject, const std::string& message, std::string& out) const;
 };
 
 } // namespace Task_Management
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "inotifier.h"
+
+namespace Task_Management {
+
+/**
+ * Structura Smtp_Config - parametrii conexiunilor către serverul SMTP
+ */
+struct Smtp_Config {
+    std::string host;                 // Numele sau adresa serverului
+    std::uint16_t port;               // Portul serverului
+    std::string helo_name;            // Numele trimis în EHLO
+    size_t pool_size;                 // Numărul maxim de conexiuni deschise simultan
+    size_t max_messages_per_session;  // Mesajele trimise pe o conexiune înainte de redeschidere
+    int timeout_ms;                   // Timpul maxim de așteptare pentru o citire sau scriere
+
+    Smtp_Config()
+        : host("127.0.0.1"), port(25), helo_name("localhost"),
+          pool_size(4), max_messages_per_session(1000), timeout_ms(10000) {}
+};
+
+/**
+ * Clasa Smtp_Transport - client SMTP cu un pool de conexiuni persistente
+ *
+ * Conexiunile sunt deschise la prima utilizare și păstrate între trimiteri, deci
+ * conectarea TCP și dialogul inițial (salutul și EHLO) se plătesc o singură dată pentru
+ * până la max_messages_per_session mesaje. Fiecare fir care trimite ia o conexiune
+ * liberă din pool (sau așteaptă una), o folosește pentru tot lotul, apoi o eliberează.
+ *
+ * Dacă serverul anunță PIPELINING (RFC 2920), comenzile MAIL FROM, RCPT TO și DATA ale
+ * unui mesaj sunt scrise împreună, iar finalul conținutului unui mesaj este scris
+ * împreună cu comenzile mesajului următor: un mesaj costă astfel un singur drum dus-întors
+ * până la server. Fără PIPELINING, comenzile sunt trimise pe rând.
+ *
+ * O conexiune închisă de server între trimiteri este redeschisă automat. Erorile sunt
+ * raportate prin valorile returnate, pentru fiecare mesaj.
+ */
+class Smtp_Transport {
+public:
+    /**
+     * Constructor
+     * @param config Parametrii conexiunilor
+     */
+    explicit Smtp_Transport(const Smtp_Config& config);
+
+    /**
+     * Destructor - încheie sesiunile deschise (QUIT) și închide conexiunile
+     */
+    ~Smtp_Transport();
+
+    /**
+     * Trimite un lot de mesaje pe o singură conexiune din pool
+     * @param sender Adresa expeditorului
+     * @param notifications Mesajele (destinatarul este adresa de email)
+     * @param delivered Primește, pentru fiecare mesaj, dacă serverul l-a acceptat
+     * @return Numărul de mesaje acceptate
+     */
+    size_t Send(const std::string& sender, const std::vector<Notification>& notifications, std::vector<bool>& delivered);
+
+    /**
+     * Obține numărul de conexiuni TCP deschise de la crearea transportului
+     * @return Numărul de conectări
+     */
+    std::uint64_t GetConnectCount() const;
+
+private:
+    /**
+     * O conexiune din pool
+     */
+    struct Connection {
+        int fd;                   // Socket-ul (-1 dacă este închisă)
+        bool pipelining;          // Serverul a anunțat PIPELINING
+        size_t message_count;     // Mesajele trimise în sesiunea curentă
+        std::string input;        // Octeții citiți și încă neprelucrați
+
+        Connection() : fd(-1), pipelining(false), message_count(0) {}
+    };
+
+    Smtp_Config m_config;                                  // Parametrii conexiunilor
+    std::vector<std::unique_ptr<Connection>> m_connections; // Toate conexiunile pool-ului
+    std::vector<Connection*> m_idle;                       // Conexiunile libere
+    mutable std::mutex m_mutex;                            // Protejează m_idle și contorul
+    std::condition_variable m_released;                    // Semnalează o conexiune eliberată
+    std::uint64_t m_connect_count;                         // Conectările efectuate
+
+    Connection* _Acquire();
+    void _Release(Connection* connection);
+
+    /**
+     * Deschide conexiunea TCP și parcurge salutul și EHLO
+     * @return true dacă sesiunea este pregătită pentru mesaje
+     */
+    bool _Open(Connection& connection);
+
+    /**
+     * Încheie sesiunea (QUIT, dacă este cerut) și închide socket-ul
+     */
+    void _Close(Connection& connection, bool quit);
+
+    /**
+     * Trimite mesajele [first, notifications.size()) pe o conexiune deschisă
+     * @param next Primește indexul primului mesaj netratat
+     * @return false dacă conexiunea a căzut (mesajele de la next nu au fost trimise)
+     */
+    bool _SendSession(Connection& connection, const std::string& sender, const std::vector<Notification>& notifications,
+                      size_t first, std::vector<bool>& delivered, size_t& next);
+
+    /**
+     * Adaugă comenzile MAIL FROM, RCPT TO și DATA ale unui mesaj
+     */
+    static void _AppendEnvelope(const std::string& sender, const std::string& recipient, std::string& out);
+
+    /**
+     * Adaugă antetele și conținutul unui mesaj, cu dublarea punctelor de la începutul
+     * rândurilor și terminatorul "."
+     */
+    static void _AppendContent(const std::string& sender, const Notification& notification, std::string& out);
+
+    /**
+     * Scrie toți octeții unui text
+     * @return false la eroare
+     */
+    bool _Write(Connection& connection, const std::string& data);
+
+    /**
+     * Citește un răspuns complet (eventual pe mai multe rânduri)
+     * @param code Primește codul răspunsului
+     * @param text Dacă nu este nullptr, primește rândurile răspunsului
+     * @return false la eroare sau dacă răspunsul este invalid
+     */
+    bool _ReadReply(Connection& connection, int& code, std::string* text = nullptr);
+
+    // Copierea este interzisă - transportul deține socket-urile
+    Smtp_Transport(const Smtp_Transport&) = delete;
+    Smtp_Transport& operator=(const Smtp_Transport&) = delete;
+};
+
+} // namespace Task_Management
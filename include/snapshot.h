@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class Task;
+class User;
+class Category;
+class Task_List;
+class Task_Notes;
+class Task_Factory;
+
+/**
+ * Structura Task_Graph - mulțimea de obiecte salvate sau încărcate dintr-un snapshot
+ *
+ * Vectorii nu dețin obiectele (agregare). După Snapshot::Load, obiectele create
+ * trebuie eliberate de apelant: cu delete, iar sarcinile create printr-un
+ * Task_Factory prin fabrica respectivă.
+ */
+struct Task_Graph {
+    std::vector<User*> users;            // Utilizatorii (inclusiv Team_Leader)
+    std::vector<Category*> categories;   // Categoriile
+    std::vector<Task*> tasks;            // Sarcinile de orice tip
+    std::vector<Task_List*> task_lists;  // Listele de sarcini
+    std::vector<Task_Notes*> notes;      // Notele atașate sarcinilor
+};
+
+/**
+ * Clasa Snapshot - salvarea și restaurarea întregului graf de obiecte într-un fișier binar
+ *
+ * Formatul (versiunea FORMAT_VERSION), în little-endian:
+ * - antet: MAGIC (8 octeți), versiunea (4 octeți), numărul de obiecte din fiecare secțiune
+ * - secțiunile, în ordine: utilizatori, categorii, sarcini, liste, legături, note
+ * - un octet END_MARKER, urmat de suma de control (8 octeți) a tuturor octeților anteriori
+ *
+ * Numerele întregi sunt codificate ca varint (7 biți pe octet), iar cele cu semn în
+ * zig-zag. ID-ul fiecărui obiect este scris ca diferență față de obiectul anterior din
+ * aceeași secțiune, deci ID-urile consecutive ocupă un singur octet. Pointerii sunt
+ * scriși ca numărul din ID-ul obiectului referit (0 pentru nullptr); tipul lor rezultă
+ * din câmp. Relațiile care pot referi obiecte de mai târziu (sub-sarcini, membrii
+ * echipei, sarcinile utilizatorilor și ale categoriilor) sunt scrise în secțiunea
+ * de legături, după toate obiectele.
+ *
+ * Notificatorul listelor (INotifier) nu este salvat, fiind un obiect al aplicației.
+ *
+ * Versiunea 2 adaugă ziua de referință a sarcinilor recurente (Recurring_Task); la
+ * citirea versiunii 1, aceasta este ziua următoarei apariții.
+ * Versiunea 3 adaugă, la sfârșitul fiecărei sarcini, numărul de ordine al creării
+ * (Task::GetCreationSequence); la citirea versiunilor mai vechi, sarcinile sunt
+ * numerotate în ordinea din fișier.
+ */
+class Snapshot {
+public:
+    /**
+     * Identificatorul de la începutul fiecărui fișier snapshot
+     */
+    static const char MAGIC[8];
+
+    /**
+     * Versiunea curentă a formatului
+     * Load acceptă orice versiune mai mică sau egală
+     */
+    static const std::uint32_t FORMAT_VERSION = 3;
+
+    /**
+     * Octetul care marchează sfârșitul datelor, înaintea sumei de control
+     */
+    static const std::uint8_t END_MARKER = 0xE5;
+
+    /**
+     * Tipul unei sarcini în fișier
+     */
+    enum class Task_Type : std::uint8_t {
+        SIMPLE = 0,     // Simple_Task
+        PROJECT = 1,    // Project_Task
+        RECURRING = 2,  // Recurring_Task
+        DEADLINE = 3    // Deadline_Task
+    };
+
+    /**
+     * Tipul unui utilizator în fișier
+     */
+    enum class User_Type : std::uint8_t {
+        USER = 0,         // User
+        TEAM_LEADER = 1   // Team_Leader
+    };
+
+    /**
+     * Salvează graful într-un fișier
+     * Graful trebuie să fie închis: orice obiect referit (utilizator atribuit, categorie,
+     * sub-sarcină etc.) trebuie să se afle și el în graf, iar ID-urile să fie unice.
+     * Salvarea este atomică și durabilă: graful este scris în path + ".tmp", sincronizat
+     * pe disc (fsync), redenumit peste path, apoi este sincronizat și directorul. La o
+     * eroare sau la o cădere, path conține în continuare snapshot-ul anterior, iar un
+     * Snapshot_View deschis pe el rămâne valid.
+     * @param path Calea fișierului
+     * @param graph Obiectele de salvat
+     * @return true dacă snapshot-ul a fost scris și sincronizat, false la eroare
+     *         (fișierul temporar este șters, path rămâne neschimbat)
+     */
+    static bool Save(const std::string& path, const Task_Graph& graph);
+
+    /**
+     * Încarcă un graf dintr-un fișier, păstrând ID-urile salvate
+     * După încărcare, generatorul de ID-uri continuă după cele mai mari ID-uri încărcate.
+     * La eroare, obiectele create parțial sunt distruse și graph rămâne neschimbat.
+     * @param path Calea fișierului
+     * @param graph Graful în care se adaugă obiectele încărcate
+     * @param factory Fabrica folosită pentru sarcini (nullptr pentru new)
+     * @return true dacă încărcarea a reușit, false dacă fișierul lipsește sau este corupt
+     */
+    static bool Load(const std::string& path, Task_Graph& graph, Task_Factory* factory = nullptr);
+
+    /**
+     * Suma de control folosită de format, calculată incremental
+     * Procesează 32 de octeți pe pas, în patru fluxuri independente
+     */
+    class Checksum {
+    public:
+        Checksum();
+
+        /**
+         * Adaugă octeți la suma de control
+         * @param data Octeții
+         * @param size Numărul de octeți
+         */
+        void Update(const char* data, size_t size);
+
+        /**
+         * Obține suma de control a tuturor octeților adăugați
+         * @return Valoarea sumei de control
+         */
+        std::uint64_t Finish() const;
+
+    private:
+        std::uint64_t m_lanes[4];   // Fluxurile de procesare
+        unsigned char m_pending[32]; // Octeții care nu completează încă un bloc
+        size_t m_pending_size;      // Numărul de octeți din m_pending
+        std::uint64_t m_total;      // Numărul total de octeți adăugați
+
+        void _ProcessBlock(const unsigned char* block);
+    };
+
+private:
+    class Graph_Writer;  // Scrierea grafului (definită în snapshot.cpp)
+    class Graph_Reader;  // Citirea grafului (definită în snapshot.cpp)
+
+    // Clasa are doar metode statice
+    Snapshot() = delete;
+};
+
+} // namespace Task_Management
@@ -0,0 +1,350 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "entity_id.h"
+#include "snapshot.h"
+#include "task.h"
+#include "date.h"
+#include "text_matcher.h"
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class Snapshot_View;
+class User_View;
+class Category_View;
+
+/**
+ * Structura String_View - referință către un șir de caractere din fișierul mapat
+ * Nu deține memoria și rămâne validă cât timp Snapshot_View este deschis
+ */
+struct String_View {
+    const char* data;  // Primul caracter (nu este terminat cu '\0')
+    size_t size;       // Numărul de caractere
+
+    String_View() : data(nullptr), size(0) {}
+    String_View(const char* data, size_t size) : data(data), size(size) {}
+
+    /**
+     * Copiază textul într-un std::string
+     * @return Textul copiat
+     */
+    std::string ToString() const { return std::string(data, size); }
+
+    /**
+     * Verifică dacă textul conține un anumit cuvânt cheie
+     * @param keyword Cuvântul cheie de căutat
+     * @param ignore_case true pentru a nu face diferențe între literele mari și mici ASCII
+     * @return true dacă textul conține cuvântul cheie, false în caz contrar
+     */
+    bool Contains(const std::string& keyword, bool ignore_case = false) const;
+
+    /**
+     * Verifică dacă textul conține cuvântul cheie al unui Text_Matcher deja pregătit
+     * @param matcher Cuvântul cheie pregătit
+     * @return true dacă textul conține cuvântul cheie, false în caz contrar
+     */
+    bool Contains(const Text_Matcher& matcher) const { return matcher.Matches(data, size); }
+
+    bool operator==(const std::string& other) const;
+    bool operator!=(const std::string& other) const { return !(*this == other); }
+};
+
+std::ostream& operator<<(std::ostream& os, const String_View& text);
+
+/**
+ * Clasa Task_View - sarcină citită direct din fișierul mapat
+ * Câmpurile sunt decodificate la fiecare apel, fără copiere; textele sunt String_View
+ */
+class Task_View {
+public:
+    Task_View() : m_view(nullptr), m_index(0) {}
+    Task_View(const Snapshot_View* view, size_t index) : m_view(view), m_index(index) {}
+
+    /**
+     * Verifică dacă vederea indică o sarcină (false pentru referințe nule)
+     * @return true dacă sarcina există, false în caz contrar
+     */
+    bool IsValid() const { return m_view != nullptr; }
+
+    /**
+     * Obține poziția sarcinii în snapshot
+     * @return Indexul sarcinii
+     */
+    size_t GetIndex() const { return m_index; }
+
+    Entity_Id GetId() const;
+    Snapshot::Task_Type GetType() const;
+    std::string GetTaskType() const;  // "Simple Task", "Project Task" etc., ca Task::GetTaskType
+    String_View GetTitle() const;
+    String_View GetDescription() const;
+    Priority GetPriority() const;
+    TaskStatus GetStatus() const;
+
+    /**
+     * Obține utilizatorul atribuit
+     * @return Vederea utilizatorului (invalidă dacă sarcina nu este atribuită)
+     */
+    User_View GetAssignedUser() const;
+
+    /**
+     * Obține categoriile sarcinii
+     * @return Vederile categoriilor
+     */
+    std::vector<Category_View> GetCategories() const;
+
+    /**
+     * Obține sub-sarcinile (doar pentru proiecte)
+     * @return Vederile sub-sarcinilor (gol pentru alte tipuri)
+     */
+    std::vector<Task_View> GetSubtasks() const;
+
+    /**
+     * Obține data limită (doar pentru Deadline_Task)
+     * @return Data limită sau Date() pentru alte tipuri
+     */
+    Date GetDeadline() const;
+
+private:
+    const Snapshot_View* m_view;
+    size_t m_index;
+};
+
+/**
+ * Clasa User_View - utilizator citit direct din fișierul mapat
+ */
+class User_View {
+public:
+    User_View() : m_view(nullptr), m_index(0) {}
+    User_View(const Snapshot_View* view, size_t index) : m_view(view), m_index(index) {}
+
+    bool IsValid() const { return m_view != nullptr; }
+    size_t GetIndex() const { return m_index; }
+
+    Entity_Id GetId() const;
+    String_View GetName() const;
+    String_View GetEmail() const;
+
+    /**
+     * Verifică dacă utilizatorul este un Team_Leader
+     * @return true pentru lideri de echipă, false în caz contrar
+     */
+    bool IsTeamLeader() const;
+
+    /**
+     * Obține departamentul (doar pentru Team_Leader)
+     * @return Departamentul sau un text gol
+     */
+    String_View GetDepartment() const;
+
+    std::vector<Task_View> GetAssignedTasks() const;
+
+    /**
+     * Obține membrii echipei (doar pentru Team_Leader)
+     * @return Vederile membrilor
+     */
+    std::vector<User_View> GetTeamMembers() const;
+
+private:
+    const Snapshot_View* m_view;
+    size_t m_index;
+};
+
+/**
+ * Clasa Category_View - categorie citită direct din fișierul mapat
+ */
+class Category_View {
+public:
+    Category_View() : m_view(nullptr), m_index(0) {}
+    Category_View(const Snapshot_View* view, size_t index) : m_view(view), m_index(index) {}
+
+    bool IsValid() const { return m_view != nullptr; }
+    size_t GetIndex() const { return m_index; }
+
+    Entity_Id GetId() const;
+    String_View GetName() const;
+    String_View GetDescription() const;
+    std::vector<Task_View> GetTasks() const;
+    size_t GetTaskCount() const;
+
+private:
+    const Snapshot_View* m_view;
+    size_t m_index;
+};
+
+/**
+ * Clasa Task_List_View - listă de sarcini citită direct din fișierul mapat
+ */
+class Task_List_View {
+public:
+    Task_List_View() : m_view(nullptr), m_index(0) {}
+    Task_List_View(const Snapshot_View* view, size_t index) : m_view(view), m_index(index) {}
+
+    bool IsValid() const { return m_view != nullptr; }
+    size_t GetIndex() const { return m_index; }
+
+    Entity_Id GetId() const;
+    String_View GetName() const;
+    std::vector<Task_View> GetTasks() const;
+    size_t GetTaskCount() const;
+
+private:
+    const Snapshot_View* m_view;
+    size_t m_index;
+};
+
+/**
+ * Structura Note_View - o notă citită direct din fișierul mapat (oglinda lui Note)
+ */
+struct Note_View {
+    String_View text;           // Textul notei
+    String_View author;         // Autorul notei
+    String_View creation_date;  // Data creării notei
+    bool is_important;          // Indicator dacă nota este importantă
+
+    Note_View() : is_important(false) {}
+};
+
+/**
+ * Clasa Task_Notes_View - notele unei sarcini, citite direct din fișierul mapat
+ */
+class Task_Notes_View {
+public:
+    Task_Notes_View() : m_view(nullptr), m_index(0) {}
+    Task_Notes_View(const Snapshot_View* view, size_t index) : m_view(view), m_index(index) {}
+
+    bool IsValid() const { return m_view != nullptr; }
+
+    Task_View GetTask() const;
+    std::vector<Note_View> GetNotes() const;
+
+    /**
+     * Caută note care conțin un anumit cuvânt cheie
+     * @param keyword Cuvântul cheie de căutat
+     * @param ignore_case true pentru a nu face diferențe între literele mari și mici ASCII
+     * @return Notele care conțin cuvântul cheie
+     */
+    std::vector<Note_View> SearchNotes(const std::string& keyword, bool ignore_case = false) const;
+
+private:
+    const Snapshot_View* m_view;
+    size_t m_index;
+};
+
+/**
+ * Clasa Snapshot_View - acces doar pentru citire la un fișier snapshot, fără încărcare
+ *
+ * Fișierul este mapat în memorie (mmap), iar la deschidere este parcurs o singură dată
+ * pentru a reține poziția fiecărui obiect; nu se creează obiecte Task, User etc. și
+ * nu se copiază niciun text. Interogările folosesc clase de vedere (Task_View,
+ * User_View, ...) care oglindesc metodele de citire ale claselor originale.
+ *
+ * Folosește API-ul POSIX (mmap); vederile devin invalide după Close().
+ */
+class Snapshot_View {
+public:
+    Snapshot_View();
+    ~Snapshot_View();
+
+    /**
+     * Deschide și indexează un fișier snapshot
+     * @param path Calea fișierului
+     * @param verify_checksum Dacă se verifică și suma de control (parcurge tot fișierul)
+     * @return true dacă fișierul a fost deschis, false dacă lipsește sau este corupt
+     */
+    bool Open(const std::string& path, bool verify_checksum = false);
+
+    /**
+     * Închide fișierul și eliberează maparea
+     */
+    void Close();
+
+    bool IsOpen() const;
+
+    size_t GetUserCount() const;
+    size_t GetCategoryCount() const;
+    size_t GetTaskCount() const;
+    size_t GetTaskListCount() const;
+    size_t GetTaskNotesCount() const;
+
+    User_View GetUser(size_t index) const;
+    Category_View GetCategory(size_t index) const;
+    Task_View GetTask(size_t index) const;
+    Task_List_View GetTaskList(size_t index) const;
+    Task_Notes_View GetTaskNotes(size_t index) const;
+
+    /**
+     * Caută obiecte după ID, în O(1)
+     * @return Vederea găsită sau o vedere invalidă
+     */
+    User_View FindUser(const Entity_Id& id) const;
+    Category_View FindCategory(const Entity_Id& id) const;
+    Task_View FindTask(const Entity_Id& id) const;
+    Task_List_View FindTaskList(const Entity_Id& id) const;
+
+private:
+    friend class Task_View;
+    friend class User_View;
+    friend class Category_View;
+    friend class Task_List_View;
+    friend class Task_Notes_View;
+
+    /**
+     * Poziția unui obiect în fișier și numărul din ID-ul lui
+     */
+    struct Record {
+        std::uint64_t offset;
+        std::uint64_t number;
+    };
+
+    /**
+     * Tabelă număr de ID -> index, cu vector direct pentru ID-uri aproape consecutive
+     */
+    class Id_Index {
+    public:
+        void Build(const std::vector<Record>& records);
+        size_t Find(std::uint64_t number) const;  // NOT_FOUND dacă lipsește
+        void Clear();
+
+    private:
+        std::vector<std::uint32_t> m_dense;
+        std::unordered_map<std::uint64_t, size_t> m_sparse;
+    };
+
+    static const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    const unsigned char* m_data;  // Începutul mapării
+    size_t m_size;                // Dimensiunea fișierului
+
+    std::vector<Record> m_users;
+    std::vector<Record> m_categories;
+    std::vector<Record> m_tasks;
+    std::vector<Record> m_task_lists;
+    std::vector<std::uint64_t> m_task_notes;      // Poziția fiecărui Task_Notes
+
+    std::vector<std::uint64_t> m_user_links;      // Sarcinile atribuite (urmate de echipă)
+    std::vector<std::uint64_t> m_category_links;  // Sarcinile fiecărei categorii
+    std::vector<std::uint64_t> m_task_links;      // Sub-sarcinile (0 pentru non-proiecte)
+
+    Id_Index m_user_index;
+    Id_Index m_category_index;
+    Id_Index m_task_index;
+    Id_Index m_task_list_index;
+
+    bool _Index();
+    std::vector<Task_View> _TasksAt(std::uint64_t offset) const;
+    std::vector<User_View> _UsersAt(std::uint64_t offset) const;
+
+    // Copierea este interzisă - vederea deține maparea
+    Snapshot_View(const Snapshot_View&) = delete;
+    Snapshot_View& operator=(const Snapshot_View&) = delete;
+};
+
+} // namespace Task_Management
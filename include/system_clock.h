@@ -0,0 +1,31 @@
+#pragma once
+
+#include "iclock.h"
+
+namespace Task_Management {
+
+/**
+ * Clasa System_Clock - ceasul sistemului, cu data în fusul orar local
+ *
+ * Data locală este calculată cu localtime_r, care este sigur între fire.
+ */
+class System_Clock : public IClock {
+public:
+    /**
+     * Obține ceasul sistemului (instanță partajată, fără stare)
+     * @return Referință către instanța unică
+     */
+    static System_Clock& GetInstance();
+
+    /**
+     * Implementarea metodei din IClock - timpul sistemului
+     */
+    virtual std::int64_t GetTime() const override;
+
+    /**
+     * Implementarea metodei din IClock - ziua în fusul orar local
+     */
+    virtual int GetLocalDay(std::int64_t time, std::int64_t& next_day) const override;
+};
+
+} // namespace Task_Management
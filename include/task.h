@@ -1,6 +1,15 @@
 #pragma once
 
 #include <string>
+#include <vector>
+#include <iosfwd>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+#include "entity_id.h"
+#include "itask_observer.h"
 
 namespace Task_Management {
 
@@ -33,6 +42,8 @@ enum class TaskStatus {
 class Date;
 class User;
 class Category;
+class Project_Task;
+class Text_Matcher;
 
 /**
  * Clasa abstractă de bază pentru toate sarcinile din sistem
@@ -58,18 +69,27 @@ public:
      */
     Task(const Task& other);
     
+    /**
+     * Operatorul de atribuire este interzis (și în clasele derivate)
+     * O sarcină are identitate proprie (ID, legături către proiectele părinte, poziții
+     * în cozi și indexuri), care nu poate fi suprascrisă prin copiere. Conținutul se
+     * copiază prin setteri (SetTitle, SetStatus etc.), care anunță observatorii.
+     */
+    Task& operator=(const Task& other) = delete;
+    
     /**
      * Destructor virtual
      * Virtual pentru a permite curățarea corectă a resurselor în clasele derivate
      * Când un obiect este șters prin pointer la clasa de bază, se apelează destructorul corect
+     * Sarcina se elimină automat din proiectele părinte în care era sub-sarcină
      */
     virtual ~Task();
     
     /**
      * Obține titlul sarcinii
-     * @return Titlul sarcinii ca string
+     * @return Referință la titlul sarcinii (validă până la următorul SetTitle)
      */
-    std::string GetTitle() const;
+    const std::string& GetTitle() const;
     
     /**
      * Setează titlul sarcinii
@@ -79,9 +99,9 @@ public:
     
     /**
      * Obține descrierea sarcinii
-     * @return Descrierea sarcinii ca string
+     * @return Referință la descrierea sarcinii (validă până la următorul SetDescription)
      */
-    std::string GetDescription() const;
+    const std::string& GetDescription() const;
     
     /**
      * Setează descrierea sarcinii
@@ -89,11 +109,27 @@ public:
      */
     void SetDescription(const std::string& description);
     
+    /**
+     * Verifică dacă titlul sau descrierea conțin cuvântul cheie (fără a le copia)
+     * @param matcher Cuvântul cheie pregătit
+     * @return true dacă titlul sau descrierea conțin cuvântul cheie
+     */
+    bool ContainsText(const Text_Matcher& matcher) const;
+    
     /**
      * Obține ID-ul unic al sarcinii
-     * @return ID-ul sarcinii ca string
+     * @return ID-ul sarcinii (forma text se obține cu ToString())
      */
-    std::string GetId() const;
+    Entity_Id GetId() const;
+    
+    /**
+     * Obține numărul de ordine al creării sarcinii
+     * Numerele cresc în ordinea creării, inclusiv între fire (spre deosebire de ID-uri,
+     * alocate în blocuri pe fiecare fir) și sunt păstrate de Snapshot și Mutation_Log.
+     * O copie are numărul originalului.
+     * @return Numărul de ordine (mai mic = creată mai devreme)
+     */
+    std::uint64_t GetCreationSequence() const;
     
     /**
      * Obține prioritatea sarcinii
@@ -143,6 +179,23 @@ public:
      */
     const std::vector<Category*>& GetCategories() const;
     
+    /**
+     * Înregistrează un observator pentru modificările tuturor sarcinilor
+     * Poate fi apelată în paralel cu modificările sarcinilor din alte fire; o
+     * modificare aflată în curs poate să nu fie anunțată noului observator
+     * @param observer Observatorul de adăugat
+     */
+    static void AddObserver(ITask_Observer* observer);
+    
+    /**
+     * Elimină un observator înregistrat
+     * Poate fi apelată în paralel cu modificările sarcinilor din alte fire: așteaptă
+     * terminarea notificărilor în curs, deci după revenire observatorul nu mai este
+     * apelat și poate fi distrus. Nu trebuie apelată din OnTaskChanged.
+     * @param observer Observatorul de eliminat
+     */
+    static void RemoveObserver(ITask_Observer* observer);
+    
     /**
      * Funcție virtuală pură pentru afișarea detaliilor sarcinii
      * Trebuie implementată de toate clasele derivate
@@ -175,6 +228,26 @@ public:
      */
     friend std::ostream& operator<<(std::ostream& os, const Task& task);
     
+    /**
+     * Project_Task întreține legăturile către proiectele părinte ale sub-sarcinilor sale
+     */
+    friend class Project_Task;
+    
+    /**
+     * Snapshot citește și restaurează câmpurile private (inclusiv ID-ul)
+     */
+    friend class Snapshot;
+    
+    /**
+     * Task_Importer setează starea și legăturile sarcinilor noi fără a notifica observatorii
+     */
+    friend class Task_Importer;
+    
+    /**
+     * Mutation_Log restaurează ID-ul sarcinilor create după ultimul snapshot, la Replay
+     */
+    friend class Mutation_Log;
+    
 protected:
     /**
      * Metodă protejată pentru clasele derivate pentru a adăuga detalii specifice la stream
@@ -183,27 +256,62 @@ protected:
      */
     virtual void _WriteDetailsToStream(std::ostream& os) const;
     
+    /**
+     * Anunță proiectele părinte că finalizarea acestei sarcini s-a schimbat
+     * Fiecare părinte își actualizează agregatele în O(1), apoi propagă mai departe,
+     * deci costul total este O(adâncime). Nu face nimic dacă sarcina nu are părinți
+     * sau dacă procentul, starea de finalizare și dimensiunea nu s-au schimbat.
+     * @param delta_task_count Diferența numărului de sarcini din subarborele acestei sarcini
+     */
+    void _NotifyParentProjects(std::ptrdiff_t delta_task_count = 0);
+    
+    /**
+     * Elimină sarcina din toate proiectele părinte
+     * Apelată din destructori, deci folosește doar valorile deja raportate
+     */
+    void _DetachFromParentProjects();
+    
+    /**
+     * Anunță observatorii înregistrați că sarcina s-a modificat
+     * @param change Tipul modificării
+     * @param related ID-ul obiectului implicat (opțional)
+     */
+    void _NotifyObservers(Task_Change change, const Entity_Id& related = Entity_Id()) const;
+    
 private:
     std::string m_title;        // Titlul sarcinii
     std::string m_description;  // Descrierea sarcinii
-    std::string m_id;           // ID-ul unic al sarcinii
+    Entity_Id m_id;             // ID-ul unic al sarcinii
     Priority m_priority;        // Prioritatea sarcinii
     TaskStatus m_status;        // Statusul sarcinii
     User* m_assigned_user;      // Utilizatorul atribuit sarcinii
     std::vector<Category*> m_categories;  // Categoriile atribuite sarcinii
+    std::vector<Project_Task*> m_parent_projects;  // Proiectele în care sarcina este sub-sarcină
+    double m_reported_percentage;  // Ultimul procent de finalizare raportat părinților
+    bool m_reported_completed;     // Ultima stare de finalizare raportată părinților
+    bool m_is_copy;                // Copie (același ID): crearea nu este anunțată, nici jurnalizată
+    std::uint64_t m_creation_sequence;  // Numărul de ordine al creării
     
-    /**
-     * Contor static pentru generarea ID-urilor unice
-     * Static înseamnă că este partajat între toate instanțele clasei
-     */
-    static int s_id_counter;
+    struct Observer_List;  // Lista observatorilor și numărul notificărilor care o folosesc (definită în task.cpp)
+    
+    static std::mutex s_observers_mutex;  // Protejează înlocuirea listei de observatori
+    static std::shared_ptr<Observer_List> s_observers;  // Observatorii tuturor sarcinilor (copiată la modificare)
+    static std::atomic<std::size_t> s_observer_count;  // Dimensiunea listei, pentru cazul fără observatori
+    static std::atomic<std::uint64_t> s_creation_counter;  // Ultimul număr de ordine al creării
     
     /**
      * Generează un ID unic pentru sarcină
      * Metodă privată, utilizată doar intern
-     * @return ID-ul generat ca string
+     * @return ID-ul generat
+     */
+    Entity_Id _GenerateId();
+    
+    /**
+     * Continuă numerotarea creărilor după un număr restaurat (Snapshot, Mutation_Log),
+     * pentru ca sarcinile create ulterior să fie ordonate după cele restaurate
+     * @param sequence Numărul restaurat; numerotarea nu scade niciodată
      */
-    std::string _GenerateId();
+    static void _ResumeCreationSequence(std::uint64_t sequence);
 };
 
 } // namespace Task_Management
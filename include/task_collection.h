@@ -0,0 +1,157 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "entity_id.h"
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class Task;
+
+/**
+ * Clasa Task_Collection - colecție de pointeri la sarcini cu index opțional după ID
+ *
+ * Sarcinile sunt păstrate într-un vector contiguu, deci parcurgerea prin GetTasks()
+ * este la fel de rapidă ca pentru un std::vector<Task*> simplu.
+ *
+ * Colecția are două moduri de stocare:
+ * - ORDERED: păstrează ordinea de inserare; căutarea și eliminarea sunt liniare
+ * - INDEXED: menține o tabelă hash ID -> poziție; căutarea și eliminarea sunt O(1)
+ *   în medie, iar eliminarea mută ultimul element în locul celui eliminat
+ *   (ordinea nu mai este garantată după eliminări)
+ *
+ * Agregare: colecția referențiază sarcinile, dar nu este responsabilă de ciclul lor de viață.
+ */
+class Task_Collection {
+public:
+    /**
+     * Enumerație pentru modul de stocare al colecției
+     */
+    enum class Storage_Mode {
+        ORDERED,  // Ordinea de inserare, operații liniare
+        INDEXED   // Index hash după ID, operații O(1) în medie
+    };
+
+    /**
+     * Constructor cu modul de stocare
+     * @param mode Modul de stocare inițial (implicit ORDERED)
+     */
+    explicit Task_Collection(Storage_Mode mode = Storage_Mode::ORDERED);
+
+    /**
+     * Obține modul de stocare curent
+     * @return Modul de stocare
+     */
+    Storage_Mode GetStorageMode() const;
+
+    /**
+     * Schimbă modul de stocare
+     * Trecerea în modul INDEXED construiește indexul într-o singură parcurgere
+     * @param mode Noul mod de stocare
+     */
+    void SetStorageMode(Storage_Mode mode);
+
+    /**
+     * Adaugă o sarcină la colecție dacă pointerul nu este null
+     * @param task Pointer către sarcina de adăugat
+     */
+    void Add(Task* task);
+
+    /**
+     * Adaugă mai multe sarcini odată, în ordine; pointerii null sunt ignorați
+     * Memoria vectorului (și a indexului, în modul INDEXED) este rezervată o singură dată
+     * @param tasks Începutul intervalului de sarcini
+     * @param count Numărul de sarcini din interval
+     */
+    void AddRange(Task* const* tasks, size_t count);
+
+    /**
+     * Rezervă spațiu pentru un număr total de sarcini
+     * @param count Numărul total de sarcini estimat
+     */
+    void Reserve(size_t count);
+
+    /**
+     * Elimină prima sarcină cu ID-ul specificat
+     * @param task_id ID-ul sarcinii de eliminat
+     * @return true dacă sarcina a fost găsită și eliminată, false în caz contrar
+     */
+    bool Remove(const Entity_Id& task_id);
+
+    /**
+     * Elimină prima sarcină cu ID-ul specificat și o returnează
+     * @param task_id ID-ul sarcinii de eliminat
+     * @return Pointer către sarcina eliminată sau nullptr dacă nu există
+     */
+    Task* Extract(const Entity_Id& task_id);
+
+    /**
+     * Elimină o apariție a exact acestui obiect (nu a unei copii cu același ID)
+     * @param task Pointer către sarcina de eliminat
+     * @return true dacă sarcina a fost găsită și eliminată, false în caz contrar
+     */
+    bool Remove(Task* task);
+
+    /**
+     * Caută o sarcină după ID
+     * @param task_id ID-ul sarcinii
+     * @return Pointer către sarcină sau nullptr dacă nu există
+     */
+    Task* Find(const Entity_Id& task_id) const;
+
+    /**
+     * Obține toate sarcinile din colecție
+     * @return Vector cu pointeri către toate sarcinile
+     */
+    const std::vector<Task*>& GetTasks() const;
+
+    /**
+     * Obține numărul de sarcini din colecție
+     * @return Numărul de sarcini
+     */
+    size_t Size() const;
+
+    /**
+     * Verifică dacă colecția este goală
+     * @return true dacă nu există sarcini, false în caz contrar
+     */
+    bool IsEmpty() const;
+
+    /**
+     * Golește colecția
+     */
+    void Clear();
+
+private:
+    std::vector<Task*> m_tasks;                            // Sarcinile, stocate contiguu
+    std::unordered_multimap<Entity_Id, size_t, Entity_Id_Hash> m_index;  // ID -> poziție (doar în modul INDEXED)
+    Storage_Mode m_mode;                                   // Modul de stocare curent
+
+    /**
+     * Reconstruiește indexul din vectorul de sarcini
+     */
+    void _RebuildIndex();
+
+    /**
+     * Elimină elementul indicat de o intrare din index (modul INDEXED)
+     * Ultimul element este mutat în locul celui eliminat
+     * @param entry Intrarea din index a elementului de eliminat
+     */
+    void _EraseIndexed(std::unordered_multimap<Entity_Id, size_t, Entity_Id_Hash>::iterator entry);
+
+    /**
+     * Caută intrarea din index care indică o anumită poziție
+     * @param task_id ID-ul sarcinii de la poziția respectivă
+     * @param position Poziția căutată
+     * @return Iteratorul intrării sau m_index.end() dacă nu există
+     */
+    std::unordered_multimap<Entity_Id, size_t, Entity_Id_Hash>::iterator _FindIndexEntry(const Entity_Id& task_id,
+                                                                                         size_t position);
+};
+
+} // namespace Task_Management
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "entity_id.h"
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class Task;
+class Task_List;
+class Category;
+class User;
+
+/**
+ * Clasa Task_Exporter - exportul sarcinilor în format CSV sau JSON Lines
+ *
+ * Fiecare sarcină devine un rând, cu coloanele: source (lista, categoria sau utilizatorul
+ * exportat), id, type, title, description, priority, status, completion, assigned_user,
+ * categories. În CSV, categoriile sunt separate prin ';' și primul rând este antetul;
+ * în JSON Lines fiecare rând este un obiect, iar categoriile un vector.
+ *
+ * Rândurile sunt formatate direct într-un buffer de BUFFER_SIZE octeți, refolosit pe tot
+ * parcursul exportului, și scrise cu write() într-un descriptor de fișier când bufferul
+ * se umple. Memoria folosită nu depinde de numărul de sarcini, iar formatarea nu
+ * alocă memorie pentru fiecare sarcină.
+ */
+class Task_Exporter {
+public:
+    /**
+     * Enumerație pentru formatul exportului
+     */
+    enum class Format {
+        CSV,         // Valori separate prin virgulă, cu antet (RFC 4180)
+        JSON_LINES   // Un obiect JSON pe fiecare rând
+    };
+
+    /**
+     * Dimensiunea bufferului de scriere
+     */
+    static const size_t BUFFER_SIZE = 1 << 20;
+
+    /**
+     * Constructor cu destinația și formatul
+     * @param fd Descriptorul de fișier în care se scrie (nu este închis de exportator)
+     * @param format Formatul exportului
+     */
+    Task_Exporter(int fd, Format format);
+
+    /**
+     * Destructor - scrie datele rămase în buffer
+     */
+    ~Task_Exporter();
+
+    /**
+     * Exportă sarcinile unei liste
+     * @param task_list Lista de exportat
+     * @return true dacă scrierea a reușit, false la eroare
+     */
+    bool Export(const Task_List& task_list);
+
+    /**
+     * Exportă sarcinile unei categorii
+     * @param category Categoria de exportat
+     * @return true dacă scrierea a reușit, false la eroare
+     */
+    bool Export(const Category& category);
+
+    /**
+     * Exportă sarcinile atribuite unui utilizator
+     * @param user Utilizatorul de exportat
+     * @return true dacă scrierea a reușit, false la eroare
+     */
+    bool Export(const User& user);
+
+    /**
+     * Exportă un set oarecare de sarcini
+     * @param tasks Sarcinile de exportat
+     * @param source ID-ul scris în coloana source (poate fi invalid)
+     * @return true dacă scrierea a reușit, false la eroare
+     */
+    bool ExportTasks(const std::vector<Task*>& tasks, const Entity_Id& source = Entity_Id());
+
+    /**
+     * Scrie datele din buffer în descriptorul de fișier
+     * @return true dacă scrierea a reușit, false la eroare
+     */
+    bool Flush();
+
+    /**
+     * Verifică dacă o scriere a eșuat; după un eșec, exportul nu mai scrie nimic
+     * @return true dacă a apărut o eroare de scriere
+     */
+    bool HasFailed() const;
+
+    /**
+     * Obține numărul de sarcini exportate
+     * @return Numărul de rânduri de date scrise
+     */
+    std::uint64_t GetRowCount() const;
+
+private:
+    int m_fd;                      // Destinația
+    Format m_format;               // Formatul exportului
+    std::vector<char> m_buffer;    // Bufferul de scriere, refolosit
+    size_t m_used;                 // Octeții ocupați din buffer
+    bool m_header_written;         // Antetul CSV a fost scris
+    bool m_failed;                 // O scriere a eșuat
+    std::uint64_t m_row_count;     // Numărul de rânduri de date scrise
+
+    void _WriteRow(const Task& task, const Entity_Id& source);
+    void _WriteCsvRow(const Task& task, const Entity_Id& source);
+    void _WriteJsonRow(const Task& task, const Entity_Id& source);
+
+    /**
+     * Garantează cel puțin size octeți liberi în buffer (golindu-l dacă este nevoie)
+     */
+    void _Reserve(size_t size);
+
+    void _Append(const char* data, size_t size);
+    void _AppendId(const Entity_Id& id);
+    void _AppendPercentage(double value);
+    void _AppendCsvField(const std::string& text);
+    void _AppendJsonString(const char* data, size_t size);
+
+    // Copierea este interzisă - exportatorul deține bufferul
+    Task_Exporter(const Task_Exporter&) = delete;
+    Task_Exporter& operator=(const Task_Exporter&) = delete;
+};
+
+} // namespace Task_Management
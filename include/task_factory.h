@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include "object_pool.h"
+#include "simple_task.h"
+#include "project_task.h"
+#include "recurring_task.h"
+#include "deadline_task.h"
+
+namespace Task_Management {
+
+/**
+ * Clasa Task_Factory - creează sarcini în pool-uri separate pentru fiecare tip
+ *
+ * Înlocuiește alocarea individuală cu new/delete (ca în main.cpp) la crearea
+ * a milioane de sarcini: sarcinile de același tip sunt plasate una lângă alta
+ * în memorie (vezi Object_Pool), iar ReleaseAll le distruge pe toate odată.
+ *
+ * Spre deosebire de Category și Task_List, fabrica deține sarcinile create:
+ * acestea se distrug doar prin Destroy sau ReleaseAll, niciodată cu delete.
+ * Create și Destroy pot fi apelate din mai multe fire de execuție.
+ *
+ * Exemplu:
+ *     Task_Factory factory;
+ *     Simple_Task* task = factory.Create<Simple_Task>("Raport", "Q2", Priority::HIGH);
+ */
+class Task_Factory {
+public:
+    /**
+     * Constructor implicit - pool-urile sunt goale la început
+     */
+    Task_Factory();
+
+    /**
+     * Destructor - distruge toate sarcinile încă existente
+     */
+    ~Task_Factory();
+
+    /**
+     * Creează o sarcină de tipul T
+     * T poate fi Simple_Task, Project_Task, Recurring_Task sau Deadline_Task
+     * @param args Argumentele constructorului lui T
+     * @return Pointer către sarcina creată
+     */
+    template <typename T, typename... Args>
+    T* Create(Args&&... args) {
+        return _Pool<T>().Create(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Rezervă spațiu pentru un număr de sarcini de tipul T
+     * @param count Numărul estimat de sarcini
+     */
+    template <typename T>
+    void Reserve(size_t count) {
+        _Pool<T>().Reserve(count);
+    }
+
+    /**
+     * Distruge o sarcină creată de această fabrică
+     * @param task Sarcina de distrus (ignorată dacă este nullptr)
+     * @return true dacă sarcina a fost distrusă, false dacă tipul ei nu aparține fabricii
+     */
+    bool Destroy(Task* task);
+
+    /**
+     * Distruge toate sarcinile create; memoria este păstrată pentru sarcinile viitoare
+     * Nu trebuie apelată în paralel cu Create sau Destroy
+     */
+    void ReleaseAll();
+
+    /**
+     * Obține numărul de sarcini existente create de fabrică
+     * @return Numărul de sarcini
+     */
+    size_t GetLiveCount() const;
+
+private:
+    Object_Pool<Simple_Task> m_simple_tasks;        // Pool-ul sarcinilor simple
+    Object_Pool<Project_Task> m_project_tasks;      // Pool-ul proiectelor
+    Object_Pool<Recurring_Task> m_recurring_tasks;  // Pool-ul sarcinilor recurente
+    Object_Pool<Deadline_Task> m_deadline_tasks;    // Pool-ul sarcinilor cu termen limită
+
+    /**
+     * Obține pool-ul pentru tipul T (specializat mai jos pentru fiecare tip de sarcină)
+     * @return Referință către pool
+     */
+    template <typename T>
+    Object_Pool<T>& _Pool();
+
+    // Copierea este interzisă - fabrica deține sarcinile
+    Task_Factory(const Task_Factory&) = delete;
+    Task_Factory& operator=(const Task_Factory&) = delete;
+};
+
+template <>
+inline Object_Pool<Simple_Task>& Task_Factory::_Pool<Simple_Task>() {
+    return m_simple_tasks;
+}
+
+template <>
+inline Object_Pool<Project_Task>& Task_Factory::_Pool<Project_Task>() {
+    return m_project_tasks;
+}
+
+template <>
+inline Object_Pool<Recurring_Task>& Task_Factory::_Pool<Recurring_Task>() {
+    return m_recurring_tasks;
+}
+
+template <>
+inline Object_Pool<Deadline_Task>& Task_Factory::_Pool<Deadline_Task>() {
+    return m_deadline_tasks;
+}
+
+} // namespace Task_Management
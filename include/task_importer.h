@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class Task;
+class User;
+class Category;
+class Task_List;
+class Task_Factory;
+class Work_Stealing_Pool;
+
+/**
+ * Structura Import_Error - un rând care nu a putut fi importat
+ */
+struct Import_Error {
+    size_t line;          // Numărul liniei din fișier (de la 1)
+    std::string message;  // Descrierea erorii
+};
+
+/**
+ * Structura Import_Result - obiectele create la import și erorile întâlnite
+ *
+ * Vectorii nu dețin obiectele (agregare): sarcinile create printr-un Task_Factory se
+ * eliberează prin fabrică, iar celelalte obiecte cu delete, de către apelant.
+ */
+struct Import_Result {
+    std::vector<Task*> tasks;                   // Sarcinile create, în ordinea rândurilor
+    std::vector<User*> created_users;           // Utilizatorii noi (responsabili negăsiți)
+    std::vector<Category*> created_categories;  // Categoriile noi
+    std::vector<Import_Error> errors;           // Rândurile respinse, în ordinea liniilor
+    size_t row_count;                           // Numărul de rânduri de date citite
+
+    Import_Result() : row_count(0) {}
+};
+
+/**
+ * Clasa Task_Importer - importul sarcinilor dintr-un fișier CSV într-un Task_List
+ *
+ * Primul rând este antetul; coloanele sunt recunoscute după nume (fără diferențe între
+ * litere mari și mici), iar cele necunoscute sunt ignorate:
+ * - title (obligatorie), description
+ * - type: "Simple Task" / "simple" sau "Deadline Task" / "deadline"; implicit, un rând
+ *   cu deadline devine Deadline_Task
+ * - priority (LOW, MEDIUM, HIGH, URGENT; implicit MEDIUM)
+ * - status (NOT_STARTED, IN_PROGRESS, COMPLETED, DEFERRED, CANCELLED; implicit NOT_STARTED)
+ * - deadline: data în forma AAAA-LL-ZZ
+ * - assignee: numele utilizatorului responsabil
+ * - categories: numele categoriilor, separate prin ';'
+ *
+ * Fișierul este mapat în memorie (mmap) și împărțit în bucăți de aproximativ
+ * CHUNK_SIZE octeți, la granițe de rând. Ghilimelele pot conține linii noi, deci
+ * granițele se găsesc cu aceeași mașină de stări ca a cititorului de rânduri: fiecare
+ * bucată este parcursă în paralel din toate stările posibile, iar stările reale de la
+ * începutul bucăților se obțin apoi prin înlănțuire. Bucățile
+ * sunt analizate în paralel (Work_Stealing_Pool), fiecare creând direct sarcinile
+ * rândurilor ei și reținând numele distincte de utilizatori și categorii. Numele sunt
+ * apoi unificate într-un singur fir, iar utilizatorii și categoriile lipsă sunt create
+ * o singură dată. Legăturile sarcinilor sunt setate din nou în paralel, pe bucăți, iar
+ * colecțiile utilizatorilor și categoriilor primesc sarcinile în bloc.
+ *
+ * Rândurile invalide nu opresc importul: sunt raportate în Import_Result::errors.
+ * O ghilimea în interiorul unui câmp fără ghilimele (ex: 5" screen) face rândul invalid,
+ * iar rândul se termină la următorul '\n'.
+ *
+ * Importul ocolește observatorii sarcinilor (ITask_Observer): starea, utilizatorul și
+ * categoriile sunt setate direct, ca la încărcarea unui Snapshot, deci un Mutation_Log
+ * înregistrează doar crearea sarcinilor importate (titlu, descriere, prioritate), nu și
+ * restul stării lor. Pentru a păstra sarcinile importate complet, importul trebuie
+ * urmat de Snapshot::Save și Mutation_Log::Reset.
+ */
+class Task_Importer {
+public:
+    /**
+     * Dimensiunea aproximativă a unei bucăți analizate de o singură lucrare
+     */
+    static const size_t CHUNK_SIZE = 1 << 20;
+
+    /**
+     * Constructor
+     * @param factory Fabrica folosită pentru sarcini (nullptr pentru new)
+     * @param pool Pool-ul folosit pentru analiza în paralel (nullptr pentru firul curent)
+     */
+    explicit Task_Importer(Task_Factory* factory = nullptr, Work_Stealing_Pool* pool = nullptr);
+
+    /**
+     * Adaugă un utilizator existent, folosit când numele lui apare în coloana assignee
+     * @param user Utilizatorul existent
+     */
+    void AddKnownUser(User* user);
+
+    /**
+     * Adaugă o categorie existentă, folosită când numele ei apare în coloana categories
+     * @param category Categoria existentă
+     */
+    void AddKnownCategory(Category* category);
+
+    /**
+     * Importă un fișier CSV
+     * Utilizatorii și categoriile create sunt reținute și refolosite la importurile următoare.
+     * @param path Calea fișierului
+     * @param task_list Lista în care se adaugă sarcinile
+     * @param result Obiectele create și erorile
+     * @return true dacă fișierul a fost citit, false dacă lipsește sau antetul este invalid
+     */
+    bool ImportFile(const std::string& path, Task_List& task_list, Import_Result& result);
+
+    /**
+     * Importă date CSV aflate deja în memorie
+     * @param data Începutul datelor
+     * @param size Dimensiunea datelor
+     * @param task_list Lista în care se adaugă sarcinile
+     * @param result Obiectele create și erorile
+     * @return true dacă datele au fost citite, false dacă antetul este invalid
+     */
+    bool ImportBuffer(const char* data, size_t size, Task_List& task_list, Import_Result& result);
+
+private:
+    struct Columns;       // Pozițiile coloanelor recunoscute (definită în task_importer.cpp)
+    struct Chunk_Result;  // Rezultatul analizei unei bucăți (definită în task_importer.cpp)
+
+    Task_Factory* m_factory;                                    // Fabrica de sarcini (opțională)
+    Work_Stealing_Pool* m_pool;                                 // Pool-ul de fire (opțional)
+    std::unordered_map<std::string, User*> m_users;             // Utilizatorii după nume
+    std::unordered_map<std::string, Category*> m_categories;    // Categoriile după nume
+
+    void _ParseChunk(const char* begin, const char* end, const Columns& columns, Chunk_Result& chunk);
+    Task* _CreateTask(const std::vector<std::string>& fields, const Columns& columns, std::string& error);
+};
+
+} // namespace Task_Management
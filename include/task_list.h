@@ -2,6 +2,8 @@
 
 #include <string>
 #include <vector>
+#include "entity_id.h"
+#include "task_collection.h"
 
 namespace Task_Management {
 
@@ -51,9 +53,9 @@ public:
     
     /**
      * Obține ID-ul unic al listei de sarcini
-     * @return ID-ul listei ca string
+     * @return ID-ul listei (forma text se obține cu ToString())
      */
-    std::string GetId() const;
+    Entity_Id GetId() const;
     
     /**
      * Adaugă o sarcină la listă
@@ -61,12 +63,26 @@ public:
      */
     void AddTask(Task* task);
     
+    /**
+     * Adaugă mai multe sarcini odată (ex: la importul unui proiect)
+     * Spațiul este rezervat o singură dată; pointerii null sunt ignorați
+     * @param tasks Începutul intervalului de sarcini
+     * @param count Numărul de sarcini din interval
+     */
+    void AddTasks(Task* const* tasks, size_t count);
+    
+    /**
+     * Adaugă toate sarcinile dintr-un vector
+     * @param tasks Sarcinile de adăugat
+     */
+    void AddTasks(const std::vector<Task*>& tasks);
+    
     /**
      * Elimină o sarcină din listă
      * @param task_id ID-ul sarcinii de eliminat
      * @return true dacă sarcina a fost găsită și eliminată, false în caz contrar
      */
-    bool RemoveTask(const std::string& task_id);
+    bool RemoveTask(const Entity_Id& task_id);
     
     /**
      * Obține toate sarcinile din listă
@@ -74,6 +90,21 @@ public:
      */
     const std::vector<Task*>& GetTasks() const;
     
+    /**
+     * Caută sarcinile al căror titlu sau descriere conțin un cuvânt cheie
+     * @param keyword Cuvântul cheie de căutat
+     * @param ignore_case true pentru a nu face diferențe între literele mari și mici ASCII
+     * @return Sarcinile găsite, în ordinea din listă
+     */
+    std::vector<Task*> SearchTasks(const std::string& keyword, bool ignore_case = false) const;
+    
+    /**
+     * Setează modul de stocare al sarcinilor
+     * Modul INDEXED face căutarea și eliminarea după ID O(1) în medie
+     * @param mode Noul mod de stocare
+     */
+    void SetStorageMode(Task_Collection::Storage_Mode mode);
+    
     /**
      * Obține numărul de sarcini din listă
      * @return Numărul de sarcini
@@ -126,23 +157,22 @@ public:
      */
     friend std::ostream& operator<<(std::ostream& os, const Task_List& task_list);
     
+    /**
+     * Snapshot citește și restaurează câmpurile private (inclusiv ID-ul)
+     */
+    friend class Snapshot;
+    
 private:
     std::string m_name;           // Numele listei de sarcini
-    std::string m_id;             // ID-ul unic al listei
-    std::vector<Task*> m_tasks;   // Sarcinile din listă
+    Entity_Id m_id;               // ID-ul unic al listei
+    Task_Collection m_tasks;      // Sarcinile din listă
     INotifier* m_notifier;        // Notificatorul pentru această listă
     
-    /**
-     * Contor static pentru generarea ID-urilor unice
-     * Static înseamnă că este partajat între toate instanțele clasei
-     */
-    static int s_id_counter;
-    
     /**
      * Generează un ID unic pentru lista de sarcini
-     * @return ID-ul generat ca string
+     * @return ID-ul generat
      */
-    std::string _GenerateId();
+    Entity_Id _GenerateId();
 };
 
 } // namespace Task_Management
@@ -0,0 +1,285 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+#include <functional>
+#include "entity_id.h"
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class Task;
+class User;
+class Category;
+class Task_List;
+
+/**
+ * Clasa Task_Manager - registrul central al sarcinilor, utilizatorilor,
+ * categoriilor și listelor de sarcini
+ *
+ * Această clasă demonstrează design pattern-ul Singleton: există o singură instanță
+ * în tot programul, obținută prin GetInstance().
+ *
+ * Registrul este împărțit în SHARD_COUNT fragmente (shard-uri) după ID, fiecare cu
+ * propriul mutex, astfel încât mai multe fire de execuție pot adăuga și căuta intrări
+ * simultan fără un lacăt global. Căutarea după ID se face în timp constant (tabelă hash).
+ *
+ * Registrul nu deține obiectele înregistrate - ciclul lor de viață rămâne
+ * responsabilitatea apelantului (agregare, ca în Category și Task_List).
+ * Un obiect trebuie scos din registru (Remove* sau Clear) înainte de a fi distrus;
+ * altfel registrul păstrează un pointer invalid, întors de Get* și ForEachTask.
+ */
+class Task_Manager {
+public:
+    /**
+     * Numărul de fragmente ale fiecărui registru (putere a lui 2)
+     */
+    static const size_t SHARD_COUNT = 64;
+
+    /**
+     * Obține instanța unică a managerului (Singleton)
+     * Inițializarea este thread-safe începând cu C++11
+     * @return Referință către instanța unică
+     */
+    static Task_Manager& GetInstance();
+
+    /**
+     * Înregistrează o sarcină
+     * @param task Pointer către sarcina de înregistrat
+     * @return true dacă sarcina a fost înregistrată, false dacă pointerul este null
+     *         sau există deja o sarcină cu același ID
+     */
+    bool AddTask(Task* task);
+
+    /**
+     * Elimină o sarcină din registru (obiectul nu este șters)
+     * Trebuie apelată înainte de distrugerea obiectului
+     * @param task_id ID-ul sarcinii de eliminat
+     * @return true dacă sarcina a fost găsită și eliminată, false în caz contrar
+     */
+    bool RemoveTask(const Entity_Id& task_id);
+
+    /**
+     * Caută o sarcină după ID
+     * @param task_id ID-ul sarcinii
+     * @return Pointer către sarcină sau nullptr dacă nu există
+     */
+    Task* GetTask(const Entity_Id& task_id) const;
+
+    /**
+     * Obține numărul de sarcini înregistrate
+     * @return Numărul de sarcini
+     */
+    size_t GetTaskCount() const;
+
+    /**
+     * Înregistrează un utilizator
+     * @param user Pointer către utilizatorul de înregistrat
+     * @return true dacă utilizatorul a fost înregistrat, false în caz contrar
+     */
+    bool AddUser(User* user);
+
+    /**
+     * Elimină un utilizator din registru (obiectul nu este șters)
+     * Trebuie apelată înainte de distrugerea obiectului
+     * @param user_id ID-ul utilizatorului de eliminat
+     * @return true dacă utilizatorul a fost găsit și eliminat, false în caz contrar
+     */
+    bool RemoveUser(const Entity_Id& user_id);
+
+    /**
+     * Caută un utilizator după ID
+     * @param user_id ID-ul utilizatorului
+     * @return Pointer către utilizator sau nullptr dacă nu există
+     */
+    User* GetUser(const Entity_Id& user_id) const;
+
+    /**
+     * Obține numărul de utilizatori înregistrați
+     * @return Numărul de utilizatori
+     */
+    size_t GetUserCount() const;
+
+    /**
+     * Înregistrează o categorie
+     * @param category Pointer către categoria de înregistrat
+     * @return true dacă categoria a fost înregistrată, false în caz contrar
+     */
+    bool AddCategory(Category* category);
+
+    /**
+     * Elimină o categorie din registru (obiectul nu este șters)
+     * Trebuie apelată înainte de distrugerea obiectului
+     * @param category_id ID-ul categoriei de eliminat
+     * @return true dacă categoria a fost găsită și eliminată, false în caz contrar
+     */
+    bool RemoveCategory(const Entity_Id& category_id);
+
+    /**
+     * Caută o categorie după ID
+     * @param category_id ID-ul categoriei
+     * @return Pointer către categorie sau nullptr dacă nu există
+     */
+    Category* GetCategory(const Entity_Id& category_id) const;
+
+    /**
+     * Obține numărul de categorii înregistrate
+     * @return Numărul de categorii
+     */
+    size_t GetCategoryCount() const;
+
+    /**
+     * Înregistrează o listă de sarcini
+     * @param task_list Pointer către lista de înregistrat
+     * @return true dacă lista a fost înregistrată, false în caz contrar
+     */
+    bool AddTaskList(Task_List* task_list);
+
+    /**
+     * Elimină o listă de sarcini din registru (obiectul nu este șters)
+     * Trebuie apelată înainte de distrugerea obiectului
+     * @param list_id ID-ul listei de eliminat
+     * @return true dacă lista a fost găsită și eliminată, false în caz contrar
+     */
+    bool RemoveTaskList(const Entity_Id& list_id);
+
+    /**
+     * Caută o listă de sarcini după ID
+     * @param list_id ID-ul listei
+     * @return Pointer către listă sau nullptr dacă nu există
+     */
+    Task_List* GetTaskList(const Entity_Id& list_id) const;
+
+    /**
+     * Obține numărul de liste de sarcini înregistrate
+     * @return Numărul de liste
+     */
+    size_t GetTaskListCount() const;
+
+    /**
+     * Rezervă spațiu pentru un număr estimat de sarcini
+     * Evită rehash-urile repetate la încărcarea a zeci de milioane de sarcini
+     * @param task_count Numărul estimat de sarcini
+     */
+    void ReserveTasks(size_t task_count);
+
+    /**
+     * Parcurge toate sarcinile înregistrate
+     * Fiecare fragment este blocat doar pe durata parcurgerii lui;
+     * funcția primită nu trebuie să modifice registrul
+     * @param visitor Funcția apelată pentru fiecare sarcină
+     */
+    void ForEachTask(const std::function<void(Task*)>& visitor) const;
+
+    /**
+     * Golește toate registrele (obiectele nu sunt șterse)
+     * Permite apoi distrugerea tuturor obiectelor înregistrate
+     */
+    void Clear();
+
+private:
+    /**
+     * Un fragment al registrului - o tabelă hash protejată de propriul mutex
+     * Aliniat la o linie de cache pentru a evita false sharing între fragmente
+     */
+    template <typename T>
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;                    // Protejează tabela fragmentului
+        std::unordered_map<Entity_Id, T*, Entity_Id_Hash> entries; // ID -> obiect
+    };
+
+    /**
+     * Registru fragmentat după ID pentru un tip de entitate
+     */
+    template <typename T>
+    class Sharded_Registry {
+    public:
+        bool Add(const Entity_Id& id, T* entry) {
+            Shard<T>& shard = _ShardFor(id);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            return shard.entries.emplace(id, entry).second;
+        }
+
+        bool Remove(const Entity_Id& id) {
+            Shard<T>& shard = _ShardFor(id);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            return shard.entries.erase(id) > 0;
+        }
+
+        T* Get(const Entity_Id& id) const {
+            const Shard<T>& shard = _ShardFor(id);
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.entries.find(id);
+            return it != shard.entries.end() ? it->second : nullptr;
+        }
+
+        size_t Size() const {
+            size_t total = 0;
+            for (size_t i = 0; i < SHARD_COUNT; ++i) {
+                std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+                total += m_shards[i].entries.size();
+            }
+            return total;
+        }
+
+        void Reserve(size_t count) {
+            for (size_t i = 0; i < SHARD_COUNT; ++i) {
+                std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+                m_shards[i].entries.reserve(count / SHARD_COUNT + 1);
+            }
+        }
+
+        void ForEach(const std::function<void(T*)>& visitor) const {
+            for (size_t i = 0; i < SHARD_COUNT; ++i) {
+                std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+                for (const auto& entry : m_shards[i].entries) {
+                    visitor(entry.second);
+                }
+            }
+        }
+
+        void Clear() {
+            for (size_t i = 0; i < SHARD_COUNT; ++i) {
+                std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+                m_shards[i].entries.clear();
+            }
+        }
+
+    private:
+        Shard<T> m_shards[SHARD_COUNT];
+
+        Shard<T>& _ShardFor(const Entity_Id& id) {
+            return m_shards[Entity_Id_Hash()(id) & (SHARD_COUNT - 1)];
+        }
+
+        const Shard<T>& _ShardFor(const Entity_Id& id) const {
+            return m_shards[Entity_Id_Hash()(id) & (SHARD_COUNT - 1)];
+        }
+    };
+
+    Sharded_Registry<Task> m_tasks;           // Registrul sarcinilor
+    Sharded_Registry<User> m_users;           // Registrul utilizatorilor
+    Sharded_Registry<Category> m_categories;  // Registrul categoriilor
+    Sharded_Registry<Task_List> m_task_lists; // Registrul listelor de sarcini
+
+    /**
+     * Constructor privat - instanța se obține doar prin GetInstance()
+     */
+    Task_Manager();
+
+    /**
+     * Destructor privat
+     */
+    ~Task_Manager();
+
+    // Copierea și atribuirea sunt interzise pentru un Singleton
+    Task_Manager(const Task_Manager&) = delete;
+    Task_Manager& operator=(const Task_Manager&) = delete;
+};
+
+} // namespace Task_Management
@@ -2,6 +2,9 @@
 
 #include "task.h"
 #include "note.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace Task_Management {
@@ -11,6 +14,12 @@ namespace Task_Management {
  * 
  * Această clasă demonstrează utilizarea struct-urilor împreună cu clasele
  * și implementează funcționalitatea de adăugare și gestionare a notelor pentru sarcini.
+ * 
+ * Opțional (EnableIndex), notele sunt indexate după cuvinte: un index inversat reține,
+ * pentru fiecare cuvânt, lista crescătoare a pozițiilor notelor care îl conțin. Un cuvânt
+ * este o secvență de litere și cifre (octeții UTF-8 din afara ASCII sunt considerați
+ * litere), comparat fără diferențe între literele mari și mici ASCII. AddNote actualizează
+ * indexul pe loc, iar FindNotes răspunde din liste, fără a parcurge sau copia notele.
  */
 class Task_Notes {
 public:
@@ -61,9 +70,42 @@ public:
     /**
      * Caută note care conțin un anumit cuvânt cheie
      * @param keyword Cuvântul cheie de căutat
+     * @param ignore_case true pentru a nu face diferențe între literele mari și mici ASCII
      * @return Vector cu notele care conțin cuvântul cheie
      */
-    std::vector<Note> SearchNotes(const std::string& keyword) const;
+    std::vector<Note> SearchNotes(const std::string& keyword, bool ignore_case = false) const;
+    
+    /**
+     * Caută notele care conțin un cuvânt (sau toate cuvintele unui text)
+     * Spre deosebire de SearchNotes, caută cuvinte întregi, nu subșiruri, și întoarce
+     * pozițiile notelor în GetNotes(). Folosește indexul dacă este activat.
+     * @param keyword Cuvântul căutat
+     * @return Pozițiile notelor, în ordine crescătoare
+     */
+    std::vector<size_t> FindNotes(const std::string& keyword) const;
+    
+    /**
+     * Caută notele care conțin toate cuvintele date (interogare AND)
+     * @param keywords Cuvintele căutate
+     * @return Pozițiile notelor, în ordine crescătoare
+     */
+    std::vector<size_t> FindNotes(const std::vector<std::string>& keywords) const;
+    
+    /**
+     * Activează indexul de cuvinte, construindu-l din notele existente
+     */
+    void EnableIndex();
+    
+    /**
+     * Dezactivează indexul de cuvinte și eliberează memoria lui
+     */
+    void DisableIndex();
+    
+    /**
+     * Verifică dacă indexul de cuvinte este activat
+     * @return true dacă indexul este activat
+     */
+    bool IsIndexed() const;
     
     /**
      * Afișează toate notele
@@ -85,6 +127,15 @@ public:
 private:
     Task* m_task;               // Sarcina asociată cu aceste note
     std::vector<Note> m_notes;  // Colecția de note
+    
+    bool m_indexed;             // Indexul de cuvinte este activat
+    std::unordered_map<std::string, std::vector<std::uint32_t>> m_index;  // Cuvânt -> pozițiile notelor
+    
+    /**
+     * Adaugă în index cuvintele unei note
+     * @param position Poziția notei în m_notes
+     */
+    void _IndexNote(size_t position);
 };
 
 } // namespace Task_Management
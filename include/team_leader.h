@@ -57,7 +57,7 @@ public:
      * @param member_id ID-ul membrului de eliminat
      * @return true dacă membrul a fost găsit și eliminat, false în caz contrar
      */
-    bool RemoveTeamMember(const std::string& member_id);
+    bool RemoveTeamMember(const Entity_Id& member_id);
     
     /**
      * Obține toți membrii echipei
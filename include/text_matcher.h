@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace Task_Management {
+
+/**
+ * Clasa Text_Matcher - căutarea rapidă a unui cuvânt cheie în texte
+ *
+ * Cuvântul cheie este pregătit o singură dată, la construire, apoi poate fi căutat în
+ * oricâte texte (note, titluri, descrieri). Căutarea compară blocuri de 16 sau 32 de
+ * octeți deodată (SSE2, respectiv AVX2, ales la rulare după procesor, cu o variantă
+ * scalară pentru celelalte platforme): în fiecare bloc sunt păstrate doar pozițiile unde
+ * atât primul, cât și ultimul octet al cuvântului se potrivesc, iar doar acestea sunt
+ * verificate complet. Textele obișnuite au puține astfel de poziții, deci majoritatea
+ * octeților sunt respinși fără comparații individuale.
+ *
+ * Opțional, literele ASCII sunt comparate fără diferențe între mari și mici; ceilalți
+ * octeți (inclusiv cei UTF-8) sunt comparați exact.
+ */
+class Text_Matcher {
+public:
+    /**
+     * Valoarea întoarsă de Find când cuvântul nu apare în text
+     */
+    static const size_t NOT_FOUND = static_cast<size_t>(-1);
+
+    /**
+     * Constructor
+     * @param keyword Cuvântul cheie căutat
+     * @param ignore_case true pentru comparații fără diferențe între literele mari și mici ASCII
+     */
+    explicit Text_Matcher(const std::string& keyword, bool ignore_case = false);
+
+    /**
+     * Caută prima apariție a cuvântului cheie
+     * @param text Începutul textului
+     * @param size Lungimea textului
+     * @return Poziția primei apariții sau NOT_FOUND
+     */
+    size_t Find(const char* text, size_t size) const;
+
+    /**
+     * Verifică dacă un text conține cuvântul cheie (un cuvânt gol apare în orice text)
+     * @param text Începutul textului
+     * @param size Lungimea textului
+     * @return true dacă textul conține cuvântul cheie
+     */
+    bool Matches(const char* text, size_t size) const { return Find(text, size) != NOT_FOUND; }
+
+    /**
+     * Verifică dacă un text conține cuvântul cheie
+     * @param text Textul
+     * @return true dacă textul conține cuvântul cheie
+     */
+    bool Matches(const std::string& text) const { return Matches(text.data(), text.size()); }
+
+    /**
+     * Obține cuvântul cheie (cu litere mici, dacă nu se fac diferențe între ele)
+     * @return Cuvântul cheie
+     */
+    const std::string& GetKeyword() const { return m_keyword; }
+
+    /**
+     * Verifică dacă se fac diferențe între literele mari și mici
+     * @return true dacă literele ASCII sunt comparate fără diferențe
+     */
+    bool IgnoresCase() const { return m_ignore_case; }
+
+    /**
+     * Obține numele variantei de căutare alese pentru procesorul curent
+     * @return "avx2", "sse2" sau "scalar"
+     */
+    static const char* GetImplementationName();
+
+private:
+    std::string m_keyword;      // Cuvântul cheie (cu litere mici dacă m_ignore_case)
+    bool m_ignore_case;         // Literele ASCII sunt comparate fără diferențe
+    unsigned char m_first_fold; // 0x20 dacă primul octet este o literă comparată fără diferențe, altfel 0
+    unsigned char m_last_fold;  // La fel, pentru ultimul octet
+};
+
+} // namespace Task_Management
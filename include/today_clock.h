@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace Task_Management {
+
+/**
+ * Forward declarations
+ * Acestea permit referirea la clase înainte de a fi definite complet
+ */
+class IClock;
+struct Date;
+
+/**
+ * Clasa Today_Clock - data locală curentă, partajată de tot procesul (Singleton)
+ *
+ * Calculul datei locale (localtime) este scump, așa că rezultatul este păstrat
+ * împreună cu intervalul de timp în care rămâne valabil: până la miezul nopții
+ * următoare, dar cel mult TICK_SECONDS. Citirile obișnuite cer doar timpul curent
+ * de la ceas și verifică intervalul; data este recalculată cel mult o dată pe tick,
+ * de un singur fir.
+ *
+ * Valoarea păstrată este protejată de un seqlock: cititorii nu iau niciun lacăt și
+ * repetă citirea doar dacă ea s-a suprapus cu o actualizare.
+ */
+class Today_Clock {
+public:
+    /**
+     * Durata maximă în care data păstrată este folosită fără a fi recalculată
+     * Limitează întârzierea la schimbarea fusului orar sau a orei de vară
+     */
+    static const std::int64_t TICK_SECONDS = 60;
+
+    /**
+     * Obține instanța unică (Singleton)
+     * @return Referință către instanța unică
+     */
+    static Today_Clock& GetInstance();
+
+    /**
+     * Înlocuiește ceasul folosit și invalidează data păstrată
+     * Ceasul trebuie să rămână valid cât timp este folosit; se schimbă de obicei
+     * la pornire sau în teste, nu în timp ce alte fire citesc data.
+     * @param clock Noul ceas (nullptr pentru ceasul sistemului)
+     */
+    void SetClock(IClock* clock);
+
+    /**
+     * Obține numărul zilei locale curente
+     * @return Numărul zilei (vezi Date::GetDayNumber)
+     */
+    int GetDayNumber();
+
+    /**
+     * Obține data locală curentă
+     * @return Data curentă
+     */
+    Date GetDate();
+
+private:
+    std::atomic<IClock*> m_clock;              // Ceasul folosit
+    std::atomic<std::uint32_t> m_sequence;     // Seqlock: impar în timpul unei actualizări
+    std::atomic<std::int64_t> m_valid_from;    // Începutul intervalului de valabilitate
+    std::atomic<std::int64_t> m_valid_until;   // Sfârșitul intervalului (exclusiv)
+    std::atomic<int> m_day_number;             // Ziua păstrată
+    std::mutex m_refresh_mutex;                // Un singur fir recalculează data
+
+    /**
+     * Constructor privat (Singleton)
+     */
+    Today_Clock();
+
+    /**
+     * Recalculează data pentru momentul dat, dacă altă actualizare nu a făcut-o deja
+     */
+    int _Refresh(std::int64_t now);
+
+    /**
+     * Scrie o valoare nouă sub seqlock (apelată cu m_refresh_mutex blocat)
+     */
+    void _Store(std::int64_t valid_from, std::int64_t valid_until, int day_number);
+
+    // Copierea este interzisă (Singleton)
+    Today_Clock(const Today_Clock&) = delete;
+    Today_Clock& operator=(const Today_Clock&) = delete;
+};
+
+} // namespace Task_Management
@@ -2,6 +2,8 @@
 
 #include <string>
 #include <vector>
+#include "entity_id.h"
+#include "task_collection.h"
 
 namespace Task_Management {
 
@@ -64,9 +66,9 @@ public:
     
     /**
      * Obține ID-ul unic al utilizatorului
-     * @return ID-ul utilizatorului ca string
+     * @return ID-ul utilizatorului (forma text se obține cu ToString())
      */
-    std::string GetId() const;
+    Entity_Id GetId() const;
     
     /**
      * Adaugă o sarcină atribuită acestui utilizator
@@ -76,12 +78,26 @@ public:
      */
     void AddAssignedTask(Task* task);
     
+    /**
+     * Adaugă mai multe sarcini atribuite odată
+     * Spațiul este rezervat o singură dată; pointerii null sunt ignorați
+     * @param tasks Începutul intervalului de sarcini
+     * @param count Numărul de sarcini din interval
+     */
+    void AddAssignedTasks(Task* const* tasks, size_t count);
+    
+    /**
+     * Adaugă toate sarcinile dintr-un vector la sarcinile atribuite
+     * @param tasks Sarcinile de adăugat
+     */
+    void AddAssignedTasks(const std::vector<Task*>& tasks);
+    
     /**
      * Elimină o sarcină din atribuirile acestui utilizator
      * @param task_id ID-ul sarcinii de eliminat
      * @return true dacă sarcina a fost găsită și eliminată, false în caz contrar
      */
-    bool RemoveAssignedTask(const std::string& task_id);
+    bool RemoveAssignedTask(const Entity_Id& task_id);
     
     /**
      * Obține toate sarcinile atribuite acestui utilizator
@@ -89,6 +105,13 @@ public:
      */
     const std::vector<Task*>& GetAssignedTasks() const;
     
+    /**
+     * Setează modul de stocare al sarcinilor atribuite
+     * Modul INDEXED face căutarea și eliminarea după ID O(1) în medie
+     * @param mode Noul mod de stocare
+     */
+    void SetStorageMode(Task_Collection::Storage_Mode mode);
+    
     /**
      * Obține numărul de sarcini atribuite acestui utilizator
      * @return Numărul de sarcini atribuite
@@ -114,6 +137,11 @@ public:
      */
     friend std::ostream& operator<<(std::ostream& os, const User& user);
     
+    /**
+     * Snapshot citește și restaurează câmpurile private (inclusiv ID-ul)
+     */
+    friend class Snapshot;
+    
 protected:
     /**
      * Metodă protejată pentru clasele derivate pentru a adăuga detalii specifice la stream
@@ -124,20 +152,14 @@ protected:
 private:
     std::string m_name;   // Numele utilizatorului
     std::string m_email;  // Adresa de email a utilizatorului
-    std::string m_id;     // ID-ul unic al utilizatorului
-    std::vector<Task*> m_assigned_tasks;  // Sarcinile atribuite acestui utilizator
-    
-    /**
-     * Contor static pentru generarea ID-urilor unice
-     * Static înseamnă că este partajat între toate instanțele clasei
-     */
-    static int s_id_counter;
+    Entity_Id m_id;       // ID-ul unic al utilizatorului
+    Task_Collection m_assigned_tasks;  // Sarcinile atribuite acestui utilizator
     
     /**
      * Generează un ID unic pentru utilizator
-     * @return ID-ul generat ca string
+     * @return ID-ul generat
      */
-    std::string _GenerateId();
+    Entity_Id _GenerateId();
 };
 
 } // namespace Task_Management
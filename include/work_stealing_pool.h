@@ -0,0 +1,158 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Task_Management {
+
+/**
+ * Clasa Work_Stealing_Pool - grup de fire de execuție cu "furt de lucru" (work stealing)
+ *
+ * Fiecare fir de execuție are propria coadă de lucrări (job-uri). Un fir își ia lucrările
+ * de la capătul cozii proprii (LIFO, pentru localitate în cache), iar când coada lui
+ * este goală "fură" lucrări de la începutul cozilor celorlalte fire (FIFO, adică
+ * lucrările mai mari, create primele).
+ *
+ * Lucrările sunt grupate în Job_Group-uri. Wait() nu blochează firul apelant: cât timp
+ * grupul nu este terminat, apelantul execută el însuși alte lucrări, deci împărțirea
+ * recursivă (fork-join) nu poate bloca toate firele.
+ *
+ * Lucrările nu trebuie să arunce excepții.
+ */
+class Work_Stealing_Pool {
+public:
+    /**
+     * Clasa Job_Group - urmărește un set de lucrări pornite împreună
+     */
+    class Job_Group {
+    public:
+        Job_Group() : m_pending(0) {}
+
+    private:
+        friend class Work_Stealing_Pool;
+        std::atomic<size_t> m_pending;  // Numărul de lucrări încă neterminate
+    };
+
+    /**
+     * Constructor cu numărul de fire de execuție
+     * @param thread_count Numărul de fire (0 = numărul de nuclee disponibile)
+     */
+    explicit Work_Stealing_Pool(size_t thread_count = 0);
+
+    /**
+     * Destructor - oprește firele după ce termină lucrările aflate în curs
+     */
+    ~Work_Stealing_Pool();
+
+    /**
+     * Obține numărul de fire de execuție ale pool-ului
+     * @return Numărul de fire
+     */
+    size_t GetThreadCount() const;
+
+    /**
+     * Pornește o lucrare în cadrul unui grup
+     * Apelată dintr-un fir al pool-ului, lucrarea intră în coada acelui fir
+     * @param group Grupul din care face parte lucrarea
+     * @param job Lucrarea de executat
+     */
+    void Run(Job_Group& group, std::function<void()> job);
+
+    /**
+     * Așteaptă terminarea tuturor lucrărilor din grup, executând între timp alte lucrări
+     * @param group Grupul așteptat
+     */
+    void Wait(Job_Group& group);
+
+    /**
+     * Indică dacă merită împărțită munca în lucrări noi
+     * Întoarce true când coada firului curent este aproape goală, adică alte fire
+     * ar putea fura lucrări; când toate firele sunt ocupate, evaluarea serială e mai ieftină
+     * @return true dacă împărțirea este utilă, false în caz contrar
+     */
+    bool ShouldSplit() const;
+
+    /**
+     * Execută function(i) pentru fiecare i din [0, count) și așteaptă terminarea tuturor
+     * Fiecare index devine o lucrare separată, deci apelantul grupează munca în blocuri
+     * de dimensiune potrivită
+     * @param pool Pool-ul folosit (nullptr sau count < 2 pentru execuție serială în firul curent)
+     * @param count Numărul de indexuri
+     * @param function Funcția apelată cu fiecare index; trebuie să poată rula simultan
+     */
+    template <typename Function>
+    static void ParallelFor(Work_Stealing_Pool* pool, size_t count, const Function& function) {
+        if (!pool || count < 2) {
+            for (size_t i = 0; i < count; ++i) {
+                function(i);
+            }
+            return;
+        }
+        Job_Group group;
+        for (size_t i = 0; i < count; ++i) {
+            pool->Run(group, [&function, i]() { function(i); });
+        }
+        pool->Wait(group);
+    }
+
+private:
+    /**
+     * O lucrare din coadă, împreună cu grupul căruia îi aparține
+     */
+    struct Job {
+        std::function<void()> function;  // Lucrarea propriu-zisă
+        Job_Group* group;                // Grupul lucrării
+    };
+
+    /**
+     * Coada unui fir de execuție
+     * Fiecare coadă este alocată separat și completată până la o linie de cache
+     * (alignas nu este respectat de new în C++11), pentru a evita false sharing
+     */
+    struct Job_Queue {
+        std::mutex mutex;             // Protejează coada
+        std::deque<Job> jobs;         // Lucrările în așteptare
+        std::atomic<size_t> size;     // Dimensiunea cozii, citită fără lacăt de ShouldSplit
+        char padding[64];             // Separă coada de alocările vecine
+        Job_Queue() : size(0) {}
+    };
+
+    // Câte o coadă pentru fiecare fir, plus una pentru lucrările pornite din afara pool-ului
+    std::vector<std::unique_ptr<Job_Queue>> m_queues;
+    std::vector<std::thread> m_threads;  // Firele de execuție
+    std::atomic<bool> m_stopping;        // Semnal de oprire pentru fire
+    std::atomic<size_t> m_queued;        // Numărul total de lucrări din cozi
+    std::mutex m_sleep_mutex;            // Folosit de firele care așteaptă lucrări
+    std::condition_variable m_wake;      // Trezește firele când apar lucrări
+
+    /**
+     * Bucla principală a unui fir de execuție
+     * @param index Indexul firului (și al cozii lui)
+     */
+    void _WorkerLoop(size_t index);
+
+    /**
+     * Încearcă să execute o lucrare: din coada proprie sau furată de la alt fir
+     * @param self Indexul cozii firului apelant
+     * @return true dacă a fost executată o lucrare, false dacă toate cozile sunt goale
+     */
+    bool _TryRunOne(size_t self);
+
+    /**
+     * Obține indexul cozii firului curent (coada externă pentru firele din afara pool-ului)
+     * @return Indexul cozii
+     */
+    size_t _CurrentQueueIndex() const;
+
+    // Copierea este interzisă
+    Work_Stealing_Pool(const Work_Stealing_Pool&) = delete;
+    Work_Stealing_Pool& operator=(const Work_Stealing_Pool&) = delete;
+};
+
+} // namespace Task_Management
@@ -0,0 +1,320 @@
+#include "async_notifier.h"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+namespace Task_Management {
+
+const size_t Async_Notifier::BATCH_SIZE;
+
+Async_Notifier::Async_Notifier(INotifier* notifier, size_t capacity, Overflow_Policy policy, size_t worker_count)
+    : m_notifier(notifier),
+      m_policy(policy),
+      m_mask(0),
+      m_enqueue_position(0),
+      m_dequeue_position(0),
+      m_overflow_waiters(0),
+      m_overflow_count(0),
+      m_idle_workers(0),
+      m_blocked_senders(0),
+      m_flush_waiters(0),
+      m_stopping(false),
+      m_accepted(0),
+      m_completed(0),
+      m_dropped(0),
+      m_coalesced(0) {
+    // Capacitatea este rotunjită la o putere a lui 2, pentru ca poziția celulei
+    // să se obțină cu o mască în loc de o împărțire
+    size_t rounded = 2;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    m_mask = rounded - 1;
+    m_cells.reset(new Cell[rounded]);
+    for (size_t i = 0; i < rounded; ++i) {
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    worker_count = std::max<size_t>(worker_count, 1);
+    for (size_t i = 0; i < worker_count; ++i) {
+        m_workers.push_back(std::thread(&Async_Notifier::_WorkerLoop, this));
+    }
+}
+
+Async_Notifier::~Async_Notifier() {
+    // Firele golesc coada înainte de a se opri
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_has_work.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+}
+
+bool Async_Notifier::SendNotification(const std::string& recipient, const std::string& subject, const std::string& message) const {
+    Notification notification;
+    notification.recipient = recipient;
+    notification.subject = subject;
+    notification.message = message;
+    return Send(std::move(notification), Delivery_Callback());
+}
+
+std::string Async_Notifier::GetNotificationType() const {
+    return m_notifier->GetNotificationType();
+}
+
+bool Async_Notifier::Send(Notification notification, Delivery_Callback callback) const {
+    Pending pending;
+    pending.notification = std::move(notification);
+    pending.callback = std::move(callback);
+
+    // Notificarea este numărată înaintea inserării, pentru ca Flush() să nu o rateze
+    m_accepted.fetch_add(1);
+
+    // Cât timp există notificări în depășire, cele noi le urmează, pentru a păstra ordinea
+    if (m_policy == Overflow_Policy::COALESCE && m_overflow_count.load(std::memory_order_acquire) > 0) {
+        _Coalesce(pending);
+        _WakeWorker();
+        return true;
+    }
+
+    if (!_TryEnqueue(pending)) {
+        switch (m_policy) {
+            case Overflow_Policy::DROP:
+                m_accepted.fetch_sub(1);
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                _NotifyCompleted();
+                if (pending.callback) {
+                    pending.callback(Delivery_Status::DROPPED);
+                }
+                return false;
+            case Overflow_Policy::COALESCE:
+                _Coalesce(pending);
+                break;
+            case Overflow_Policy::BLOCK: {
+                // Firele de trimitere trezesc producătorii după fiecare lot scos din inel
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_blocked_senders.fetch_add(1);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                m_has_space.wait(lock, [this, &pending]() { return _TryEnqueue(pending); });
+                m_blocked_senders.fetch_sub(1);
+                break;
+            }
+        }
+    }
+    _WakeWorker();
+    return true;
+}
+
+std::future<Async_Notifier::Delivery_Status> Async_Notifier::SendAsync(Notification notification) const {
+    std::shared_ptr<std::promise<Delivery_Status>> promise = std::make_shared<std::promise<Delivery_Status>>();
+    std::future<Delivery_Status> result = promise->get_future();
+    Send(std::move(notification), [promise](Delivery_Status status) { promise->set_value(status); });
+    return result;
+}
+
+void Async_Notifier::Flush() const {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    std::uint64_t target = m_accepted.load();
+    m_flush_waiters.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // Notificările respinse după citirea țintei scad din m_accepted
+    m_flushed.wait(lock, [this, target]() { return m_completed.load() >= std::min(target, m_accepted.load()); });
+    m_flush_waiters.fetch_sub(1);
+}
+
+size_t Async_Notifier::GetCapacity() const {
+    return m_mask + 1;
+}
+
+std::uint64_t Async_Notifier::GetDroppedCount() const {
+    return m_dropped.load(std::memory_order_relaxed);
+}
+
+std::uint64_t Async_Notifier::GetCoalescedCount() const {
+    return m_coalesced.load(std::memory_order_relaxed);
+}
+
+bool Async_Notifier::_TryEnqueue(Pending& pending) const {
+    size_t position = m_enqueue_position.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = m_cells[position & m_mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+        if (difference == 0) {
+            // Celula este liberă: o rezervăm avansând poziția de inserare
+            if (m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                cell.pending = std::move(pending);
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (difference < 0) {
+            return false;  // Celula conține încă notificarea de acum o tură: inelul este plin
+        } else {
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool Async_Notifier::_TryDequeue(Pending& pending) const {
+    size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = m_cells[position & m_mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+        if (difference == 0) {
+            if (m_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                pending = std::move(cell.pending);
+                // Celula devine liberă pentru inserarea de pe tura următoare
+                cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (difference < 0) {
+            return false;  // Celula nu a fost încă scrisă: inelul este gol
+        } else {
+            position = m_dequeue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool Async_Notifier::_HasWork() const {
+    if (m_overflow_count.load(std::memory_order_acquire) > 0) {
+        return true;
+    }
+    // O poziție depășită între timp este tratată tot ca "există lucru"; firul reîncearcă
+    size_t position = m_dequeue_position.load(std::memory_order_relaxed);
+    size_t sequence = m_cells[position & m_mask].sequence.load(std::memory_order_acquire);
+    return static_cast<std::intptr_t>(sequence - (position + 1)) >= 0;
+}
+
+void Async_Notifier::_Coalesce(Pending& pending) const {
+    std::string key = pending.notification.recipient;
+    key += '\0';
+    key += pending.notification.subject;
+
+    Delivery_Callback superseded;
+    bool replaced = false;
+    {
+        std::unique_lock<std::mutex> lock(m_overflow_mutex);
+        for (;;) {
+            auto found = m_overflow_index.find(key);
+            if (found != m_overflow_index.end()) {
+                // Notificarea în așteptare își păstrează locul din coadă, cu conținutul nou
+                Pending& slot = found->second->pending;
+                superseded = std::move(slot.callback);
+                slot = std::move(pending);
+                replaced = true;
+                break;
+            }
+            if (m_overflow.size() <= m_mask) {
+                Overflow_Entry entry;
+                entry.key = key;
+                entry.pending = std::move(pending);
+                m_overflow.push_back(std::move(entry));
+                m_overflow_index.emplace(std::move(key), std::prev(m_overflow.end()));
+                m_overflow_count.store(m_overflow.size(), std::memory_order_release);
+                break;
+            }
+            // Depășirea este plină: apelantul așteaptă ca firele de trimitere să o golească
+            _WakeWorker();
+            ++m_overflow_waiters;
+            m_overflow_space.wait(lock);
+            --m_overflow_waiters;
+        }
+    }
+
+    // Notificarea înlocuită este considerată tratată
+    if (replaced) {
+        m_coalesced.fetch_add(1, std::memory_order_relaxed);
+        m_completed.fetch_add(1);
+        _NotifyCompleted();
+        if (superseded) {
+            superseded(Delivery_Status::COALESCED);
+        }
+    }
+}
+
+void Async_Notifier::_WakeWorker() const {
+    // Bariera ordonează inserarea față de citirea numărului de fire adormite; firul
+    // care adoarme face operațiile în ordine inversă, deci cel puțin unul vede lucrul
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_idle_workers.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_has_work.notify_one();
+    }
+}
+
+void Async_Notifier::_NotifyCompleted() const {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_flush_waiters.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_flushed.notify_all();
+    }
+}
+
+void Async_Notifier::_WorkerLoop() {
+    std::vector<Notification> batch;
+    std::vector<Delivery_Callback> callbacks;
+    std::vector<bool> delivered;
+    batch.reserve(BATCH_SIZE);
+    callbacks.reserve(BATCH_SIZE);
+    Pending pending;
+
+    for (;;) {
+        batch.clear();
+        callbacks.clear();
+
+        // Întâi inelul, apoi depășirea, care conține doar notificări mai noi
+        while (batch.size() < BATCH_SIZE && _TryDequeue(pending)) {
+            batch.push_back(std::move(pending.notification));
+            callbacks.push_back(std::move(pending.callback));
+        }
+        if (batch.size() < BATCH_SIZE && m_overflow_count.load(std::memory_order_acquire) > 0) {
+            std::lock_guard<std::mutex> lock(m_overflow_mutex);
+            while (!m_overflow.empty() && batch.size() < BATCH_SIZE) {
+                Overflow_Entry& entry = m_overflow.front();
+                batch.push_back(std::move(entry.pending.notification));
+                callbacks.push_back(std::move(entry.pending.callback));
+                m_overflow_index.erase(entry.key);
+                m_overflow.pop_front();
+            }
+            m_overflow_count.store(m_overflow.size(), std::memory_order_release);
+            if (m_overflow_waiters > 0) {
+                m_overflow_space.notify_all();
+            }
+        }
+
+        if (batch.empty()) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_idle_workers.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            m_has_work.wait(lock, [this]() { return m_stopping || _HasWork(); });
+            m_idle_workers.fetch_sub(1);
+            if (m_stopping && !_HasWork()) {
+                return;
+            }
+            continue;
+        }
+
+        // Locurile eliberate sunt anunțate înainte de trimiterea (lentă) a lotului
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_blocked_senders.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_has_space.notify_all();
+        }
+
+        m_notifier->SendNotifications(batch, delivered);
+        for (size_t i = 0; i < callbacks.size(); ++i) {
+            if (callbacks[i]) {
+                callbacks[i](i < delivered.size() && delivered[i] ? Delivery_Status::DELIVERED : Delivery_Status::FAILED);
+            }
+        }
+        m_completed.fetch_add(batch.size());
+        _NotifyCompleted();
+    }
+}
+
+} // namespace Task_Management
@@ -1,14 +1,11 @@
 #include "category.h"
+#include "id_allocator.h"
 #include "task.h"
 #include <iostream>
-#include <sstream>
 #include <algorithm>
 
 namespace Task_Management {
 
-// Inițializarea membrului static
-int Category::s_id_counter = 0;
-
 Category::Category(const std::string& name, const std::string& description)
     : m_name(name), m_description(description) {
     // Generăm un ID unic pentru categorie
@@ -49,7 +46,7 @@ void Category::SetDescription(const std::string& description) {
     m_description = description;
 }
 
-std::string Category::GetId() const {
+Entity_Id Category::GetId() const {
     // Returnează ID-ul unic al categoriei
     return m_id;
 }
@@ -57,34 +54,47 @@ std::string Category::GetId() const {
 void Category::AddTask(Task* task) {
     // Adaugă o sarcină la categorie dacă pointerul nu este null
     if (task) {
-        m_tasks.push_back(task);
+        m_tasks.Add(task);
         task->AddCategory(this);  // Adăugăm și categoria la sarcină (relație bidirecțională)
     }
 }
 
-bool Category::RemoveTask(const std::string& task_id) {
-    // Caută sarcina cu ID-ul specificat
-    auto it = std::find_if(m_tasks.begin(), m_tasks.end(),
-                          [&task_id](const Task* task) { return task->GetId() == task_id; });
+void Category::AddTasks(Task* const* tasks, size_t count) {
+    // Adăugăm toate sarcinile cu o singură rezervare de memorie
+    size_t first_added = m_tasks.Size();
+    m_tasks.AddRange(tasks, count);
     
-    // Dacă am găsit sarcina, o eliminăm și returnăm true
-    if (it != m_tasks.end()) {
-        m_tasks.erase(it);
-        return true;
+    // Apoi actualizăm legăturile inverse într-o singură parcurgere a sarcinilor adăugate
+    // (acestea se află la finalul colecției, fără pointerii null)
+    const std::vector<Task*>& all_tasks = m_tasks.GetTasks();
+    for (size_t i = first_added; i < all_tasks.size(); ++i) {
+        all_tasks[i]->AddCategory(this);
     }
-    
-    // Dacă nu am găsit sarcina, returnăm false
-    return false;
+}
+
+void Category::AddTasks(const std::vector<Task*>& tasks) {
+    AddTasks(tasks.data(), tasks.size());
+}
+
+bool Category::RemoveTask(const Entity_Id& task_id) {
+    // Eliminăm sarcina cu ID-ul specificat
+    // Colecția decide dacă folosește căutarea liniară sau indexul după ID
+    return m_tasks.Remove(task_id);
 }
 
 const std::vector<Task*>& Category::GetTasks() const {
     // Returnează toate sarcinile din categorie
-    return m_tasks;
+    return m_tasks.GetTasks();
+}
+
+void Category::SetStorageMode(Task_Collection::Storage_Mode mode) {
+    // Setează modul de stocare al sarcinilor din categorie
+    m_tasks.SetStorageMode(mode);
 }
 
 size_t Category::GetTaskCount() const {
     // Returnează numărul de sarcini din categorie
-    return m_tasks.size();
+    return m_tasks.Size();
 }
 
 void Category::DisplayDetails() const {
@@ -96,30 +106,30 @@ void Category::DisplayDetails() const {
 // Aceasta este o funcție friend declarată în clasa Category
 std::ostream& operator<<(std::ostream& os, const Category& category) {
     // Afișează detaliile categoriei
-    os << "=== Category Details ===" << std::endl;
-    os << "ID: " << category.m_id << std::endl;
-    os << "Name: " << category.m_name << std::endl;
-    os << "Description: " << category.m_description << std::endl;
-    os << "Tasks: " << category.m_tasks.size() << std::endl;
+    const std::vector<Task*>& tasks = category.m_tasks.GetTasks();
+    os << "=== Category Details ===" << "\n";
+    os << "ID: " << category.m_id << "\n";
+    os << "Name: " << category.m_name << "\n";
+    os << "Description: " << category.m_description << "\n";
+    os << "Tasks: " << tasks.size() << "\n";
     
     // Afișează sarcinile din această categorie
-    if (!category.m_tasks.empty()) {
-        os << "Tasks in this category:" << std::endl;
-        for (size_t i = 0; i < category.m_tasks.size(); ++i) {
-            os << "  " << (i + 1) << ". " << category.m_tasks[i]->GetTitle() << std::endl;
+    if (!tasks.empty()) {
+        os << "Tasks in this category:" << "\n";
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            os << "  " << (i + 1) << ". " << tasks[i]->GetTitle() << "\n";
         }
     }
     
-    os << "=======================" << std::endl;
+    os << "=======================" << "\n";
     return os;  // Returnăm stream-ul pentru a permite înlănțuirea
 }
 
 // Metodă privată pentru generarea ID-urilor unice
-std::string Category::_GenerateId() {
-    // Folosim un stringstream pentru a construi ID-ul
-    std::stringstream ss;
-    ss << "CAT-" << ++s_id_counter;  // Incrementăm contorul static și îl includem în ID
-    return ss.str();  // Returnăm ID-ul ca string
+Entity_Id Category::_GenerateId() {
+    // ID-ul este un întreg compact; forma text "CAT-N" se produce doar la afișare
+    // Generatorul comun este thread-safe, deci obiectele pot fi create din mai multe fire
+    return Id_Allocator::GetInstance().Allocate(Entity_Kind::CATEGORY);
 }
 
 } // namespace Task_Management
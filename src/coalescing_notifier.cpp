@@ -0,0 +1,164 @@
+#include "coalescing_notifier.h"
+#include <algorithm>
+
+namespace Task_Management {
+
+Coalescing_Notifier::Coalescing_Notifier(INotifier* notifier, std::chrono::milliseconds window, size_t max_digest_size)
+    : m_notifier(notifier),
+      m_window(window),
+      m_max_digest_size(std::max<size_t>(max_digest_size, 1)),
+      m_next_sequence(0),
+      m_received(0),
+      m_stopping(false),
+      m_sent(0) {
+    m_sender = std::thread(&Coalescing_Notifier::_SenderLoop, this);
+}
+
+Coalescing_Notifier::~Coalescing_Notifier() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_changed.notify_one();
+    m_sender.join();
+
+    // Rezumatele rămase sunt trimise fără a mai aștepta ferestrele
+    Flush();
+}
+
+bool Coalescing_Notifier::SendNotification(const std::string& recipient, const std::string& subject, const std::string& message) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_received;
+
+    auto inserted = m_digests.emplace(recipient, Digest());
+    Digest& digest = inserted.first->second;
+    if (inserted.second) {
+        // Prima notificare deschide fereastra destinatarului
+        digest.sequence = m_next_sequence++;
+        digest.count = 1;
+        digest.subject = subject;
+        digest.message = message;
+        Window window;
+        window.closes_at = Clock::now() + m_window;
+        window.recipient = recipient;
+        window.sequence = digest.sequence;
+        bool was_empty = m_windows.empty();
+        m_windows.push_back(std::move(window));
+        if (was_empty) {
+            m_changed.notify_one();  // Firul de trimitere nu avea nicio fereastră de urmărit
+        }
+    } else {
+        // Textul rezumatului este construit pe loc, fără a reține notificările separat
+        if (digest.count == 1) {
+            digest.message = "[" + digest.subject + "]\n" + digest.message;
+        }
+        digest.message += "\n\n[";
+        digest.message += subject;
+        digest.message += "]\n";
+        digest.message += message;
+        ++digest.count;
+    }
+
+    // Un rezumat plin este trimis imediat; intrarea lui din m_windows devine învechită
+    if (digest.count >= m_max_digest_size) {
+        _Close(digest, recipient, m_ready);
+        m_digests.erase(inserted.first);
+        m_changed.notify_one();
+    }
+    return true;
+}
+
+std::string Coalescing_Notifier::GetNotificationType() const {
+    return m_notifier->GetNotificationType();
+}
+
+void Coalescing_Notifier::Flush() const {
+    std::lock_guard<std::mutex> send_lock(m_send_mutex);
+    std::vector<Notification> batch;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        batch.swap(m_ready);
+        for (const Window& window : m_windows) {
+            auto digest = m_digests.find(window.recipient);
+            if (digest != m_digests.end() && digest->second.sequence == window.sequence) {
+                _Close(digest->second, window.recipient, batch);
+                m_digests.erase(digest);
+            }
+        }
+        m_windows.clear();
+    }
+    _SendBatch(batch);
+}
+
+std::uint64_t Coalescing_Notifier::GetReceivedCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_received;
+}
+
+std::uint64_t Coalescing_Notifier::GetSentCount() const {
+    return m_sent.load();
+}
+
+void Coalescing_Notifier::_Close(Digest& digest, const std::string& recipient, std::vector<Notification>& batch) {
+    Notification notification;
+    notification.recipient = recipient;
+    notification.subject = std::move(digest.subject);
+    if (digest.count > 1) {
+        notification.subject += " (+" + std::to_string(digest.count - 1) + " more)";
+    }
+    notification.message = std::move(digest.message);
+    batch.push_back(std::move(notification));
+}
+
+void Coalescing_Notifier::_SendBatch(std::vector<Notification>& batch) const {
+    if (batch.empty()) {
+        return;
+    }
+    std::vector<bool> delivered;
+    m_notifier->SendNotifications(batch, delivered);
+    m_sent.fetch_add(batch.size());
+}
+
+void Coalescing_Notifier::_SenderLoop() {
+    std::vector<Notification> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            for (;;) {
+                if (m_stopping) {
+                    return;  // Destructorul trimite rezumatele rămase
+                }
+                if (!m_ready.empty()) {
+                    break;
+                }
+                if (m_windows.empty()) {
+                    m_changed.wait(lock);
+                } else if (m_changed.wait_until(lock, m_windows.front().closes_at) == std::cv_status::timeout) {
+                    break;
+                }
+            }
+        }
+
+        // Lotul se colectează cu m_send_mutex luat, pentru ca Flush() să nu trimită
+        // între timp un rezumat mai nou pentru același destinatar
+        std::lock_guard<std::mutex> send_lock(m_send_mutex);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            batch.swap(m_ready);
+            Clock::time_point now = Clock::now();
+            while (!m_windows.empty() && m_windows.front().closes_at <= now) {
+                const Window& window = m_windows.front();
+                auto digest = m_digests.find(window.recipient);
+                if (digest != m_digests.end() && digest->second.sequence == window.sequence) {
+                    _Close(digest->second, window.recipient, batch);
+                    m_digests.erase(digest);
+                }
+                m_windows.pop_front();
+            }
+        }
+        _SendBatch(batch);
+        batch.clear();
+    }
+}
+
+} // namespace Task_Management
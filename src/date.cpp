@@ -1,48 +1,78 @@
 #include "date.h"
+#include "today_clock.h"
 #include <sstream>
 #include <iomanip>
-#include <ctime>
-#include <chrono>
 
 namespace Task_Management {
 
-Date::Date() : year(0), month(0), day(0) {
+// Algoritmii calendarului sunt constexpr, deci pot fi verificați la compilare
+static_assert(Date::DaysFromCivil(1970, 1, 1) == 0, "Epoca Unix trebuie să fie ziua 0");
+static_assert(Date::DaysFromCivil(2000, 3, 1) == 11017, "Ziua de după 29 februarie 2000");
+static_assert(Date::DaysFromCivil(1969, 12, 31) == -1, "Zilele dinaintea epocii sunt negative");
+static_assert(Date::YearFromDays(11016) == 2000 && Date::MonthFromDays(11016) == 2 &&
+              Date::DayFromDays(11016) == 29, "Conversia inversă a zilei bisecte");
+
+constexpr int Date::EPOCH_SHIFT;
+
+Date::Date() : m_year(0), m_month(0), m_day(0), m_day_number(DaysFromCivil(0, 0, 0)) {
     // Constructor implicit - inițializează toate câmpurile cu 0
     // Aceasta reprezintă o dată invalidă care poate fi detectată cu IsValid()
 }
 
-Date::Date(int year, int month, int day) : year(year), month(month), day(day) {
+Date::Date(int year, int month, int day)
+    : m_year(year), m_month(month), m_day(day), m_day_number(DaysFromCivil(year, month, day)) {
     // Constructor cu parametri - inițializează câmpurile cu valorile specificate
     // Nu validăm datele aici, dar putem verifica ulterior cu IsValid()
 }
 
-Date::Date(const Date& other) : year(other.year), month(other.month), day(other.day) {
+Date::Date(const Date& other)
+    : m_year(other.m_year), m_month(other.m_month), m_day(other.m_day), m_day_number(other.m_day_number) {
     // Constructor de copiere - copiază toate câmpurile din obiectul other
 }
 
+Date Date::FromDayNumber(int day_number) {
+    return Date(YearFromDays(day_number), MonthFromDays(day_number), DayFromDays(day_number));
+}
+
+int Date::GetDayNumber() const {
+    return m_day_number;
+}
+
+int Date::GetYear() const {
+    return m_year;
+}
+
+int Date::GetMonth() const {
+    return m_month;
+}
+
+int Date::GetDay() const {
+    return m_day;
+}
+
 std::string Date::ToString() const {
     // Convertește data într-un string formatat (YYYY-MM-DD)
     // Folosim stringstream și manipulatori pentru formatare
     std::stringstream ss;
-    ss << std::setfill('0') << std::setw(4) << year << "-"
-       << std::setfill('0') << std::setw(2) << month << "-"
-       << std::setfill('0') << std::setw(2) << day;
+    ss << std::setfill('0') << std::setw(4) << m_year << "-"
+       << std::setfill('0') << std::setw(2) << m_month << "-"
+       << std::setfill('0') << std::setw(2) << m_day;
     return ss.str();
 }
 
 bool Date::IsValid() const {
     // Validare de bază
     // Anul trebuie să fie pozitiv, luna între 1 și 12, ziua cel puțin 1
-    if (year < 0 || month < 1 || month > 12 || day < 1) {
+    if (m_year < 0 || m_month < 1 || m_month > 12 || m_day < 1) {
         return false;
     }
     
     // Verificăm numărul de zile în lună
     int days_in_month;
-    switch (month) {
+    switch (m_month) {
         case 2: // Februarie
             // Verificăm dacă este an bisect
-            if ((year % 4 == 0 && year % 100 != 0) || (year % 400 == 0)) {
+            if ((m_year % 4 == 0 && m_year % 100 != 0) || (m_year % 400 == 0)) {
                 days_in_month = 29;  // An bisect
             } else {
                 days_in_month = 28;  // An obișnuit
@@ -57,100 +87,52 @@ bool Date::IsValid() const {
     }
     
     // Verificăm dacă ziua este validă pentru luna respectivă
-    return day <= days_in_month;
+    return m_day <= days_in_month;
 }
 
 Date Date::GetCurrentDate() {
-    // Obținem data curentă din sistemul de operare
+    // Obținem data curentă de la ceasul partajat al procesului
     // Aceasta este o metodă statică - poate fi apelată fără o instanță a clasei
-    auto now = std::chrono::system_clock::now();
-    std::time_t now_time = std::chrono::system_clock::to_time_t(now);
-    std::tm* now_tm = std::localtime(&now_time);
-    
-    // Creăm și returnăm un obiect Date cu data curentă
-    return Date(now_tm->tm_year + 1900, now_tm->tm_mon + 1, now_tm->tm_mday);
+    return Today_Clock::GetInstance().GetDate();
 }
 
 int Date::DaysBetween(const Date& date1, const Date& date2) {
-    // Aceasta este o implementare simplificată
-    // Într-o aplicație reală, am folosi un algoritm mai precis
-    
-    // Convertim la structura tm
-    std::tm tm1 = {};
-    tm1.tm_year = date1.year - 1900;  // tm_year este numărul de ani de la 1900
-    tm1.tm_mon = date1.month - 1;     // tm_mon este între 0-11
-    tm1.tm_mday = date1.day;
-    
-    std::tm tm2 = {};
-    tm2.tm_year = date2.year - 1900;
-    tm2.tm_mon = date2.month - 1;
-    tm2.tm_mday = date2.day;
-    
-    // Convertim la time_t (secunde de la epoca Unix)
-    std::time_t time1 = std::mktime(&tm1);
-    std::time_t time2 = std::mktime(&tm2);
-    
-    // Calculăm diferența în secunde și convertim la zile
-    double diff_seconds = std::difftime(time2, time1);
-    int diff_days = static_cast<int>(diff_seconds / (60 * 60 * 24));
-    
-    return diff_days;
+    // Diferența numerelor de zi este exactă, indiferent de fusul orar sau de ora de vară
+    return date2.m_day_number - date1.m_day_number;
 }
 
 Date Date::AddDays(int days) const {
-    // Convertim la structura tm
-    std::tm tm_date = {};
-    tm_date.tm_year = year - 1900;
-    tm_date.tm_mon = month - 1;
-    tm_date.tm_mday = day + days;  // Adăugăm zilele
-    
-    // Normalizăm data (mktime ajustează automat valorile overflow)
-    std::time_t time_date = std::mktime(&tm_date);
-    std::tm* new_tm = std::localtime(&time_date);
-    
-    // Creăm și returnăm un nou obiect Date
-    return Date(new_tm->tm_year + 1900, new_tm->tm_mon + 1, new_tm->tm_mday);
+    // Adunarea se face pe numărul zilei, apoi se reconstruiesc anul, luna și ziua
+    return FromDayNumber(m_day_number + days);
 }
 
 // Implementarea operatorilor de comparație
 // Acești operatori permit compararea directă a obiectelor Date
 
 bool Date::operator==(const Date& other) const {
-    // Două date sunt egale dacă toate componentele sunt egale
-    return year == other.year && month == other.month && day == other.day;
+    // Două date sunt egale dacă au același număr de zi
+    return m_day_number == other.m_day_number;
 }
 
 bool Date::operator!=(const Date& other) const {
-    // Negarea operatorului ==
-    return !(*this == other);
+    return m_day_number != other.m_day_number;
 }
 
 bool Date::operator<(const Date& other) const {
-    // Comparăm mai întâi anii
-    if (year != other.year) {
-        return year < other.year;
-    }
-    // Dacă anii sunt egali, comparăm lunile
-    if (month != other.month) {
-        return month < other.month;
-    }
-    // Dacă și lunile sunt egale, comparăm zilele
-    return day < other.day;
+    // O singură comparație de întregi în locul comparării an / lună / zi
+    return m_day_number < other.m_day_number;
 }
 
 bool Date::operator<=(const Date& other) const {
-    // Mai mic sau egal înseamnă fie mai mic, fie egal
-    return *this < other || *this == other;
+    return m_day_number <= other.m_day_number;
 }
 
 bool Date::operator>(const Date& other) const {
-    // Negarea operatorului <=
-    return !(*this <= other);
+    return m_day_number > other.m_day_number;
 }
 
 bool Date::operator>=(const Date& other) const {
-    // Negarea operatorului <
-    return !(*this < other);
+    return m_day_number >= other.m_day_number;
 }
 
 } // namespace Task_Management
@@ -0,0 +1,189 @@
+#include "deadline_index.h"
+#include "deadline_task.h"
+#include "today_clock.h"
+#include "date.h"
+#include <algorithm>
+
+namespace Task_Management {
+
+namespace {
+
+/**
+ * Sarcinile finalizate sau anulate nu apar în interogări
+ */
+bool IsOpen(const Deadline_Task& task) {
+    TaskStatus status = task.GetStatus();
+    return status != TaskStatus::COMPLETED && status != TaskStatus::CANCELLED;
+}
+
+} // namespace
+
+Deadline_Index::Deadline_Index() : m_open_count(0) {
+    Task::AddObserver(this);
+}
+
+Deadline_Index::~Deadline_Index() {
+    Task::RemoveObserver(this);
+
+    // Sarcinile rămase nu mai trebuie să se scoată singure din index la distrugere
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& day : m_days) {
+        for (Deadline_Task* task : day.second) {
+            task->m_index = nullptr;
+        }
+    }
+    for (Deadline_Task* task : m_closed) {
+        task->m_index = nullptr;
+    }
+}
+
+bool Deadline_Index::Add(Deadline_Task* task) {
+    if (!task) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (task->m_index) {
+        return false;
+    }
+    task->m_index = this;
+    _Place(task);
+    return true;
+}
+
+size_t Deadline_Index::AddTasks(const std::vector<Task*>& tasks) {
+    size_t added = 0;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (Task* task : tasks) {
+        Deadline_Task* deadline_task = dynamic_cast<Deadline_Task*>(task);
+        if (deadline_task && !deadline_task->m_index) {
+            deadline_task->m_index = this;
+            _Place(deadline_task);
+            ++added;
+        }
+    }
+    return added;
+}
+
+bool Deadline_Index::Remove(Deadline_Task* task) {
+    if (!task) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (task->m_index != this) {
+        return false;
+    }
+    _Unplace(task);
+    task->m_index = nullptr;
+    return true;
+}
+
+bool Deadline_Index::Contains(const Deadline_Task* task) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return task && task->m_index == this;
+}
+
+size_t Deadline_Index::Size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_open_count + m_closed.size();
+}
+
+size_t Deadline_Index::GetOpenCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_open_count;
+}
+
+std::vector<Deadline_Task*> Deadline_Index::GetOverdue() const {
+    // Ziua curentă se citește înaintea lacătului (poate recalcula data)
+    int today = Today_Clock::GetInstance().GetDayNumber();
+    std::vector<Deadline_Task*> result;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    _Collect(m_days.begin(), m_days.lower_bound(today), m_open_count, result);
+    return result;
+}
+
+std::vector<Deadline_Task*> Deadline_Index::GetDueBetween(const Date& first, const Date& last) const {
+    std::vector<Deadline_Task*> result;
+    if (last < first) {
+        return result;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    _Collect(m_days.lower_bound(first.GetDayNumber()), m_days.upper_bound(last.GetDayNumber()), m_open_count, result);
+    return result;
+}
+
+std::vector<Deadline_Task*> Deadline_Index::GetNextDue(size_t count) const {
+    int today = Today_Clock::GetInstance().GetDayNumber();
+    std::vector<Deadline_Task*> result;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    _Collect(m_days.lower_bound(today), m_days.end(), count, result);
+    return result;
+}
+
+void Deadline_Index::OnTaskChanged(const Task& task, Task_Change change, const Entity_Id& related) {
+    (void)related;
+    if (change != Task_Change::DEADLINE && change != Task_Change::STATUS) {
+        return;
+    }
+    const Deadline_Task* deadline_task = dynamic_cast<const Deadline_Task*>(&task);
+    if (!deadline_task) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (deadline_task->m_index != this) {
+        return;
+    }
+
+    // Indexul a primit sarcina ca pointer ne-constant la Add, deci o poate muta
+    Deadline_Task* indexed = const_cast<Deadline_Task*>(deadline_task);
+    bool open = IsOpen(*indexed);
+    if (open == indexed->m_index_open && (!open || indexed->m_index_day == indexed->m_deadline.GetDayNumber())) {
+        return;  // Poziția nu se schimbă
+    }
+    _Unplace(indexed);
+    _Place(indexed);
+}
+
+void Deadline_Index::_Place(Deadline_Task* task) {
+    std::vector<Deadline_Task*>* list = &m_closed;
+    task->m_index_open = IsOpen(*task);
+    task->m_index_day = task->m_deadline.GetDayNumber();
+    if (task->m_index_open) {
+        list = &m_days[task->m_index_day];
+        ++m_open_count;
+    }
+    task->m_index_slot = static_cast<std::uint32_t>(list->size());
+    list->push_back(task);
+}
+
+void Deadline_Index::_Unplace(Deadline_Task* task) {
+    auto day = m_days.end();
+    std::vector<Deadline_Task*>* list = &m_closed;
+    if (task->m_index_open) {
+        day = m_days.find(task->m_index_day);
+        list = &day->second;
+        --m_open_count;
+    }
+
+    // Ultima sarcină din listă îi ia locul celei eliminate
+    Deadline_Task* last = list->back();
+    (*list)[task->m_index_slot] = last;
+    last->m_index_slot = task->m_index_slot;
+    list->pop_back();
+
+    // Zilele rămase fără sarcini nu mai sunt păstrate în arbore
+    if (day != m_days.end() && list->empty()) {
+        m_days.erase(day);
+    }
+}
+
+void Deadline_Index::_Collect(std::map<int, std::vector<Deadline_Task*>>::const_iterator first,
+                              std::map<int, std::vector<Deadline_Task*>>::const_iterator last,
+                              size_t limit, std::vector<Deadline_Task*>& result) const {
+    for (auto day = first; day != last && result.size() < limit; ++day) {
+        size_t count = std::min(day->second.size(), limit - result.size());
+        result.insert(result.end(), day->second.begin(), day->second.begin() + count);
+    }
+}
+
+} // namespace Task_Management
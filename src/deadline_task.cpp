@@ -1,24 +1,40 @@
 #include "deadline_task.h"
+#include "today_clock.h"
+#include "deadline_index.h"
 #include <iostream>
 
 namespace Task_Management {
 
 Deadline_Task::Deadline_Task(const std::string& title, const std::string& description, 
                            Priority priority, const Date& deadline)
-    : Task(title, description, priority), m_deadline(deadline) {
+    : Task(title, description, priority),
+      m_deadline(deadline),
+      m_index(nullptr),
+      m_index_day(0),
+      m_index_slot(0),
+      m_index_open(false) {
     // Apelăm constructorul clasei de bază și inițializăm membrul specific acestei clase (m_deadline)
     // Aceasta demonstrează moștenirea și reutilizarea codului
+    _NotifyObservers(Task_Change::CREATED);
 }
 
 Deadline_Task::Deadline_Task(const Deadline_Task& other)
-    : Task(other), m_deadline(other.m_deadline) {
+    : Task(other),
+      m_deadline(other.m_deadline),
+      m_index(nullptr),
+      m_index_day(0),
+      m_index_slot(0),
+      m_index_open(false) {
     // Apelăm constructorul de copiere al clasei de bază
     // și copiem membrul specific acestei clase (m_deadline)
+    // Copia nu face parte din indexul originalului
 }
 
 Deadline_Task::~Deadline_Task() {
-    // Implementarea destructorului
-    // În acest caz simplu, nu avem resurse de eliberat
+    // Sarcina este scoasă din index, pentru ca acesta să nu păstreze un pointer invalid
+    if (m_index) {
+        m_index->Remove(this);
+    }
 }
 
 void Deadline_Task::DisplayDetails() const {
@@ -53,20 +69,19 @@ Date Deadline_Task::GetDeadline() const {
 void Deadline_Task::SetDeadline(const Date& deadline) {
     // Setează data limită
     m_deadline = deadline;
+    _NotifyObservers(Task_Change::DEADLINE);
 }
 
 bool Deadline_Task::IsOverdue() const {
     // Verifică dacă termenul limită a trecut
-    // Comparăm data curentă cu data limită
-    Date current_date = Date::GetCurrentDate();
-    return current_date > m_deadline;
+    // Comparăm ziua curentă (din ceasul partajat) cu ziua termenului limită
+    return Today_Clock::GetInstance().GetDayNumber() > m_deadline.GetDayNumber();
 }
 
 int Deadline_Task::DaysRemaining() const {
     // Calculează numărul de zile rămase până la termenul limită
-    // Folosim metoda statică DaysBetween din structura Date
-    Date current_date = Date::GetCurrentDate();
-    return Date::DaysBetween(current_date, m_deadline);
+    // Diferența numerelor de zi, fără a construi un obiect Date pentru ziua curentă
+    return m_deadline.GetDayNumber() - Today_Clock::GetInstance().GetDayNumber();
 }
 
 void Deadline_Task::_WriteDetailsToStream(std::ostream& os) const {
@@ -77,11 +92,12 @@ void Deadline_Task::_WriteDetailsToStream(std::ostream& os) const {
     os << "Type: Deadline Task\n";
     os << "Deadline: " << m_deadline.ToString() << "\n";
     
-    // Verificăm dacă termenul limită a trecut
-    if (IsOverdue()) {
-        os << "Status: OVERDUE by " << -DaysRemaining() << " days\n";
+    // Verificăm dacă termenul limită a trecut (ziua curentă este citită o singură dată)
+    int days_remaining = DaysRemaining();
+    if (days_remaining < 0) {
+        os << "Status: OVERDUE by " << -days_remaining << " days\n";
     } else {
-        os << "Days Remaining: " << DaysRemaining() << "\n";
+        os << "Days Remaining: " << days_remaining << "\n";
     }
     
     os << "Completion: " << (IsCompleted() ? "Completed" : "Not Completed") << "\n";
@@ -1,10 +1,12 @@
 #include "email_notifier.h"
+#include "smtp_transport.h"
 #include <iostream>
 
 namespace Task_Management {
 
 Email_Notifier::Email_Notifier(const std::string& sender_email)
-    : m_sender_email(sender_email) {
+    : m_sender_email(sender_email),
+      m_transport(nullptr) {
     // Inițializăm adresa de email a expeditorului
 }
 
@@ -14,19 +16,46 @@ Email_Notifier::~Email_Notifier() {
 }
 
 bool Email_Notifier::SendNotification(const std::string& recipient, const std::string& subject, const std::string& message) const {
+    if (m_transport) {
+        std::vector<Notification> notifications(1);
+        notifications[0].recipient = recipient;
+        notifications[0].subject = subject;
+        notifications[0].message = message;
+        std::vector<bool> delivered;
+        return m_transport->Send(m_sender_email, notifications, delivered) == 1;
+    }
+    
     // Într-o implementare reală, această metodă ar conecta la un serviciu de email
     // Pentru această demonstrație, doar afișăm detaliile email-ului
-    
-    std::cout << "Sending email notification:" << std::endl;
-    std::cout << "  From: " << m_sender_email << std::endl;
-    std::cout << "  To: " << recipient << std::endl;
-    std::cout << "  Subject: " << subject << std::endl;
-    std::cout << "  Message: " << message << std::endl;
+    // Textul este formatat întâi, apoi scris și golit o singură dată (nu la fiecare rând)
+    std::string text;
+    _Format(recipient, subject, message, text);
+    std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+    std::cout.flush();
     
     // Simulăm trimiterea cu succes
     return true;
 }
 
+size_t Email_Notifier::SendNotifications(const std::vector<Notification>& notifications, std::vector<bool>& delivered) const {
+    // Cu un transport SMTP, lotul este trimis pe o singură conexiune din pool
+    if (m_transport) {
+        return m_transport->Send(m_sender_email, notifications, delivered);
+    }
+    
+    // Tot lotul este scris cu o singură operație de ieșire
+    std::string text;
+    for (const Notification& notification : notifications) {
+        _Format(notification.recipient, notification.subject, notification.message, text);
+    }
+    std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+    std::cout.flush();
+    
+    // Simulăm trimiterea cu succes
+    delivered.assign(notifications.size(), true);
+    return notifications.size();
+}
+
 std::string Email_Notifier::GetNotificationType() const {
     // Returnează tipul notificării
     return "Email";
@@ -42,4 +71,17 @@ void Email_Notifier::SetSenderEmail(const std::string& sender_email) {
     m_sender_email = sender_email;
 }
 
+void Email_Notifier::SetTransport(Smtp_Transport* transport) {
+    // Transportul este injectat, ca și notificatorul unui Task_List
+    m_transport = transport;
+}
+
+void Email_Notifier::_Format(const std::string& recipient, const std::string& subject, const std::string& message, std::string& out) const {
+    out += "Sending email notification:\n";
+    out += "  From: " + m_sender_email + "\n";
+    out += "  To: " + recipient + "\n";
+    out += "  Subject: " + subject + "\n";
+    out += "  Message: " + message + "\n";
+}
+
 } // namespace Task_Management
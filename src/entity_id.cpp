@@ -0,0 +1,88 @@
+#include "entity_id.h"
+#include <ostream>
+#include <cstring>
+
+namespace Task_Management {
+
+namespace {
+
+/**
+ * Prefixul text pentru fiecare tip de entitate
+ * Indexat după valoarea numerică a Entity_Kind
+ */
+const char* const KIND_PREFIXES[] = { "", "TASK-", "USER-", "CAT-", "LIST-" };
+const int KIND_COUNT = sizeof(KIND_PREFIXES) / sizeof(KIND_PREFIXES[0]);
+
+} // namespace
+
+// Definițiile membrilor statici constanți (necesare dacă sunt folosiți prin referință)
+const std::uint64_t Entity_Id::MAX_NUMBER;
+const size_t Entity_Id::MAX_TEXT_SIZE;
+
+std::string Entity_Id::ToString() const {
+    // Forma text se construiește doar la afișare sau export
+    char buffer[MAX_TEXT_SIZE];
+    return std::string(buffer, FormatTo(buffer));
+}
+
+size_t Entity_Id::FormatTo(char* buffer) const {
+    int kind = static_cast<int>(GetKind());
+    if (kind <= 0 || kind >= KIND_COUNT) {
+        std::memcpy(buffer, "INVALID", 7);
+        return 7;
+    }
+
+    // Scriem cifrele de la coadă spre început într-un buffer local,
+    // fără stringstream
+    char digits[24];
+    char* end = digits + sizeof(digits);
+    char* p = end;
+    std::uint64_t number = GetNumber();
+    do {
+        *--p = static_cast<char>('0' + number % 10);
+        number /= 10;
+    } while (number != 0);
+
+    size_t prefix_length = std::strlen(KIND_PREFIXES[kind]);
+    std::memcpy(buffer, KIND_PREFIXES[kind], prefix_length);
+    std::memcpy(buffer + prefix_length, p, static_cast<size_t>(end - p));
+    return prefix_length + static_cast<size_t>(end - p);
+}
+
+bool Entity_Id::TryParse(const std::string& text, Entity_Id& id) {
+    for (int kind = 1; kind < KIND_COUNT; ++kind) {
+        size_t prefix_length = std::strlen(KIND_PREFIXES[kind]);
+        if (text.size() <= prefix_length || text.compare(0, prefix_length, KIND_PREFIXES[kind]) != 0) {
+            continue;
+        }
+
+        // După prefix trebuie să urmeze doar cifre, fără depășirea celor 56 de biți
+        std::uint64_t number = 0;
+        for (size_t i = prefix_length; i < text.size(); ++i) {
+            char c = text[i];
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            number = number * 10 + static_cast<std::uint64_t>(c - '0');
+            if (number > MAX_NUMBER) {
+                return false;
+            }
+        }
+
+        id = Entity_Id(static_cast<Entity_Kind>(kind), number);
+        return true;
+    }
+    return false;
+}
+
+Entity_Id Entity_Id::Parse(const std::string& text) {
+    Entity_Id id;
+    TryParse(text, id);
+    return id;
+}
+
+std::ostream& operator<<(std::ostream& os, const Entity_Id& id) {
+    return os << id.ToString();
+}
+
+} // namespace Task_Management
@@ -0,0 +1,78 @@
+#include "id_allocator.h"
+
+namespace Task_Management {
+
+namespace {
+
+/**
+ * Blocul de ID-uri rezervat de firul de execuție curent pentru un tip de entitate
+ * Intervalul [next, end) este consumat fără sincronizare
+ */
+struct Id_Block {
+    std::uint64_t next;   // Următorul număr disponibil din bloc
+    std::uint64_t end;    // Primul număr din afara blocului
+    std::uint64_t epoch;  // Epoca generatorului la momentul rezervării
+};
+
+// Câte un bloc pentru fiecare tip de entitate, separat pentru fiecare fir de execuție
+thread_local Id_Block t_blocks[Id_Allocator::KIND_COUNT] = {};
+
+} // namespace
+
+// Definiția membrului static constant (necesară dacă este folosit prin referință)
+const std::uint64_t Id_Allocator::BLOCK_SIZE;
+
+Id_Allocator::Id_Allocator() : m_epoch(1) {
+    // Numerotarea începe de la 1 pentru fiecare tip, ca în vechile contoare statice
+    for (int i = 0; i < KIND_COUNT; ++i) {
+        m_next[i].store(1);
+    }
+}
+
+Id_Allocator& Id_Allocator::GetInstance() {
+    // Inițializarea variabilei statice locale este thread-safe începând cu C++11
+    static Id_Allocator instance;
+    return instance;
+}
+
+Entity_Id Id_Allocator::Allocate(Entity_Kind kind) {
+    int index = static_cast<int>(kind);
+    Id_Block& block = t_blocks[index];
+
+    // Rezervăm un bloc nou dacă cel curent s-a epuizat sau a fost invalidat de ResumeFrom
+    std::uint64_t epoch = m_epoch.load(std::memory_order_acquire);
+    if (block.next == block.end || block.epoch != epoch) {
+        block.next = m_next[index].fetch_add(BLOCK_SIZE, std::memory_order_relaxed);
+        block.end = block.next + BLOCK_SIZE;
+        block.epoch = epoch;
+    }
+
+    return Entity_Id(kind, block.next++);
+}
+
+void Id_Allocator::ResumeFrom(const Entity_Id& highest) {
+    int index = static_cast<int>(highest.GetKind());
+    if (index <= 0 || index >= KIND_COUNT) {
+        return;
+    }
+
+    // Ridicăm contorul peste cel mai mare ID persistat (niciodată nu îl coborâm)
+    std::uint64_t wanted = highest.GetNumber() + 1;
+    std::uint64_t current = m_next[index].load();
+    while (current < wanted && !m_next[index].compare_exchange_weak(current, wanted)) {
+        // compare_exchange_weak actualizează current la eșec; reîncercăm
+    }
+
+    // Blocurile rezervate anterior pot conține numere deja persistate, deci le abandonăm
+    m_epoch.fetch_add(1, std::memory_order_release);
+}
+
+std::uint64_t Id_Allocator::GetHighWaterMark(Entity_Kind kind) const {
+    int index = static_cast<int>(kind);
+    if (index <= 0 || index >= KIND_COUNT) {
+        return 0;
+    }
+    return m_next[index].load() - 1;
+}
+
+} // namespace Task_Management
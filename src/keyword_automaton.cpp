@@ -0,0 +1,232 @@
+#include "keyword_automaton.h"
+#include "task.h"
+#include "task_notes.h"
+#include "work_stealing_pool.h"
+#include <algorithm>
+
+namespace Task_Management {
+
+const size_t Keyword_Match::TASK_TEXT;
+
+namespace {
+
+/**
+ * Marchează o tranziție încă inexistentă în timpul construirii
+ */
+const std::uint32_t NO_STATE = static_cast<std::uint32_t>(-1);
+
+/**
+ * Bitul care marchează, într-o tranziție, o stare în care se încheie cel puțin un cuvânt
+ */
+const std::uint32_t OUTPUT_FLAG = 0x80000000u;
+
+/**
+ * Numărul de sarcini procesate de o singură lucrare în ScanTasks
+ */
+const size_t SCAN_BLOCK_SIZE = 256;
+
+inline unsigned char ToLower(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c + ('a' - 'A')) : c;
+}
+
+} // namespace
+
+Keyword_Automaton::Keyword_Automaton(const std::vector<std::string>& keywords, bool ignore_case)
+    : m_keywords(keywords),
+      m_ignore_case(ignore_case),
+      m_class_count(1) {
+    // Clasele de octeți: fiecare octet folosit într-un cuvânt are clasa lui, restul clasa 0
+    // (literele mari au clasa literelor mici corespunzătoare dacă nu se fac diferențe)
+    std::vector<std::uint16_t> classes(256, 0);
+    for (const std::string& keyword : m_keywords) {
+        for (char c : keyword) {
+            unsigned char byte = static_cast<unsigned char>(c);
+            if (m_ignore_case) {
+                byte = ToLower(byte);
+            }
+            if (classes[byte] == 0) {
+                classes[byte] = static_cast<std::uint16_t>(m_class_count++);
+            }
+        }
+    }
+    for (size_t byte = 0; byte < 256; ++byte) {
+        m_classes[byte] = classes[m_ignore_case ? ToLower(static_cast<unsigned char>(byte)) : byte];
+    }
+
+    // Trie-ul cuvintelor: starea 0 este rădăcina
+    m_transitions.assign(m_class_count, NO_STATE);
+    std::vector<std::vector<std::uint32_t>> outputs(1);
+    for (size_t index = 0; index < m_keywords.size(); ++index) {
+        const std::string& keyword = m_keywords[index];
+        if (keyword.empty()) {
+            continue;
+        }
+        std::uint32_t state = 0;
+        for (char c : keyword) {
+            std::uint32_t& next = m_transitions[state * m_class_count + m_classes[static_cast<unsigned char>(c)]];
+            if (next == NO_STATE) {
+                next = static_cast<std::uint32_t>(outputs.size());
+                outputs.push_back(std::vector<std::uint32_t>());
+                m_transitions.resize(m_transitions.size() + m_class_count, NO_STATE);
+            }
+            state = m_transitions[state * m_class_count + m_classes[static_cast<unsigned char>(c)]];
+        }
+        outputs[state].push_back(static_cast<std::uint32_t>(index));
+    }
+
+    // Parcurgerea în lățime completează tranzițiile lipsă cu cele ale stării de eșec
+    // (cel mai lung sufix propriu care este și prefix al unui cuvânt) și adaugă la fiecare
+    // stare cuvintele stării de eșec, care se termină și ele în acel punct
+    size_t state_count = outputs.size();
+    std::vector<std::uint32_t> failure(state_count, 0);
+    std::vector<std::uint32_t> queue;
+    queue.reserve(state_count);
+    for (size_t c = 0; c < m_class_count; ++c) {
+        std::uint32_t& next = m_transitions[c];
+        if (next == NO_STATE) {
+            next = 0;
+        } else {
+            queue.push_back(next);
+        }
+    }
+    for (size_t head = 0; head < queue.size(); ++head) {
+        std::uint32_t state = queue[head];
+        const std::vector<std::uint32_t>& inherited = outputs[failure[state]];
+        outputs[state].insert(outputs[state].end(), inherited.begin(), inherited.end());
+        for (size_t c = 0; c < m_class_count; ++c) {
+            std::uint32_t& next = m_transitions[state * m_class_count + c];
+            std::uint32_t fallback = m_transitions[failure[state] * m_class_count + c];
+            if (next == NO_STATE) {
+                next = fallback;
+            } else {
+                failure[next] = fallback;
+                queue.push_back(next);
+            }
+        }
+    }
+
+    // Cuvintele stărilor, într-un singur vector
+    m_output_begin.reserve(state_count + 1);
+    m_output_begin.push_back(0);
+    for (const std::vector<std::uint32_t>& state_outputs : outputs) {
+        m_outputs.insert(m_outputs.end(), state_outputs.begin(), state_outputs.end());
+        m_output_begin.push_back(static_cast<std::uint32_t>(m_outputs.size()));
+    }
+
+    // Tranzițiile rețin direct începutul rândului stării următoare, iar bitul OUTPUT_FLAG
+    // marchează stările care încheie cuvinte: pasul pe octet este o singură citire din tabel
+    for (std::uint32_t& next : m_transitions) {
+        bool has_output = m_output_begin[next] != m_output_begin[next + 1];
+        next = static_cast<std::uint32_t>(next * m_class_count) | (has_output ? OUTPUT_FLAG : 0);
+    }
+}
+
+size_t Keyword_Automaton::GetKeywordCount() const {
+    return m_keywords.size();
+}
+
+const std::string& Keyword_Automaton::GetKeyword(size_t index) const {
+    return m_keywords[index];
+}
+
+size_t Keyword_Automaton::GetStateCount() const {
+    return m_output_begin.size() - 1;
+}
+
+void Keyword_Automaton::Scan(const char* text, size_t size, std::vector<std::uint32_t>& keywords) const {
+    keywords.clear();
+    std::vector<std::uint32_t> seen(m_keywords.size(), 0);
+    _Scan(text, size, seen, 1, keywords);
+    std::sort(keywords.begin(), keywords.end());
+}
+
+std::vector<std::uint32_t> Keyword_Automaton::Scan(const std::string& text) const {
+    std::vector<std::uint32_t> keywords;
+    Scan(text.data(), text.size(), keywords);
+    return keywords;
+}
+
+std::vector<Keyword_Match> Keyword_Automaton::ScanTasks(const std::vector<const Task_Notes*>& tasks,
+                                                        Work_Stealing_Pool* pool) const {
+    size_t block_count = (tasks.size() + SCAN_BLOCK_SIZE - 1) / SCAN_BLOCK_SIZE;
+    std::vector<std::vector<Keyword_Match>> block_matches(block_count);
+    Work_Stealing_Pool::ParallelFor(pool, block_count, [&](size_t block) {
+        std::vector<Keyword_Match>& matches = block_matches[block];
+        std::vector<std::uint32_t> seen(m_keywords.size(), 0);
+        std::uint32_t stamp = 0;
+        std::vector<std::uint32_t> keywords;
+
+        // Cuvintele unui text sunt adăugate ordonate, fără repetări
+        auto add = [&](size_t task, size_t note) {
+            std::sort(keywords.begin(), keywords.end());
+            for (std::uint32_t keyword : keywords) {
+                Keyword_Match match;
+                match.task = task;
+                match.note = note;
+                match.keyword = keyword;
+                matches.push_back(match);
+            }
+            keywords.clear();
+        };
+
+        size_t end = std::min(tasks.size(), (block + 1) * SCAN_BLOCK_SIZE);
+        for (size_t i = block * SCAN_BLOCK_SIZE; i < end; ++i) {
+            const Task_Notes* task_notes = tasks[i];
+            if (!task_notes) {
+                continue;
+            }
+            const Task* task = task_notes->GetTask();
+            if (task) {
+                // Titlul și descrierea sunt raportate împreună, deci folosesc același stamp
+                ++stamp;
+                const std::string& title = task->GetTitle();
+                const std::string& description = task->GetDescription();
+                _Scan(title.data(), title.size(), seen, stamp, keywords);
+                _Scan(description.data(), description.size(), seen, stamp, keywords);
+                add(i, Keyword_Match::TASK_TEXT);
+            }
+            const std::vector<Note>& notes = task_notes->GetNotes();
+            for (size_t note = 0; note < notes.size(); ++note) {
+                ++stamp;
+                _Scan(notes[note].text.data(), notes[note].text.size(), seen, stamp, keywords);
+                add(i, note);
+            }
+        }
+    });
+
+    // Rezultatele blocurilor, în ordinea sarcinilor
+    size_t total = 0;
+    for (const std::vector<Keyword_Match>& matches : block_matches) {
+        total += matches.size();
+    }
+    std::vector<Keyword_Match> result;
+    result.reserve(total);
+    for (const std::vector<Keyword_Match>& matches : block_matches) {
+        result.insert(result.end(), matches.begin(), matches.end());
+    }
+    return result;
+}
+
+void Keyword_Automaton::_Scan(const char* text, size_t size, std::vector<std::uint32_t>& seen, std::uint32_t stamp,
+                              std::vector<std::uint32_t>& keywords) const {
+    const std::uint32_t* transitions = m_transitions.data();
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(text);
+    std::uint32_t row = 0;
+    for (size_t i = 0; i < size; ++i) {
+        std::uint32_t next = transitions[row + m_classes[bytes[i]]];
+        row = next & ~OUTPUT_FLAG;
+        // Majoritatea stărilor nu încheie niciun cuvânt
+        if (next & OUTPUT_FLAG) {
+            size_t state = row / m_class_count;
+            for (std::uint32_t j = m_output_begin[state]; j < m_output_begin[state + 1]; ++j) {
+                std::uint32_t keyword = m_outputs[j];
+                if (seen[keyword] != stamp) {
+                    seen[keyword] = stamp;
+                    keywords.push_back(keyword);
+                }
+            }
+        }
+    }
+}
+
+} // namespace Task_Management
@@ -228,6 +228,9 @@ int main() {
     std::cout << std::endl;
     
     // Clean up (in a real application, we would use smart pointers)
+    // The manager does not own its entries, so unregister them before deleting them
+    manager.Clear();
+    
     delete john;
     delete alice;
     delete mike;
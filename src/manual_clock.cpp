@@ -0,0 +1,38 @@
+#include "manual_clock.h"
+#include "date.h"
+
+namespace Task_Management {
+
+namespace {
+
+const std::int64_t SECONDS_PER_DAY = 24 * 3600;
+
+} // namespace
+
+Manual_Clock::Manual_Clock(std::int64_t time) : m_time(time) {
+}
+
+void Manual_Clock::SetTime(std::int64_t time) {
+    m_time.store(time);
+}
+
+void Manual_Clock::SetDate(const Date& date) {
+    m_time.store(static_cast<std::int64_t>(date.GetDayNumber()) * SECONDS_PER_DAY);
+}
+
+void Manual_Clock::Advance(std::int64_t seconds) {
+    m_time.fetch_add(seconds);
+}
+
+std::int64_t Manual_Clock::GetTime() const {
+    return m_time.load();
+}
+
+int Manual_Clock::GetLocalDay(std::int64_t time, std::int64_t& next_day) const {
+    // Împărțire rotunjită în jos, corectă și pentru momentele dinaintea epocii
+    std::int64_t day = time / SECONDS_PER_DAY - (time % SECONDS_PER_DAY < 0 ? 1 : 0);
+    next_day = (day + 1) * SECONDS_PER_DAY;
+    return static_cast<int>(day);
+}
+
+} // namespace Task_Management
@@ -0,0 +1,748 @@
+#include "mutation_log.h"
+#include "snapshot.h"
+#include "task.h"
+#include "simple_task.h"
+#include "project_task.h"
+#include "recurring_task.h"
+#include "deadline_task.h"
+#include "user.h"
+#include "category.h"
+#include "task_list.h"
+#include "task_notes.h"
+#include "task_factory.h"
+#include "id_allocator.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Task_Management {
+
+const char Mutation_Log::MAGIC[8] = {'T', 'M', 'W', 'A', 'L', '\r', '\n', '\x1A'};
+
+namespace {
+
+/**
+ * Dimensiunea antetului unei înregistrări: dimensiunea datelor și suma de control
+ */
+const size_t RECORD_HEADER_SIZE = 8;
+
+/**
+ * Dimensiunea maximă a datelor unei înregistrări acceptată la citire
+ */
+const std::uint32_t MAX_RECORD_SIZE = 1u << 30;
+
+/**
+ * Dimensiunea înregistrărilor care așteaptă scrierea peste care setter-ii așteaptă
+ * (și în modul ASYNC), pentru ca un disc lent să nu lase memoria să crească nelimitat
+ */
+const size_t MAX_PENDING_SIZE = 8 << 20;
+
+void StoreFixed32(char* out, std::uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+void AppendVarint(std::string& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+inline std::uint64_t ZigZagEncode(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+inline std::int64_t ZigZagDecode(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+void AppendString(std::string& out, const std::string& text) {
+    AppendVarint(out, text.size());
+    out.append(text);
+}
+
+std::uint32_t LoadFixed32(const unsigned char* data) {
+    return static_cast<std::uint32_t>(data[0]) | (static_cast<std::uint32_t>(data[1]) << 8) |
+           (static_cast<std::uint32_t>(data[2]) << 16) | (static_cast<std::uint32_t>(data[3]) << 24);
+}
+
+std::uint32_t RecordChecksum(const char* data, size_t size) {
+    Snapshot::Checksum checksum;
+    checksum.Update(data, size);
+    return static_cast<std::uint32_t>(checksum.Finish());
+}
+
+/**
+ * Citirea datelor unei înregistrări, cu verificarea limitelor
+ */
+struct Record_Reader {
+    const unsigned char* pos;
+    const unsigned char* end;
+    bool failed;
+
+    Record_Reader(const unsigned char* pos, const unsigned char* end) : pos(pos), end(end), failed(false) {}
+
+    std::uint8_t Byte() {
+        if (pos == end) {
+            failed = true;
+            return 0;
+        }
+        return *pos++;
+    }
+
+    std::uint64_t Varint() {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64 && pos != end; shift += 7) {
+            std::uint8_t byte = *pos++;
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        failed = true;
+        return 0;
+    }
+
+    std::string String() {
+        std::uint64_t length = Varint();
+        if (length > static_cast<std::uint64_t>(end - pos)) {
+            failed = true;
+            return std::string();
+        }
+        std::string text(reinterpret_cast<const char*>(pos), static_cast<size_t>(length));
+        pos += length;
+        return text;
+    }
+};
+
+/**
+ * Creează o sarcină, prin fabrică dacă există una
+ */
+template <typename T, typename... Args>
+T* CreateTask(Task_Factory* factory, Args&&... args) {
+    if (factory) {
+        return factory->Create<T>(std::forward<Args>(args)...);
+    }
+    return new T(std::forward<Args>(args)...);
+}
+
+} // namespace
+
+/**
+ * Aplicarea înregistrărilor la Replay, peste obiectele unui graf
+ * Sarcinile șterse sunt doar scoase din tabele în timpul aplicării; Finish le scoate din
+ * graf și le distruge, o singură dată pentru toate.
+ */
+class Mutation_Log::Replayer {
+public:
+    /**
+     * Efectul unei înregistrări
+     */
+    enum class Outcome {
+        APPLIED,    // Modificarea a fost aplicată
+        UNCHANGED,  // Graful conținea deja modificarea (sarcină deja creată sau deja ștearsă)
+        SKIPPED     // Obiectul referit lipsește din graf sau valoarea este invalidă
+    };
+
+    Replayer(Task_Graph& graph, Task_Factory* factory) : m_graph(graph), m_factory(factory), m_highest_created(0) {
+        m_tasks.reserve(graph.tasks.size());
+        for (Task* task : graph.tasks) {
+            m_tasks[task->GetId().GetNumber()] = task;
+        }
+        for (User* user : graph.users) {
+            m_users[user->GetId().GetNumber()] = user;
+        }
+        for (Category* category : graph.categories) {
+            m_categories[category->GetId().GetNumber()] = category;
+        }
+    }
+
+    /**
+     * Aplică o înregistrare; întoarce false dacă nu a putut fi decodificată
+     * @param outcome Primește efectul înregistrării
+     */
+    bool Apply(const unsigned char* data, size_t size, Outcome& outcome) {
+        Record_Reader in(data, data + size);
+        std::uint8_t change_byte = in.Byte();
+        std::uint64_t number = in.Varint();
+        Task* task = _Find(m_tasks, number);
+        outcome = Outcome::SKIPPED;
+        if (in.failed || change_byte > static_cast<std::uint8_t>(Task_Change::DELETED)) {
+            return false;
+        }
+
+        bool applied = false;
+        Task_Change change = static_cast<Task_Change>(change_byte);
+        switch (change) {
+            case Task_Change::TITLE:
+            case Task_Change::DESCRIPTION: {
+                std::string text = in.String();
+                if (in.failed || !task) {
+                    break;
+                }
+                if (change == Task_Change::TITLE) {
+                    task->SetTitle(text);
+                } else {
+                    task->SetDescription(text);
+                }
+                applied = true;
+                break;
+            }
+            case Task_Change::PRIORITY: {
+                std::uint8_t value = in.Byte();
+                if (!in.failed && task && value <= static_cast<std::uint8_t>(Priority::URGENT)) {
+                    task->SetPriority(static_cast<Priority>(value));
+                    applied = true;
+                }
+                break;
+            }
+            case Task_Change::STATUS: {
+                std::uint8_t value = in.Byte();
+                if (!in.failed && task && value <= static_cast<std::uint8_t>(TaskStatus::CANCELLED)) {
+                    task->SetStatus(static_cast<TaskStatus>(value));
+                    applied = true;
+                }
+                break;
+            }
+            case Task_Change::ASSIGNED_USER: {
+                // Numărul 0 înseamnă că sarcina nu mai este atribuită
+                std::uint64_t user_number = in.Varint();
+                User* user = user_number ? _Find(m_users, user_number) : nullptr;
+                if (!in.failed && task && (user || user_number == 0)) {
+                    task->AssignTo(user);
+                    applied = true;
+                }
+                break;
+            }
+            case Task_Change::CATEGORY_ADDED: {
+                Category* category = _Find(m_categories, in.Varint());
+                if (!in.failed && task && category) {
+                    task->AddCategory(category);
+                    applied = true;
+                }
+                break;
+            }
+            case Task_Change::SUBTASK_ADDED:
+            case Task_Change::SUBTASK_REMOVED: {
+                std::uint64_t subtask_number = in.Varint();
+                Project_Task* project = dynamic_cast<Project_Task*>(task);
+                if (in.failed || !project) {
+                    break;
+                }
+                if (change == Task_Change::SUBTASK_REMOVED) {
+                    applied = project->RemoveSubtask(Entity_Id(Entity_Kind::TASK, subtask_number));
+                } else if (Task* subtask = _Find(m_tasks, subtask_number)) {
+                    project->AddSubtask(subtask);
+                    applied = true;
+                }
+                break;
+            }
+            case Task_Change::DEADLINE: {
+                // Numărul zilei poate fi negativ, deci este scris în codificarea zigzag
+                std::uint64_t value = in.Varint();
+                Deadline_Task* deadline_task = dynamic_cast<Deadline_Task*>(task);
+                if (!in.failed && deadline_task) {
+                    deadline_task->SetDeadline(Date::FromDayNumber(static_cast<int>(ZigZagDecode(value))));
+                    applied = true;
+                }
+                break;
+            }
+            case Task_Change::CREATED: {
+                // O sarcină care există deja a fost salvată în snapshot după crearea ei
+                if (task) {
+                    outcome = Outcome::UNCHANGED;
+                    return true;
+                }
+                applied = _Create(in, number);
+                break;
+            }
+            case Task_Change::DELETED: {
+                if (!task) {
+                    outcome = Outcome::UNCHANGED;
+                    return true;
+                }
+                m_tasks.erase(number);
+                m_deleted.insert(task);
+                applied = true;
+                break;
+            }
+        }
+        if (applied) {
+            outcome = Outcome::APPLIED;
+        }
+        return !in.failed;
+    }
+
+    /**
+     * Distruge sarcinile șterse (după ce le scoate din listele, categoriile, utilizatorii
+     * și notele grafului) și continuă generarea ID-urilor după sarcinile create
+     */
+    void Finish() {
+        if (m_highest_created != 0) {
+            Id_Allocator::GetInstance().ResumeFrom(Entity_Id(Entity_Kind::TASK, m_highest_created));
+        }
+        if (m_deleted.empty()) {
+            return;
+        }
+
+        std::vector<Entity_Id> removed;
+        for (Task_List* task_list : m_graph.task_lists) {
+            _CollectDeleted(task_list->GetTasks(), removed);
+            for (const Entity_Id& id : removed) {
+                task_list->RemoveTask(id);
+            }
+        }
+        for (Category* category : m_graph.categories) {
+            _CollectDeleted(category->GetTasks(), removed);
+            for (const Entity_Id& id : removed) {
+                category->RemoveTask(id);
+            }
+        }
+        for (User* user : m_graph.users) {
+            _CollectDeleted(user->GetAssignedTasks(), removed);
+            for (const Entity_Id& id : removed) {
+                user->RemoveAssignedTask(id);
+            }
+        }
+
+        std::vector<Task_Notes*>& notes = m_graph.notes;
+        notes.erase(std::remove_if(notes.begin(), notes.end(), [this](Task_Notes* task_notes) {
+            if (m_deleted.count(task_notes->GetTask()) == 0) {
+                return false;
+            }
+            delete task_notes;
+            return true;
+        }), notes.end());
+
+        std::vector<Task*>& tasks = m_graph.tasks;
+        tasks.erase(std::remove_if(tasks.begin(), tasks.end(), [this](Task* task) {
+            return m_deleted.count(task) != 0;
+        }), tasks.end());
+        for (Task* task : m_deleted) {
+            if (m_factory) {
+                m_factory->Destroy(task);
+            } else {
+                delete task;
+            }
+        }
+        m_deleted.clear();
+    }
+
+private:
+    Task_Graph& m_graph;
+    Task_Factory* m_factory;
+    std::unordered_map<std::uint64_t, Task*> m_tasks;          // Sarcinile existente, după numărul ID-ului
+    std::unordered_map<std::uint64_t, User*> m_users;
+    std::unordered_map<std::uint64_t, Category*> m_categories;
+    std::unordered_set<Task*> m_deleted;                       // Sarcinile șterse, distruse de Finish
+    std::uint64_t m_highest_created;                           // Cel mai mare ID al sarcinilor create
+
+    template <typename T>
+    static T* _Find(const std::unordered_map<std::uint64_t, T*>& table, std::uint64_t number) {
+        auto it = table.find(number);
+        return it != table.end() ? it->second : nullptr;
+    }
+
+    void _CollectDeleted(const std::vector<Task*>& tasks, std::vector<Entity_Id>& removed) const {
+        removed.clear();
+        for (Task* task : tasks) {
+            if (m_deleted.count(task) != 0) {
+                removed.push_back(task->GetId());
+            }
+        }
+    }
+
+    /**
+     * Creează o sarcină dintr-o înregistrare CREATED (vezi OnTaskChanged) și îi restaurează ID-ul
+     * @return true dacă sarcina a fost creată, false dacă datele sunt invalide
+     */
+    bool _Create(Record_Reader& in, std::uint64_t number) {
+        std::uint8_t type = in.Byte();
+        std::string title = in.String();
+        std::string description = in.String();
+        std::uint8_t priority_byte = in.Byte();
+        std::uint64_t creation_sequence = in.Varint();
+        if (in.failed || number == 0 || priority_byte > static_cast<std::uint8_t>(Priority::URGENT)) {
+            return false;
+        }
+        Priority priority = static_cast<Priority>(priority_byte);
+
+        Task* task = nullptr;
+        switch (static_cast<Snapshot::Task_Type>(type)) {
+            case Snapshot::Task_Type::SIMPLE:
+                task = CreateTask<Simple_Task>(m_factory, title, description, priority);
+                break;
+            case Snapshot::Task_Type::PROJECT:
+                task = CreateTask<Project_Task>(m_factory, title, description, priority);
+                break;
+            case Snapshot::Task_Type::RECURRING: {
+                std::uint8_t pattern = in.Byte();
+                std::uint64_t interval = in.Varint();
+                std::uint64_t occurrences = in.Varint();
+                std::int64_t next_occurrence = ZigZagDecode(in.Varint());
+                std::uint64_t anchor_day = in.Varint();
+                if (in.failed || pattern > static_cast<std::uint8_t>(Recurring_Task::RecurrencePattern::YEARLY) ||
+                    anchor_day < 1 || anchor_day > 31) {
+                    return false;
+                }
+                Recurring_Task* recurring = CreateTask<Recurring_Task>(
+                    m_factory, title, description, priority,
+                    static_cast<Recurring_Task::RecurrencePattern>(pattern), static_cast<int>(interval));
+                recurring->m_occurrences_completed = static_cast<int>(occurrences);
+                recurring->_SetNextOccurrence(std::chrono::system_clock::time_point(
+                    std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                        std::chrono::nanoseconds(next_occurrence))));
+                recurring->m_anchor_day = static_cast<int>(anchor_day);
+                task = recurring;
+                break;
+            }
+            case Snapshot::Task_Type::DEADLINE: {
+                std::int64_t day_number = ZigZagDecode(in.Varint());
+                if (in.failed) {
+                    return false;
+                }
+                task = CreateTask<Deadline_Task>(m_factory, title, description, priority,
+                                                 Date::FromDayNumber(static_cast<int>(day_number)));
+                break;
+            }
+        }
+        if (!task) {
+            return false;
+        }
+
+        task->m_id = Entity_Id(Entity_Kind::TASK, number);
+        task->m_creation_sequence = creation_sequence;
+        Task::_ResumeCreationSequence(creation_sequence);
+        m_tasks[number] = task;
+        m_graph.tasks.push_back(task);
+        m_highest_created = std::max(m_highest_created, number);
+        return true;
+    }
+};
+
+Mutation_Log::Mutation_Log()
+    : m_fd(-1),
+      m_durability(Durability::SYNC),
+      m_appended_sequence(0),
+      m_durable_sequence(0),
+      m_stopping(false),
+      m_failed(false) {
+    // Jurnalul este închis până la Open()
+}
+
+Mutation_Log::~Mutation_Log() {
+    Close();
+}
+
+bool Mutation_Log::Open(const std::string& path, Durability durability) {
+    Close();
+
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (fd < 0) {
+        return false;
+    }
+
+    // Un fișier nou primește antetul; unul existent trebuie să fie un jurnal
+    struct stat info;
+    bool ok = ::fstat(fd, &info) == 0;
+    if (ok && info.st_size == 0) {
+        ok = ::write(fd, MAGIC, sizeof(MAGIC)) == static_cast<ssize_t>(sizeof(MAGIC)) && ::fdatasync(fd) == 0;
+    } else if (ok) {
+        char magic[sizeof(MAGIC)];
+        ok = ::pread(fd, magic, sizeof(magic), 0) == static_cast<ssize_t>(sizeof(magic)) &&
+             std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+    }
+    if (!ok) {
+        ::close(fd);
+        return false;
+    }
+
+    m_fd = fd;
+    m_durability = durability;
+    m_appended_sequence = 0;
+    m_durable_sequence = 0;
+    m_stopping = false;
+    m_failed = false;
+    m_flusher = std::thread(&Mutation_Log::_FlusherLoop, this);
+    Task::AddObserver(this);
+    return true;
+}
+
+void Mutation_Log::Close() {
+    if (m_fd < 0) {
+        return;
+    }
+    Task::RemoveObserver(this);
+
+    // Firul de scriere golește m_pending înainte să se oprească
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_has_work.notify_one();
+    m_flusher.join();
+
+    ::close(m_fd);
+    m_fd = -1;
+}
+
+bool Mutation_Log::IsOpen() const {
+    return m_fd >= 0;
+}
+
+void Mutation_Log::OnTaskChanged(const Task& task, Task_Change change, const Entity_Id& related) {
+    // Distrugerea unei copii nu șterge originalul, care are același ID
+    if (change == Task_Change::DELETED && task.m_is_copy) {
+        return;
+    }
+
+    // Înregistrarea se construiește în afara lacătului, într-un buffer refolosit de fiecare fir
+    static thread_local std::string record;
+    record.assign(RECORD_HEADER_SIZE, '\0');
+    record.push_back(static_cast<char>(change));
+    AppendVarint(record, task.GetId().GetNumber());
+    switch (change) {
+        case Task_Change::TITLE:
+            AppendString(record, task.GetTitle());
+            break;
+        case Task_Change::DESCRIPTION:
+            AppendString(record, task.GetDescription());
+            break;
+        case Task_Change::PRIORITY:
+            record.push_back(static_cast<char>(task.GetPriority()));
+            break;
+        case Task_Change::STATUS:
+            record.push_back(static_cast<char>(task.GetStatus()));
+            break;
+        case Task_Change::DEADLINE: {
+            std::int64_t day_number = static_cast<const Deadline_Task&>(task).GetDeadline().GetDayNumber();
+            AppendVarint(record, ZigZagEncode(day_number));
+            break;
+        }
+        case Task_Change::CREATED:
+            // Tipurile de sarcini necunoscute formatului snapshot nu pot fi recreate
+            if (!_AppendCreated(record, task)) {
+                return;
+            }
+            break;
+        case Task_Change::DELETED:
+            break;
+        default:
+            AppendVarint(record, related.GetNumber());
+            break;
+    }
+
+    // Antetul: dimensiunea datelor și suma lor de control
+    std::uint32_t size = static_cast<std::uint32_t>(record.size() - RECORD_HEADER_SIZE);
+    StoreFixed32(&record[0], size);
+    StoreFixed32(&record[4], RecordChecksum(record.data() + RECORD_HEADER_SIZE, size));
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_has_space.wait(lock, [this]() { return m_pending.size() < MAX_PENDING_SIZE || m_failed; });
+    bool was_idle = m_pending.empty();
+    m_pending.insert(m_pending.end(), record.begin(), record.end());
+    std::uint64_t sequence = ++m_appended_sequence;
+
+    // Firul de scriere așteaptă doar când nu are nimic de scris
+    if (was_idle) {
+        m_has_work.notify_one();
+    }
+    if (m_durability == Durability::SYNC) {
+        m_durable.wait(lock, [this, sequence]() { return m_durable_sequence >= sequence || m_failed; });
+    }
+}
+
+bool Mutation_Log::_AppendCreated(std::string& record, const Task& task) {
+    // Tipul și câmpurile constructorului, numărul de ordine al creării, plus aparițiile
+    // calculate de Recurring_Task, care depind de momentul creării; starea inițială
+    // este NOT_STARTED
+    const std::type_info& type = typeid(task);
+    Snapshot::Task_Type task_type;
+    if (type == typeid(Simple_Task)) {
+        task_type = Snapshot::Task_Type::SIMPLE;
+    } else if (type == typeid(Project_Task)) {
+        task_type = Snapshot::Task_Type::PROJECT;
+    } else if (type == typeid(Recurring_Task)) {
+        task_type = Snapshot::Task_Type::RECURRING;
+    } else if (type == typeid(Deadline_Task)) {
+        task_type = Snapshot::Task_Type::DEADLINE;
+    } else {
+        return false;
+    }
+
+    record.push_back(static_cast<char>(task_type));
+    AppendString(record, task.GetTitle());
+    AppendString(record, task.GetDescription());
+    record.push_back(static_cast<char>(task.GetPriority()));
+    AppendVarint(record, task.GetCreationSequence());
+    if (task_type == Snapshot::Task_Type::RECURRING) {
+        const Recurring_Task& recurring = static_cast<const Recurring_Task&>(task);
+        record.push_back(static_cast<char>(recurring.m_pattern));
+        AppendVarint(record, static_cast<std::uint64_t>(recurring.m_interval));
+        AppendVarint(record, static_cast<std::uint64_t>(recurring.m_occurrences_completed));
+        AppendVarint(record, ZigZagEncode(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            recurring.m_next_occurrence.time_since_epoch()).count()));
+        AppendVarint(record, static_cast<std::uint64_t>(recurring.m_anchor_day));
+    } else if (task_type == Snapshot::Task_Type::DEADLINE) {
+        AppendVarint(record, ZigZagEncode(static_cast<const Deadline_Task&>(task).GetDeadline().GetDayNumber()));
+    }
+    return true;
+}
+
+std::uint64_t Mutation_Log::GetLastSequence() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_appended_sequence;
+}
+
+bool Mutation_Log::WaitDurable(std::uint64_t sequence) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_fd < 0) {
+        return m_durable_sequence >= sequence;
+    }
+    m_durable.wait(lock, [this, sequence]() { return m_durable_sequence >= sequence || m_failed; });
+    return m_durable_sequence >= sequence;
+}
+
+bool Mutation_Log::Flush() {
+    return WaitDurable(GetLastSequence());
+}
+
+bool Mutation_Log::Reset() {
+    if (m_fd < 0 || !Flush()) {
+        return false;
+    }
+
+    // Păstrăm doar antetul; scrierile cu O_APPEND continuă după el
+    std::lock_guard<std::mutex> io_lock(m_io_mutex);
+    return ::ftruncate(m_fd, static_cast<off_t>(sizeof(MAGIC))) == 0 && ::fdatasync(m_fd) == 0;
+}
+
+bool Mutation_Log::HasFailed() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_failed;
+}
+
+void Mutation_Log::_FlusherLoop() {
+    std::vector<char> batch;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_has_work.wait(lock, [this]() { return !m_pending.empty() || m_stopping; });
+        if (m_pending.empty()) {
+            break;
+        }
+
+        // Preluăm tot ce s-a acumulat; înregistrările noi se adună pentru lotul următor
+        bool was_full = m_pending.size() >= MAX_PENDING_SIZE;
+        batch.swap(m_pending);
+        if (was_full) {
+            m_has_space.notify_all();
+        }
+        std::uint64_t target = m_appended_sequence;
+        bool failed = m_failed;
+        lock.unlock();
+
+        bool ok = false;
+        if (!failed) {
+            std::lock_guard<std::mutex> io_lock(m_io_mutex);
+            ok = true;
+            const char* data = batch.data();
+            size_t remaining = batch.size();
+            while (ok && remaining > 0) {
+                ssize_t written = ::write(m_fd, data, remaining);
+                if (written < 0 && errno == EINTR) {
+                    continue;
+                }
+                ok = written > 0;
+                data += ok ? written : 0;
+                remaining -= ok ? static_cast<size_t>(written) : 0;
+            }
+            ok = ok && ::fdatasync(m_fd) == 0;
+        }
+        batch.clear();
+
+        lock.lock();
+        // După o eroare, confirmările se opresc: lotul pierdut ar lăsa o gaură în jurnal
+        if (ok) {
+            m_durable_sequence = target;
+        } else {
+            m_failed = true;
+        }
+        m_durable.notify_all();
+    }
+}
+
+bool Mutation_Log::Replay(const std::string& path, Task_Graph& graph, Task_Factory* factory, size_t* applied,
+                          size_t* skipped) {
+    if (applied) {
+        *applied = 0;
+    }
+    if (skipped) {
+        *skipped = 0;
+    }
+
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        return errno == ENOENT;  // Un jurnal inexistent este un jurnal gol
+    }
+    std::vector<unsigned char> data;
+    unsigned char buffer[1 << 16];
+    size_t read_size;
+    while ((read_size = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        data.insert(data.end(), buffer, buffer + read_size);
+    }
+    bool read_ok = !std::ferror(file);
+    std::fclose(file);
+    if (!read_ok) {
+        return false;
+    }
+    if (data.empty()) {
+        return true;
+    }
+    if (data.size() < sizeof(MAGIC) || std::memcmp(data.data(), MAGIC, sizeof(MAGIC)) != 0) {
+        return false;
+    }
+
+    Replayer replayer(graph, factory);
+    size_t pos = sizeof(MAGIC);
+    while (data.size() - pos >= RECORD_HEADER_SIZE) {
+        std::uint32_t size = LoadFixed32(&data[pos]);
+        std::uint32_t checksum = LoadFixed32(&data[pos + 4]);
+        if (size > MAX_RECORD_SIZE || size > data.size() - pos - RECORD_HEADER_SIZE) {
+            break;
+        }
+        const unsigned char* payload = &data[pos + RECORD_HEADER_SIZE];
+        if (RecordChecksum(reinterpret_cast<const char*>(payload), size) != checksum) {
+            break;
+        }
+
+        Replayer::Outcome outcome;
+        if (!replayer.Apply(payload, size, outcome)) {
+            break;
+        }
+        if (outcome == Replayer::Outcome::APPLIED && applied) {
+            ++*applied;
+        } else if (outcome == Replayer::Outcome::SKIPPED && skipped) {
+            ++*skipped;
+        }
+        pos += RECORD_HEADER_SIZE + size;
+    }
+    replayer.Finish();
+
+    // Eliminăm finalul incomplet, pentru ca înregistrările noi să urmeze celor valide
+    if (pos != data.size()) {
+        return ::truncate(path.c_str(), static_cast<off_t>(pos)) == 0;
+    }
+    return true;
+}
+
+} // namespace Task_Management
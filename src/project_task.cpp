@@ -1,29 +1,99 @@
 #include "project_task.h"
+#include "work_stealing_pool.h"
 #include <iostream>
 #include <algorithm>
 
 namespace Task_Management {
 
+namespace {
+
+// Epoca globală a recalculărilor; fiecare apel RecomputeRollup folosește o valoare nouă
+std::atomic<unsigned> s_rollup_epoch(0);
+
+// Intervalele de sub-sarcini mai mari decât atât sunt împărțite în jumătăți
+const size_t RANGE_GRAIN = 64;
+
+} // namespace
+
+/**
+ * Totalurile parțiale ale unui interval de sub-sarcini
+ */
+struct Project_Task::Subtask_Totals {
+    double percentage_sum;        // Suma procentelor sub-sarcinilor directe
+    size_t completed_subtasks;    // Sub-sarcini directe finalizate
+    size_t task_count;            // Sarcini din subarborii sub-sarcinilor
+    size_t completed_task_count;  // Sarcini finalizate din acești subarbori
+    size_t leaf_count;            // Frunze din acești subarbori
+    size_t max_depth;             // Adâncimea maximă a acestor subarbori
+    
+    Subtask_Totals()
+        : percentage_sum(0.0), completed_subtasks(0), task_count(0),
+          completed_task_count(0), leaf_count(0), max_depth(0) {}
+    
+    void Add(const Rollup_Stats& stats) {
+        percentage_sum += stats.completion_percentage;
+        completed_subtasks += stats.is_completed ? 1 : 0;
+        task_count += stats.task_count;
+        completed_task_count += stats.completed_task_count;
+        leaf_count += stats.leaf_count;
+        max_depth = std::max(max_depth, stats.max_depth);
+    }
+    
+    void Merge(const Subtask_Totals& other) {
+        percentage_sum += other.percentage_sum;
+        completed_subtasks += other.completed_subtasks;
+        task_count += other.task_count;
+        completed_task_count += other.completed_task_count;
+        leaf_count += other.leaf_count;
+        max_depth = std::max(max_depth, other.max_depth);
+    }
+};
+
+// Definiția membrului static constant (necesară dacă este folosit prin referință)
+const size_t Project_Task::DEFAULT_SERIAL_THRESHOLD;
+
 Project_Task::Project_Task(const std::string& title, const std::string& description, Priority priority)
-    : Task(title, description, priority) {
+    : Task(title, description, priority),
+      m_completion_sum(0.0),
+      m_completed_subtasks(0),
+      m_subtree_task_count(1),
+      m_rollup_epoch(0) {
     // Apelăm constructorul clasei de bază (Task) cu parametrii primiți
     // Nu avem inițializări suplimentare pentru m_subtasks deoarece vectorul este gol la început
+    _NotifyObservers(Task_Change::CREATED);
 }
 
 Project_Task::Project_Task(const Project_Task& other)
-    : Task(other) {
+    : Task(other),
+      m_subtasks(other.m_subtasks),
+      m_completion_sum(other.m_completion_sum),
+      m_completed_subtasks(other.m_completed_subtasks),
+      m_subtree_task_count(other.m_subtree_task_count),
+      m_rollup_epoch(0) {
     // Apelăm constructorul de copiere al clasei de bază
     
     // Notă importantă: Aceasta este o copiere superficială (shallow copy) a pointerilor
     // În implementarea reală, ar trebui să facem o copiere profundă (deep copy)
     // clonând fiecare sub-sarcină pentru a evita probleme de ownership
-    m_subtasks = other.m_subtasks;
+    
+    // Copia devine și ea părinte al sub-sarcinilor, pentru a primi actualizările lor.
+    // Sub-sarcinile au deja originalul ca părinte, deci valorile lor raportate sunt la zi
+    for (Task* subtask : m_subtasks.GetTasks()) {
+        subtask->m_parent_projects.push_back(this);
+    }
 }
 
 Project_Task::~Project_Task() {
     // Implementarea destructorului
-    // În implementarea reală, dacă deținem sub-sarcinile, ar trebui să le ștergem aici
-    // Dar pentru simplitate, presupunem ownership partajat
+    // Mai întâi ne eliminăm din proiectele părinte cât timp obiectul este încă un
+    // Project_Task, pentru ca părinții să scadă dimensiunea întregului subarbore
+    _DetachFromParentProjects();
+    
+    // Nu deținem sub-sarcinile (ownership partajat), dar trebuie să ne eliminăm
+    // din lista lor de părinți pentru ca ele să nu ne mai anunțe schimbările
+    for (Task* subtask : m_subtasks.GetTasks()) {
+        _UnlinkFrom(subtask);
+    }
 }
 
 void Project_Task::DisplayDetails() const {
@@ -33,13 +103,14 @@ void Project_Task::DisplayDetails() const {
     std::cout << "============================" << std::endl;
     
     // Afișează sub-sarcinile
-    if (!m_subtasks.empty()) {
+    const std::vector<Task*>& subtasks = m_subtasks.GetTasks();
+    if (!subtasks.empty()) {
         std::cout << "Subtasks:" << std::endl;
-        for (size_t i = 0; i < m_subtasks.size(); ++i) {
+        for (size_t i = 0; i < subtasks.size(); ++i) {
             // Afișăm informații despre fiecare sub-sarcină
-            std::cout << "  " << (i + 1) << ". " << m_subtasks[i]->GetTitle() 
-                      << " [" << m_subtasks[i]->GetTaskType() << "]" 
-                      << " - " << (m_subtasks[i]->IsCompleted() ? "Completed" : "Not Completed")
+            std::cout << "  " << (i + 1) << ". " << subtasks[i]->GetTitle() 
+                      << " [" << subtasks[i]->GetTaskType() << "]" 
+                      << " - " << (subtasks[i]->IsCompleted() ? "Completed" : "Not Completed")
                       << std::endl;
         }
     }
@@ -54,67 +125,96 @@ bool Project_Task::IsCompleted() const {
     // Verifică dacă proiectul este finalizat
     
     // Dacă nu există sub-sarcini, verificăm statusul proiectului în sine
-    if (m_subtasks.empty()) {
+    if (m_subtasks.IsEmpty()) {
         return GetStatus() == TaskStatus::COMPLETED;
     }
     
     // Un proiect este finalizat doar dacă toate sub-sarcinile sunt finalizate
-    // std::all_of este o funcție din STL care verifică dacă toate elementele
-    // din interval satisfac o condiție (predicat)
-    return std::all_of(m_subtasks.begin(), m_subtasks.end(), 
-                      [](const Task* task) { return task->IsCompleted(); });
+    // Numărul de sub-sarcini finalizate este păstrat în cache și actualizat incremental
+    return m_completed_subtasks == m_subtasks.Size();
 }
 
 double Project_Task::GetCompletionPercentage() const {
     // Calculează procentul de finalizare al proiectului
     
     // Dacă nu există sub-sarcini, verificăm statusul proiectului în sine
-    if (m_subtasks.empty()) {
+    if (m_subtasks.IsEmpty()) {
         return (GetStatus() == TaskStatus::COMPLETED) ? 100.0 : 0.0;
     }
     
-    // Calculăm procentul mediu de finalizare al tuturor sub-sarcinilor
-    double total_percentage = 0.0;
-    for (const auto& subtask : m_subtasks) {
-        total_percentage += subtask->GetCompletionPercentage();
-    }
-    
-    // Returnăm media
-    return total_percentage / m_subtasks.size();
+    // Procentul mediu de finalizare al sub-sarcinilor, din suma păstrată în cache
+    return m_completion_sum / m_subtasks.Size();
 }
 
 void Project_Task::AddSubtask(Task* subtask) {
     // Adaugă o sub-sarcină la proiect dacă pointerul nu este null
-    if (subtask) {
-        m_subtasks.push_back(subtask);
+    if (!subtask) {
+        return;
     }
+    
+    m_subtasks.Add(subtask);
+    _AttachSubtask(subtask);
+    
+    // Finalizarea și dimensiunea proiectului s-au putut schimba
+    size_t added_count = _SubtreeTaskCountOf(subtask);
+    m_subtree_task_count += added_count;
+    _NotifyParentProjects(static_cast<std::ptrdiff_t>(added_count));
+    _NotifyObservers(Task_Change::SUBTASK_ADDED, subtask->GetId());
 }
 
-bool Project_Task::RemoveSubtask(const std::string& subtask_id) {
-    // Caută sub-sarcina cu ID-ul specificat
-    // std::find_if este o funcție din STL care găsește primul element
-    // din interval care satisface o condiție (predicat)
-    auto it = std::find_if(m_subtasks.begin(), m_subtasks.end(),
-                          [&subtask_id](const Task* task) { return task->GetId() == subtask_id; });
-    
-    // Dacă am găsit sub-sarcina, o eliminăm și returnăm true
-    if (it != m_subtasks.end()) {
-        m_subtasks.erase(it);
-        return true;
+bool Project_Task::RemoveSubtask(const Entity_Id& subtask_id) {
+    // Eliminăm sub-sarcina cu ID-ul specificat
+    // Colecția decide dacă folosește căutarea liniară sau indexul după ID
+    Task* removed = m_subtasks.Extract(subtask_id);
+    if (!removed) {
+        return false;
     }
     
-    // Dacă nu am găsit sub-sarcina, returnăm false
-    return false;
+    _UnlinkFrom(removed);
+    _SubtractContribution(removed);
+    
+    size_t removed_count = _SubtreeTaskCountOf(removed);
+    m_subtree_task_count -= removed_count;
+    _NotifyParentProjects(-static_cast<std::ptrdiff_t>(removed_count));
+    _NotifyObservers(Task_Change::SUBTASK_REMOVED, subtask_id);
+    return true;
 }
 
 const std::vector<Task*>& Project_Task::GetSubtasks() const {
     // Returnează toate sub-sarcinile
-    return m_subtasks;
+    return m_subtasks.GetTasks();
+}
+
+void Project_Task::SetStorageMode(Task_Collection::Storage_Mode mode) {
+    // Setează modul de stocare al sub-sarcinilor
+    m_subtasks.SetStorageMode(mode);
 }
 
 size_t Project_Task::GetSubtaskCount() const {
     // Returnează numărul de sub-sarcini
-    return m_subtasks.size();
+    return m_subtasks.Size();
+}
+
+size_t Project_Task::GetCompletedSubtaskCount() const {
+    // Returnează numărul de sub-sarcini finalizate, păstrat în cache
+    return m_completed_subtasks;
+}
+
+size_t Project_Task::GetSubtreeTaskCount() const {
+    // Returnează dimensiunea subarborelui, păstrată în cache
+    return m_subtree_task_count;
+}
+
+Rollup_Stats Project_Task::RecomputeRollup(Work_Stealing_Pool* pool, size_t serial_threshold) {
+    // O epocă nouă marchează proiectele încă nerecalculate în acest apel
+    unsigned epoch = s_rollup_epoch.fetch_add(1) + 1;
+    
+    std::ptrdiff_t old_count = static_cast<std::ptrdiff_t>(m_subtree_task_count);
+    Rollup_Stats stats = _Recompute(pool, serial_threshold, epoch, false);
+    
+    // Proiectele părinte primesc diferența față de valorile raportate anterior
+    _NotifyParentProjects(static_cast<std::ptrdiff_t>(m_subtree_task_count) - old_count);
+    return stats;
 }
 
 Project_Task Project_Task::operator+(const Project_Task& other) const {
@@ -123,7 +223,7 @@ Project_Task Project_Task::operator+(const Project_Task& other) const {
     Project_Task combined(*this);
     
     // Adăugăm toate sub-sarcinile din celălalt proiect
-    for (const auto& subtask : other.m_subtasks) {
+    for (const auto& subtask : other.m_subtasks.GetTasks()) {
         combined.AddSubtask(subtask);
     }
     
@@ -136,8 +236,180 @@ void Project_Task::_WriteDetailsToStream(std::ostream& os) const {
     
     // Apoi adăugăm detaliile specifice acestei clase
     os << "Type: Project Task\n";
-    os << "Subtasks: " << m_subtasks.size() << "\n";
+    os << "Subtasks: " << m_subtasks.Size() << "\n";
     os << "Completion: " << GetCompletionPercentage() << "%\n";
 }
 
+void Project_Task::_AttachSubtask(Task* subtask) {
+    // Dacă sub-sarcina nu avea părinți, valorile ei raportate nu sunt la zi
+    if (subtask->m_parent_projects.empty()) {
+        subtask->m_reported_percentage = subtask->GetCompletionPercentage();
+        subtask->m_reported_completed = subtask->IsCompleted();
+    }
+    subtask->m_parent_projects.push_back(this);
+    
+    // Adăugăm contribuția sub-sarcinii la agregate
+    m_completion_sum += subtask->m_reported_percentage;
+    if (subtask->m_reported_completed) {
+        ++m_completed_subtasks;
+    }
+}
+
+void Project_Task::_OnSubtaskChanged(double delta_percentage, int delta_completed, std::ptrdiff_t delta_task_count) {
+    // Actualizăm agregatele în O(1), apoi anunțăm la rândul nostru proiectele părinte
+    m_completion_sum += delta_percentage;
+    m_completed_subtasks += delta_completed;
+    m_subtree_task_count += delta_task_count;
+    _NotifyParentProjects(delta_task_count);
+}
+
+void Project_Task::_OnSubtaskDestroyed(Task* subtask) {
+    // Sub-sarcina s-a eliminat deja din lista ei de părinți; o scoatem din colecție
+    if (m_subtasks.Remove(subtask)) {
+        _SubtractContribution(subtask);
+        
+        size_t removed_count = _SubtreeTaskCountOf(subtask);
+        m_subtree_task_count -= removed_count;
+        _NotifyParentProjects(-static_cast<std::ptrdiff_t>(removed_count));
+    }
+}
+
+void Project_Task::_SubtractContribution(const Task* subtask) {
+    if (m_subtasks.IsEmpty()) {
+        // Fără sub-sarcini resetăm exact agregatele, evitând erorile de rotunjire acumulate
+        m_completion_sum = 0.0;
+        m_completed_subtasks = 0;
+        return;
+    }
+    
+    m_completion_sum -= subtask->m_reported_percentage;
+    if (subtask->m_reported_completed) {
+        --m_completed_subtasks;
+    }
+}
+
+void Project_Task::_UnlinkFrom(Task* subtask) {
+    std::vector<Project_Task*>& parents = subtask->m_parent_projects;
+    auto it = std::find(parents.begin(), parents.end(), this);
+    if (it != parents.end()) {
+        parents.erase(it);
+    }
+}
+
+size_t Project_Task::_SubtreeTaskCountOf(const Task* subtask) {
+    // Din destructorul lui Task tipul dinamic este deja Task, deci sarcina contează ca 1;
+    // proiectele se elimină singure din părinți înainte de acest moment
+    const Project_Task* project = dynamic_cast<const Project_Task*>(subtask);
+    return project ? project->m_subtree_task_count : 1;
+}
+
+Rollup_Stats Project_Task::_Recompute(Work_Stealing_Pool* pool, size_t serial_threshold,
+                                      unsigned epoch, bool update_reported) {
+    // Doar firul care revendică proiectul în această epocă îi citește și scrie agregatele;
+    // dacă proiectul apare de mai multe ori, celelalte fire doar calculează rezultatul
+    bool is_owner = m_rollup_epoch.exchange(epoch) != epoch;
+    
+    Rollup_Stats stats;
+    const std::vector<Task*>& subtasks = m_subtasks.GetTasks();
+    if (subtasks.empty()) {
+        // Proiect fără sub-sarcini: contează ca o frunză, după propriul status
+        stats.is_completed = GetStatus() == TaskStatus::COMPLETED;
+        stats.completion_percentage = stats.is_completed ? 100.0 : 0.0;
+        stats.task_count = 1;
+        stats.completed_task_count = stats.is_completed ? 1 : 0;
+        stats.leaf_count = 1;
+        stats.max_depth = 1;
+    } else {
+        // Subarborii mici sunt evaluați serial: costul lucrărilor noi ar depăși câștigul
+        bool is_large = is_owner && m_subtree_task_count >= serial_threshold;
+        Subtask_Totals totals;
+        _RecomputeRange(subtasks.data(), subtasks.size(), is_large ? pool : nullptr,
+                        serial_threshold, epoch, totals);
+        
+        stats.completion_percentage = totals.percentage_sum / subtasks.size();
+        stats.is_completed = totals.completed_subtasks == subtasks.size();
+        stats.task_count = totals.task_count + 1;
+        stats.completed_task_count = totals.completed_task_count + (stats.is_completed ? 1 : 0);
+        stats.leaf_count = totals.leaf_count;
+        stats.max_depth = totals.max_depth + 1;
+        
+        if (is_owner) {
+            m_completion_sum = totals.percentage_sum;
+            m_completed_subtasks = totals.completed_subtasks;
+        }
+    }
+    
+    if (is_owner) {
+        m_subtree_task_count = stats.task_count;
+        if (update_reported) {
+            // Părintele folosește deja aceste valori noi în propriile agregate
+            m_reported_percentage = stats.completion_percentage;
+            m_reported_completed = stats.is_completed;
+        }
+    }
+    return stats;
+}
+
+void Project_Task::_RecomputeRange(Task* const* subtasks, size_t count, Work_Stealing_Pool* pool,
+                                   size_t serial_threshold, unsigned epoch, Subtask_Totals& totals) {
+    // Intervalele mari se împart în două: prima jumătate devine o lucrare pe care
+    // alte fire o pot fura, iar a doua este evaluată de firul curent
+    if (pool && count > RANGE_GRAIN && pool->ShouldSplit()) {
+        size_t half = count / 2;
+        Subtask_Totals first_half;
+        Work_Stealing_Pool::Job_Group group;
+        pool->Run(group, [=, &first_half] {
+            _RecomputeRange(subtasks, half, pool, serial_threshold, epoch, first_half);
+        });
+        _RecomputeRange(subtasks + half, count - half, pool, serial_threshold, epoch, totals);
+        pool->Wait(group);
+        totals.Merge(first_half);
+        return;
+    }
+    
+    // Într-un interval mic, sub-proiectele pot deveni lucrări separate cât timp
+    // celelalte fire au nevoie de lucru (ex: arbori binari adânci)
+    bool can_fork = pool && count <= RANGE_GRAIN;
+    Work_Stealing_Pool::Job_Group group;
+    std::vector<Rollup_Stats> forked;  // Rezultatele sub-proiectelor evaluate de alte lucrări
+    
+    for (size_t i = 0; i < count; ++i) {
+        Project_Task* project = dynamic_cast<Project_Task*>(subtasks[i]);
+        if (!project) {
+            // Sarcinile simple contribuie cu valorile deja raportate părinților
+            Rollup_Stats leaf;
+            leaf.completion_percentage = subtasks[i]->m_reported_percentage;
+            leaf.is_completed = subtasks[i]->m_reported_completed;
+            leaf.task_count = 1;
+            leaf.completed_task_count = leaf.is_completed ? 1 : 0;
+            leaf.leaf_count = 1;
+            leaf.max_depth = 1;
+            totals.Add(leaf);
+            continue;
+        }
+        
+        if (can_fork && pool->ShouldSplit()) {
+            // Rezervăm tot spațiul de la început, ca adresele rezultatelor să rămână valide
+            if (forked.empty()) {
+                forked.reserve(count);
+            }
+            forked.push_back(Rollup_Stats());
+            Rollup_Stats* result = &forked.back();
+            pool->Run(group, [=] {
+                *result = project->_Recompute(pool, serial_threshold, epoch, true);
+            });
+            continue;
+        }
+        
+        totals.Add(project->_Recompute(pool, serial_threshold, epoch, true));
+    }
+    
+    if (!forked.empty()) {
+        pool->Wait(group);
+        for (const Rollup_Stats& result : forked) {
+            totals.Add(result);
+        }
+    }
+}
+
 } // namespace Task_Management
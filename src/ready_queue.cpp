@@ -0,0 +1,294 @@
+#include "ready_queue.h"
+#include "task.h"
+#include "deadline_task.h"
+#include "date.h"
+#include <algorithm>
+
+namespace Task_Management {
+
+namespace {
+
+/**
+ * Sarcinile finalizate, anulate sau amânate nu pot fi lucrate
+ */
+bool IsReady(const Task& task) {
+    TaskStatus status = task.GetStatus();
+    return status != TaskStatus::COMPLETED && status != TaskStatus::CANCELLED && status != TaskStatus::DEFERRED;
+}
+
+/**
+ * Ziua folosită pentru sarcinile fără termen limită (după orice termen)
+ */
+const std::uint32_t NO_DEADLINE = 0xFFFFFFFFu;
+
+/**
+ * Calculează prima parte a cheii: prioritatea inversată în biții superiori, iar sub ea
+ * ziua termenului, deplasată astfel încât ordinea fără semn să fie ordinea zilelor
+ */
+std::uint64_t RankOf(const Task& task) {
+    std::uint64_t priority = static_cast<std::uint64_t>(Priority::URGENT) - static_cast<std::uint64_t>(task.GetPriority());
+    std::uint32_t day = NO_DEADLINE;
+    const Deadline_Task* deadline_task = dynamic_cast<const Deadline_Task*>(&task);
+    if (deadline_task) {
+        day = static_cast<std::uint32_t>(deadline_task->GetDeadline().GetDayNumber()) ^ 0x80000000u;
+    }
+    return (priority << 32) | day;
+}
+
+} // namespace
+
+Ready_Queue::Ready_Queue() {
+    Task::AddObserver(this);
+}
+
+Ready_Queue::~Ready_Queue() {
+    Task::RemoveObserver(this);
+}
+
+bool Ready_Queue::Add(Task* task) {
+    if (!task) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto inserted = m_slots.emplace(task, Slot());
+    if (!inserted.second) {
+        return false;
+    }
+    if (_Place(task, &inserted.first->second)) {
+        _SiftUp(m_heap.size() - 1);
+    }
+    return true;
+}
+
+size_t Ready_Queue::AddTasks(const std::vector<Task*>& tasks) {
+    size_t added = 0;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_slots.reserve(m_slots.size() + tasks.size());
+    m_heap.reserve(m_heap.size() + tasks.size());
+    for (Task* task : tasks) {
+        if (!task) {
+            continue;
+        }
+        auto inserted = m_slots.emplace(task, Slot());
+        if (inserted.second) {
+            _Place(task, &inserted.first->second);
+            ++added;
+        }
+    }
+
+    // Reconstruirea heap-ului de jos în sus costă O(n), față de O(n log n) la inserări
+    for (size_t slot = m_heap.size() / 2; slot-- > 0;) {
+        _SiftDown(slot);
+    }
+    return added;
+}
+
+bool Ready_Queue::Remove(Task* task) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_slots.find(task);
+    if (it == m_slots.end()) {
+        return false;
+    }
+    _Unplace(it->second);
+    m_slots.erase(it);
+    return true;
+}
+
+bool Ready_Queue::Contains(const Task* task) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slots.count(task) != 0;
+}
+
+size_t Ready_Queue::Size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_heap.size() + m_inactive.size();
+}
+
+size_t Ready_Queue::GetReadyCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_heap.size();
+}
+
+Task* Ready_Queue::Peek() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_heap.empty() ? nullptr : m_heap.front().task;
+}
+
+Task* Ready_Queue::Pop() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_heap.empty()) {
+        return nullptr;
+    }
+    Task* task = m_heap.front().task;
+    _Unplace(*m_heap.front().slot);
+    m_slots.erase(task);
+    return task;
+}
+
+std::vector<Task*> Ready_Queue::GetNext(size_t count) const {
+    std::vector<Task*> result;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    count = std::min(count, m_heap.size());
+    if (count == 0) {
+        return result;
+    }
+    result.reserve(count);
+
+    // Candidații sunt pozițiile din heap ai căror părinți au fost deja întorși;
+    // un heap mic de candidați dă următorul element fără a modifica coada
+    auto after = [this](size_t a, size_t b) {
+        return _Before(m_heap[b], m_heap[a]);
+    };
+    std::vector<size_t> candidates(1, 0);
+    while (result.size() < count) {
+        std::pop_heap(candidates.begin(), candidates.end(), after);
+        size_t slot = candidates.back();
+        candidates.pop_back();
+        result.push_back(m_heap[slot].task);
+        for (size_t child = 2 * slot + 1; child <= 2 * slot + 2 && child < m_heap.size(); ++child) {
+            candidates.push_back(child);
+            std::push_heap(candidates.begin(), candidates.end(), after);
+        }
+    }
+    return result;
+}
+
+void Ready_Queue::OnTaskChanged(const Task& task, Task_Change change, const Entity_Id& related) {
+    (void)related;
+    if (change != Task_Change::PRIORITY && change != Task_Change::STATUS && change != Task_Change::DEADLINE &&
+        change != Task_Change::DELETED) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_slots.find(&task);
+    if (it == m_slots.end()) {
+        return;
+    }
+    Slot& position = it->second;
+    if (change == Task_Change::DELETED) {
+        // Sarcina este distrusă: coada nu trebuie să păstreze pointerul
+        _Unplace(position);
+        m_slots.erase(it);
+        return;
+    }
+
+    // Coada a primit sarcina ca pointer ne-constant la Add, deci o poate muta
+    Task* queued = const_cast<Task*>(&task);
+    bool ready = IsReady(*queued);
+    if (ready != position.active) {
+        _Unplace(position);
+        if (_Place(queued, &position)) {
+            _SiftUp(m_heap.size() - 1);
+        }
+        return;
+    }
+    if (!ready) {
+        return;  // Sarcina rămâne deoparte
+    }
+
+    // Doar cheia s-a schimbat: sarcina urcă sau coboară din poziția ei
+    size_t slot = position.index;
+    std::uint64_t rank = RankOf(*queued);
+    if (rank == m_heap[slot].rank) {
+        return;
+    }
+    bool up = rank < m_heap[slot].rank;
+    m_heap[slot].rank = rank;
+    if (up) {
+        _SiftUp(slot);
+    } else {
+        _SiftDown(slot);
+    }
+}
+
+bool Ready_Queue::_Place(Task* task, Slot* slot) {
+    Entry entry;
+    entry.rank = 0;
+    entry.age = task->GetCreationSequence();
+    entry.task = task;
+    entry.slot = slot;
+    slot->active = IsReady(*task);
+    if (!slot->active) {
+        slot->index = static_cast<std::uint32_t>(m_inactive.size());
+        m_inactive.push_back(entry);
+        return false;
+    }
+    entry.rank = RankOf(*task);
+    slot->index = static_cast<std::uint32_t>(m_heap.size());
+    m_heap.push_back(entry);
+    return true;
+}
+
+void Ready_Queue::_Unplace(const Slot& position) {
+    size_t slot = position.index;
+    if (!position.active) {
+        // Ultima sarcină inactivă îi ia locul celei eliminate
+        Entry last = m_inactive.back();
+        m_inactive.pop_back();
+        if (slot != m_inactive.size()) {
+            m_inactive[slot] = last;
+            last.slot->index = static_cast<std::uint32_t>(slot);
+        }
+        return;
+    }
+
+    // Ultimul element din heap îi ia locul, apoi urcă sau coboară până la locul lui
+    Entry last = m_heap.back();
+    m_heap.pop_back();
+    if (slot == m_heap.size()) {
+        return;
+    }
+    bool up = _Before(last, m_heap[slot]);
+    _Store(slot, last);
+    if (up) {
+        _SiftUp(slot);
+    } else {
+        _SiftDown(slot);
+    }
+}
+
+void Ready_Queue::_SiftUp(size_t slot) {
+    Entry entry = m_heap[slot];
+    while (slot > 0) {
+        size_t parent = (slot - 1) / 2;
+        if (!_Before(entry, m_heap[parent])) {
+            break;
+        }
+        _Store(slot, m_heap[parent]);
+        slot = parent;
+    }
+    _Store(slot, entry);
+}
+
+void Ready_Queue::_SiftDown(size_t slot) {
+    Entry entry = m_heap[slot];
+    size_t size = m_heap.size();
+    for (;;) {
+        size_t child = 2 * slot + 1;
+        if (child >= size) {
+            break;
+        }
+        // Alegem copilul mai important
+        if (child + 1 < size && _Before(m_heap[child + 1], m_heap[child])) {
+            ++child;
+        }
+        if (!_Before(m_heap[child], entry)) {
+            break;
+        }
+        _Store(slot, m_heap[child]);
+        slot = child;
+    }
+    _Store(slot, entry);
+}
+
+bool Ready_Queue::_Before(const Entry& a, const Entry& b) {
+    return a.rank != b.rank ? a.rank < b.rank : a.age < b.age;
+}
+
+void Ready_Queue::_Store(size_t slot, const Entry& entry) {
+    m_heap[slot] = entry;
+    entry.slot->index = static_cast<std::uint32_t>(slot);
+}
+
+} // namespace Task_Management
@@ -0,0 +1,234 @@
+#include "recurrence_scheduler.h"
+#include "recurring_task.h"
+#include <algorithm>
+
+namespace Task_Management {
+
+namespace {
+
+const std::int64_t SLOT_MASK = Recurrence_Scheduler::SLOT_COUNT - 1;
+
+/**
+ * Împărțire întreagă rotunjită în jos (corectă și pentru valori negative)
+ */
+std::int64_t FloorDiv(std::int64_t value, std::int64_t divisor) {
+    std::int64_t quotient = value / divisor;
+    return quotient - (value % divisor < 0 ? 1 : 0);
+}
+
+} // namespace
+
+const int Recurrence_Scheduler::SLOT_BITS;
+const int Recurrence_Scheduler::SLOT_COUNT;
+const int Recurrence_Scheduler::LEVEL_COUNT;
+
+Recurrence_Scheduler::Recurrence_Scheduler(Callback callback, std::chrono::milliseconds tick, Missed_Policy policy,
+                                           std::chrono::system_clock::time_point start)
+    : m_callback(callback),
+      m_tick(std::max(std::chrono::duration_cast<std::chrono::system_clock::duration>(tick),
+                      std::chrono::system_clock::duration(1))),
+      m_policy(policy),
+      m_current_tick(0),
+      m_count(0),
+      m_firing(nullptr) {
+    std::fill(&m_slots[0][0], &m_slots[0][0] + LEVEL_COUNT * SLOT_COUNT, nullptr);
+    std::fill(m_level_counts, m_level_counts + LEVEL_COUNT, 0);
+
+    // Tick-ul care conține momentul de pornire este considerat deja procesat
+    m_current_tick = FloorDiv(start.time_since_epoch().count(), m_tick.count()) + 1;
+}
+
+Recurrence_Scheduler::~Recurrence_Scheduler() {
+    // Sarcinile rămase nu mai trebuie să anuleze planificarea la distrugere
+    for (int level = 0; level < LEVEL_COUNT; ++level) {
+        for (int slot = 0; slot < SLOT_COUNT; ++slot) {
+            for (Recurring_Task* task = m_slots[level][slot]; task; ) {
+                Recurring_Task* next = task->m_timer_next;
+                task->m_scheduler = nullptr;
+                task->m_timer_next = nullptr;
+                task->m_timer_pprev = nullptr;
+                task = next;
+            }
+        }
+    }
+}
+
+bool Recurrence_Scheduler::Schedule(Recurring_Task* task) {
+    if (!task || task->m_scheduler) {
+        return false;
+    }
+    task->m_scheduler = this;
+    _Insert(task);
+    ++m_count;
+    return true;
+}
+
+bool Recurrence_Scheduler::Cancel(Recurring_Task* task) {
+    if (!task || task->m_scheduler != this) {
+        return false;
+    }
+    if (task->m_timer_pprev) {
+        _Unlink(task);
+    }
+    task->m_scheduler = nullptr;
+    if (m_firing == task) {
+        m_firing = nullptr;  // Sarcina anulată (sau distrusă) în timpul apelului nu mai este atinsă
+    }
+    --m_count;
+    return true;
+}
+
+size_t Recurrence_Scheduler::Advance(std::chrono::system_clock::time_point now) {
+    std::int64_t target = FloorDiv(now.time_since_epoch().count(), m_tick.count());
+    size_t fired = 0;
+    while (m_current_tick <= target) {
+        // La începutul fiecărei rotații a nivelului 0, sarcinile coboară de pe nivelurile superioare
+        if ((m_current_tick & SLOT_MASK) == 0) {
+            _Cascade();
+        }
+        fired += _FireTick(m_current_tick, now);
+
+        // Dacă primele niveluri sunt goale, nimic nu se întâmplă până la următoarea
+        // cascadă a primului nivel ocupat, deci tick-urile intermediare sunt sărite
+        int empty_levels = 0;
+        while (empty_levels < LEVEL_COUNT && m_level_counts[empty_levels] == 0) {
+            ++empty_levels;
+        }
+        if (empty_levels == LEVEL_COUNT) {
+            m_current_tick = std::max(m_current_tick, target + 1);
+        } else if (empty_levels > 0) {
+            int bits = SLOT_BITS * empty_levels;
+            std::int64_t boundary = ((m_current_tick + (std::int64_t(1) << bits) - 1) >> bits) << bits;
+            m_current_tick = std::min(boundary, target + 1);
+        }
+    }
+    return fired;
+}
+
+size_t Recurrence_Scheduler::Advance() {
+    return Advance(std::chrono::system_clock::now());
+}
+
+size_t Recurrence_Scheduler::Size() const {
+    return m_count;
+}
+
+void Recurrence_Scheduler::_Insert(Recurring_Task* task) {
+    std::int64_t expiry = _ExpiryTick(task->m_next_occurrence);
+    task->m_timer_expiry = expiry;
+
+    // Nivelul cel mai mic care cuprinde termenul; termenele trecute intră în slotul
+    // următorului tick procesat, iar cele dincolo de ultimul nivel în ultimul lui slot
+    std::int64_t delta = expiry - m_current_tick;
+    std::int64_t slot_tick = expiry;
+    int level = 0;
+    if (delta < 0) {
+        slot_tick = m_current_tick;
+    } else {
+        while (level < LEVEL_COUNT - 1 && delta >= (std::int64_t(1) << (SLOT_BITS * (level + 1)))) {
+            ++level;
+        }
+        std::int64_t horizon = (std::int64_t(1) << (SLOT_BITS * LEVEL_COUNT)) - 1;
+        if (delta > horizon) {
+            slot_tick = m_current_tick + horizon;  // Replasată corect la cascadă
+        }
+    }
+
+    Recurring_Task*& head = m_slots[level][(slot_tick >> (SLOT_BITS * level)) & SLOT_MASK];
+    task->m_timer_level = level;
+    task->m_timer_next = head;
+    if (head) {
+        head->m_timer_pprev = &task->m_timer_next;
+    }
+    head = task;
+    task->m_timer_pprev = &head;
+    ++m_level_counts[level];
+}
+
+void Recurrence_Scheduler::_Unlink(Recurring_Task* task) {
+    *task->m_timer_pprev = task->m_timer_next;
+    if (task->m_timer_next) {
+        task->m_timer_next->m_timer_pprev = task->m_timer_pprev;
+    }
+    task->m_timer_next = nullptr;
+    task->m_timer_pprev = nullptr;
+    --m_level_counts[task->m_timer_level];
+}
+
+void Recurrence_Scheduler::_Reschedule(Recurring_Task* task) {
+    if (task->m_timer_pprev) {
+        _Unlink(task);
+    }
+    _Insert(task);
+}
+
+void Recurrence_Scheduler::_Cascade() {
+    for (int level = 1; level < LEVEL_COUNT; ++level) {
+        std::int64_t index = (m_current_tick >> (SLOT_BITS * level)) & SLOT_MASK;
+
+        // Lista slotului este mutată într-o variabilă locală, apoi fiecare sarcină este
+        // replasată față de tick-ul curent (pe un nivel inferior)
+        Recurring_Task* pending = m_slots[level][index];
+        m_slots[level][index] = nullptr;
+        if (pending) {
+            pending->m_timer_pprev = &pending;
+        }
+        while (pending) {
+            Recurring_Task* task = pending;
+            _Unlink(task);
+            _Insert(task);
+        }
+
+        // Nivelul următor este atins doar când și acest nivel a terminat o rotație
+        if (index != 0) {
+            break;
+        }
+    }
+}
+
+size_t Recurrence_Scheduler::_FireTick(std::int64_t tick, std::chrono::system_clock::time_point now) {
+    Recurring_Task* pending = m_slots[0][tick & SLOT_MASK];
+    m_slots[0][tick & SLOT_MASK] = nullptr;
+    if (pending) {
+        pending->m_timer_pprev = &pending;
+    }
+
+    // Sarcinile replanificate de acum înainte (inclusiv aparițiile ratate) intră în tick-ul următor
+    m_current_tick = tick + 1;
+
+    size_t fired = 0;
+    while (pending) {
+        Recurring_Task* task = pending;
+        _Unlink(task);
+
+        std::chrono::system_clock::time_point occurrence = task->m_next_occurrence;
+        if (m_policy == Missed_Policy::FIRE_LATEST) {
+            // Aparițiile ratate sunt sărite până la ultima care nu este în viitor
+            // (un pas care nu avansează oprește bucla, în loc să o blocheze)
+            for (std::chrono::system_clock::time_point next = task->_StepOccurrence(occurrence);
+                 next <= now && next > occurrence; next = task->_StepOccurrence(occurrence)) {
+                occurrence = next;
+            }
+            task->m_next_occurrence = occurrence;
+        }
+
+        m_firing = task;
+        m_callback(*task, occurrence);
+        ++fired;
+
+        // Dacă funcția apelată nu a anulat sau replanificat sarcina, trecem la apariția următoare
+        if (m_firing == task && !task->m_timer_pprev) {
+            task->m_next_occurrence = task->_StepOccurrence(task->m_next_occurrence);
+            _Insert(task);
+        }
+        m_firing = nullptr;
+    }
+    return fired;
+}
+
+std::int64_t Recurrence_Scheduler::_ExpiryTick(std::chrono::system_clock::time_point time) const {
+    // Rotunjire în sus: apariția nu este declanșată înaintea momentului ei
+    return -FloorDiv(-time.time_since_epoch().count(), m_tick.count());
+}
+
+} // namespace Task_Management
@@ -1,19 +1,130 @@
 #include "recurring_task.h"
+#include "recurrence_scheduler.h"
+#include "work_stealing_pool.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <ctime>
 
 namespace Task_Management {
 
+namespace {
+
+const std::int64_t SECONDS_PER_DAY = 24 * 3600;
+
+/**
+ * Descompune un moment în numărul zilei locale și ora locală din acea zi
+ * Ziua este calculată cu localtime_r, ca în System_Clock (sursa lui Today_Clock), deci
+ * se poate compara direct cu Date și cu Today_Clock::GetDayNumber.
+ */
+int SplitDay(std::chrono::system_clock::time_point time, std::chrono::system_clock::duration& time_of_day) {
+    std::chrono::system_clock::duration since_epoch = time.time_since_epoch();
+    std::chrono::seconds seconds = std::chrono::duration_cast<std::chrono::seconds>(since_epoch);
+    if (seconds > since_epoch) {
+        seconds -= std::chrono::seconds(1);  // Rotunjire în jos pentru momentele dinaintea epocii
+    }
+    std::time_t time_value = static_cast<std::time_t>(seconds.count());
+    std::tm local = {};
+    localtime_r(&time_value, &local);
+    time_of_day = std::chrono::hours(local.tm_hour) + std::chrono::minutes(local.tm_min) +
+                  std::chrono::seconds(local.tm_sec) + (since_epoch - seconds);
+    return Date::DaysFromCivil(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday);
+}
+
+/**
+ * Diferența (în secunde) dintre ora locală și UTC la un moment dat
+ */
+std::int64_t LocalOffset(std::int64_t time) {
+    std::time_t time_value = static_cast<std::time_t>(time);
+    std::tm local = {};
+    localtime_r(&time_value, &local);
+    return local.tm_gmtoff;
+}
+
+/**
+ * Momentul în care ziua locală dată ajunge la ora locală dată (inversa lui SplitDay)
+ * Candidații sunt ora dată cu diferența față de UTC de cu o zi înainte și de cu o zi
+ * după; este valid candidatul a cărui diferență reală este cea presupusă. Rezultatul nu
+ * depinde de apelurile anterioare (ca la mktime): la o oră care apare de două ori
+ * (trecerea la ora de iarnă) este ales primul moment, iar la o oră care lipsește
+ * (trecerea la ora de vară) momentul de după salt.
+ */
+std::chrono::system_clock::time_point JoinDay(int day, std::chrono::system_clock::duration time_of_day) {
+    std::chrono::seconds seconds = std::chrono::duration_cast<std::chrono::seconds>(time_of_day);
+    std::int64_t wall = static_cast<std::int64_t>(day) * SECONDS_PER_DAY + seconds.count();
+    std::int64_t offsets[2] = { LocalOffset(wall - SECONDS_PER_DAY), LocalOffset(wall + SECONDS_PER_DAY) };
+
+    std::int64_t result = 0;
+    std::int64_t after_gap = 0;
+    bool found = false;
+    for (int i = 0; i < 2; ++i) {
+        std::int64_t candidate = wall - offsets[i];
+        if (LocalOffset(candidate) == offsets[i]) {
+            result = found ? std::min(result, candidate) : candidate;
+            found = true;
+        } else {
+            after_gap = i == 0 ? candidate : std::max(after_gap, candidate);
+        }
+        if (offsets[1] == offsets[0]) {
+            break;  // Fără schimbarea orei în jurul zilei: un singur candidat
+        }
+    }
+    return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+               std::chrono::seconds(found ? result : after_gap))) +
+           (time_of_day - seconds);
+}
+
+/**
+ * Indexul lunii unei zile (an * 12 + lună - 1), folosit la pașii lunari
+ */
+int MonthIndexOf(int day) {
+    return Date::YearFromDays(day) * 12 + Date::MonthFromDays(day) - 1;
+}
+
+/**
+ * Ziua de referință dintr-o lună, limitată la lungimea lunii
+ * @param month_index Indexul lunii (an * 12 + lună - 1)
+ * @param anchor_day Ziua de referință (1-31)
+ * @return Numărul zilei
+ */
+int DayInMonth(int month_index, int anchor_day) {
+    int year = month_index / 12 - (month_index % 12 < 0 ? 1 : 0);
+    int month = month_index - year * 12 + 1;
+    int month_length = Date::DaysFromCivil(year, month + 1, 1) - Date::DaysFromCivil(year, month, 1);
+    return Date::DaysFromCivil(year, month, anchor_day < month_length ? anchor_day : month_length);
+}
+
+/**
+ * Împărțire întreagă rotunjită în sus, pentru valori nenegative
+ */
+std::int64_t CeilDiv(std::int64_t value, std::int64_t divisor) {
+    return (value + divisor - 1) / divisor;
+}
+
+/**
+ * Numărul de sarcini procesate de o singură lucrare la expandarea aparițiilor
+ */
+const size_t EXPAND_BLOCK_SIZE = 1024;
+
+} // namespace
+
 Recurring_Task::Recurring_Task(const std::string& title, const std::string& description, 
                              Priority priority, RecurrencePattern pattern, int interval)
     : Task(title, description, priority), 
       m_pattern(pattern), 
-      m_interval(interval),
-      m_occurrences_completed(0) {
+      m_interval(interval > 0 ? interval : 1),  // Ca în SetInterval, intervalul trebuie să fie pozitiv
+      m_occurrences_completed(0),
+      m_anchor_day(1),
+      m_scheduler(nullptr),
+      m_timer_next(nullptr),
+      m_timer_pprev(nullptr),
+      m_timer_expiry(0),
+      m_timer_level(0) {
     // Apelăm constructorul clasei de bază și inițializăm membrii specifici acestei clase
     // Apoi calculăm data primei apariții
     _CalculateNextOccurrence();
+    _NotifyObservers(Task_Change::CREATED);
 }
 
 Recurring_Task::Recurring_Task(const Recurring_Task& other)
@@ -21,13 +132,22 @@ Recurring_Task::Recurring_Task(const Recurring_Task& other)
       m_pattern(other.m_pattern),
       m_interval(other.m_interval),
       m_occurrences_completed(other.m_occurrences_completed),
-      m_next_occurrence(other.m_next_occurrence) {
+      m_anchor_day(other.m_anchor_day),
+      m_next_occurrence(other.m_next_occurrence),
+      m_scheduler(nullptr),
+      m_timer_next(nullptr),
+      m_timer_pprev(nullptr),
+      m_timer_expiry(0),
+      m_timer_level(0) {
     // Constructor de copiere - copiază toate datele din obiectul other
+    // Copia nu este planificată automat
 }
 
 Recurring_Task::~Recurring_Task() {
-    // Implementarea destructorului
-    // În acest caz simplu, nu avem resurse de eliberat
+    // Sarcina este scoasă din planificator, pentru ca acesta să nu păstreze un pointer invalid
+    if (m_scheduler) {
+        m_scheduler->Cancel(this);
+    }
 }
 
 void Recurring_Task::DisplayDetails() const {
@@ -63,6 +183,7 @@ void Recurring_Task::SetRecurrencePattern(RecurrencePattern pattern) {
     // Setează modelul de recurență și recalculează următoarea apariție
     m_pattern = pattern;
     _CalculateNextOccurrence();
+    _Reschedule();
 }
 
 int Recurring_Task::GetInterval() const {
@@ -75,6 +196,7 @@ void Recurring_Task::SetInterval(int interval) {
     if (interval > 0) {
         m_interval = interval;
         _CalculateNextOccurrence();
+        _Reschedule();
     }
 }
 
@@ -86,10 +208,15 @@ std::string Recurring_Task::GetNextOccurrence() const {
     return ss.str();
 }
 
+std::chrono::system_clock::time_point Recurring_Task::GetNextOccurrenceTime() const {
+    return m_next_occurrence;
+}
+
 void Recurring_Task::CompleteCurrentOccurrence() {
-    // Marchează apariția curentă ca finalizată și calculează următoarea apariție
+    // Marchează apariția curentă ca finalizată și trece la apariția următoare
     m_occurrences_completed++;
-    _CalculateNextOccurrence();
+    m_next_occurrence = _StepOccurrence(m_next_occurrence);
+    _Reschedule();
 }
 
 void Recurring_Task::_WriteDetailsToStream(std::ostream& os) const {
@@ -105,29 +232,161 @@ void Recurring_Task::_WriteDetailsToStream(std::ostream& os) const {
 }
 
 void Recurring_Task::_CalculateNextOccurrence() {
-    // Obținem timpul curent
-    auto now = std::chrono::system_clock::now();
-    
-    // Calculăm următoarea apariție pe baza modelului și intervalului
-    // Aceasta este o implementare simplificată
+    // Prima apariție este la un interval după momentul curent
+    // Ziua de referință este ziua curentă, pentru ca pasul lunar să pornească de la ea
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    _SetNextOccurrence(now);
+    m_next_occurrence = _StepOccurrence(now);
+}
+
+void Recurring_Task::_SetNextOccurrence(std::chrono::system_clock::time_point occurrence) {
+    std::chrono::system_clock::duration time_of_day;
+    m_anchor_day = Date::DayFromDays(SplitDay(occurrence, time_of_day));
+    m_next_occurrence = occurrence;
+}
+
+std::chrono::system_clock::time_point Recurring_Task::_StepOccurrence(
+    std::chrono::system_clock::time_point occurrence) const {
+    std::chrono::system_clock::duration time_of_day;
+    int day = SplitDay(occurrence, time_of_day);
+
+    if (m_pattern == RecurrencePattern::DAILY || m_pattern == RecurrencePattern::WEEKLY) {
+        return JoinDay(day + _StepLength(), time_of_day);
+    }
+
+    // Pașii lunari se fac în calendar: luna avansează, iar ziua de referință este
+    // limitată la lungimea lunii (31 -> 30 în aprilie, 29 februarie -> 28 în anii obișnuiți)
+    return JoinDay(DayInMonth(MonthIndexOf(day) + _StepLength(), m_anchor_day), time_of_day);
+}
+
+void Recurring_Task::ExpandOccurrences(const std::vector<Recurring_Task*>& tasks, const Date& first, const Date& last,
+                                       Occurrence_Table& table, Work_Stealing_Pool* pool) {
+    int first_day = first.GetDayNumber();
+    int last_day = last.GetDayNumber();
+    size_t block_count = (tasks.size() + EXPAND_BLOCK_SIZE - 1) / EXPAND_BLOCK_SIZE;
+
+    // Prima trecere: numărul de apariții al fiecărei sarcini
+    // (ziua locală a următoarei apariții este reținută pentru a doua trecere)
+    std::vector<size_t> offsets(tasks.size() + 1, 0);
+    std::vector<int> start_days(tasks.size(), 0);
+    Work_Stealing_Pool::ParallelFor(pool, block_count, [&](size_t block) {
+        size_t end = std::min(tasks.size(), (block + 1) * EXPAND_BLOCK_SIZE);
+        for (size_t i = block * EXPAND_BLOCK_SIZE; i < end; ++i) {
+            if (!tasks[i]) {
+                continue;
+            }
+            std::int64_t first_step = 0;
+            std::int64_t last_step = 0;
+            start_days[i] = tasks[i]->_StartDay();
+            offsets[i + 1] = tasks[i]->_OccurrenceRange(start_days[i], first_day, last_day, first_step, last_step);
+        }
+    });
+
+    // Pozițiile din tabel (sume parțiale), apoi tabelul este dimensionat o singură dată
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        offsets[i + 1] += offsets[i];
+    }
+    table.task_indexes.resize(offsets.back());
+    table.day_numbers.resize(offsets.back());
+
+    // A doua trecere: fiecare sarcină își scrie aparițiile la poziția ei
+    std::uint32_t* task_indexes = table.task_indexes.data();
+    int* day_numbers = table.day_numbers.data();
+    Work_Stealing_Pool::ParallelFor(pool, block_count, [&](size_t block) {
+        size_t end = std::min(tasks.size(), (block + 1) * EXPAND_BLOCK_SIZE);
+        for (size_t i = block * EXPAND_BLOCK_SIZE; i < end; ++i) {
+            if (offsets[i] == offsets[i + 1]) {
+                continue;
+            }
+            const Recurring_Task& task = *tasks[i];
+            std::int64_t first_step = 0;
+            std::int64_t last_step = 0;
+            task._OccurrenceRange(start_days[i], first_day, last_day, first_step, last_step);
+
+            size_t row = offsets[i];
+            std::fill(task_indexes + row, task_indexes + offsets[i + 1], static_cast<std::uint32_t>(i));
+            bool by_month = task.m_pattern == RecurrencePattern::MONTHLY || task.m_pattern == RecurrencePattern::YEARLY;
+            int length = task._StepLength();
+            int day = task._OccurrenceDay(start_days[i], first_step);
+            int month_index = MonthIndexOf(day);
+            for (std::int64_t step = first_step; step <= last_step; ++step) {
+                day_numbers[row++] = day;
+                // Apariția următoare, prin adunare: zile sau luni
+                if (by_month) {
+                    month_index += length;
+                    day = DayInMonth(month_index, task.m_anchor_day);
+                } else {
+                    day += length;
+                }
+            }
+        }
+    });
+}
+
+void Recurring_Task::_Reschedule() {
+    if (m_scheduler) {
+        m_scheduler->_Reschedule(this);
+    }
+}
+
+size_t Recurring_Task::_OccurrenceRange(int start_day, int first_day, int last_day, std::int64_t& first_step,
+                                        std::int64_t& last_step) const {
+    int length = _StepLength();
+    first_step = 0;
+    last_step = -1;
+    if (first_day > last_day || last_day < start_day) {
+        return 0;
+    }
+    if (length <= 0) {
+        // Un interval invalid nu avansează: există doar următoarea apariție
+        last_step = start_day >= first_day ? 0 : -1;
+        return static_cast<size_t>(last_step + 1);
+    }
+
+    if (m_pattern == RecurrencePattern::DAILY || m_pattern == RecurrencePattern::WEEKLY) {
+        // Aparițiile sunt la distanțe egale, deci capetele rezultă direct prin împărțire
+        first_step = start_day >= first_day ? 0 : CeilDiv(first_day - start_day, length);
+        last_step = (last_day - start_day) / length;
+    } else {
+        // Aparițiile sunt în luni egal depărtate: se calculează lunile capetelor, apoi se
+        // corectează cu o poziție dacă ziua din luna de capăt este în afara intervalului
+        int start_month = MonthIndexOf(start_day);
+        int first_month = MonthIndexOf(first_day);
+        first_step = first_month <= start_month ? 0 : CeilDiv(first_month - start_month, length);
+        if (_OccurrenceDay(start_day, first_step) < first_day) {
+            ++first_step;
+        }
+        last_step = (MonthIndexOf(last_day) - start_month) / length;
+        if (_OccurrenceDay(start_day, last_step) > last_day) {
+            --last_step;
+        }
+    }
+    return last_step >= first_step ? static_cast<size_t>(last_step - first_step + 1) : 0;
+}
+
+int Recurring_Task::_StartDay() const {
+    std::chrono::system_clock::duration time_of_day;
+    return SplitDay(m_next_occurrence, time_of_day);
+}
+
+int Recurring_Task::_OccurrenceDay(int start_day, std::int64_t step) const {
+    if (step == 0) {
+        return start_day;
+    }
+    if (m_pattern == RecurrencePattern::DAILY || m_pattern == RecurrencePattern::WEEKLY) {
+        return start_day + static_cast<int>(step * _StepLength());
+    }
+    return DayInMonth(MonthIndexOf(start_day) + static_cast<int>(step * _StepLength()), m_anchor_day);
+}
+
+int Recurring_Task::_StepLength() const {
     switch (m_pattern) {
-        case RecurrencePattern::DAILY:
-            // Adăugăm interval * 24 ore
-            m_next_occurrence = now + std::chrono::hours(24 * m_interval);
-            break;
-        case RecurrencePattern::WEEKLY:
-            // Adăugăm interval * 7 zile
-            m_next_occurrence = now + std::chrono::hours(24 * 7 * m_interval);
-            break;
-        case RecurrencePattern::MONTHLY:
-            // Simplificat: adăugăm interval * 30 zile per lună
-            m_next_occurrence = now + std::chrono::hours(24 * 30 * m_interval);
-            break;
-        case RecurrencePattern::YEARLY:
-            // Simplificat: adăugăm interval * 365 zile per an
-            m_next_occurrence = now + std::chrono::hours(24 * 365 * m_interval);
-            break;
+        case RecurrencePattern::DAILY: return m_interval;
+        case RecurrencePattern::WEEKLY: return 7 * m_interval;
+        case RecurrencePattern::MONTHLY: return m_interval;
+        case RecurrencePattern::YEARLY: return 12 * m_interval;
     }
+    return m_interval;
 }
 
 std::string Recurring_Task::_PatternToString() const {
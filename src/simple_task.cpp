@@ -7,6 +7,7 @@ Simple_Task::Simple_Task(const std::string& title, const std::string& descriptio
     : Task(title, description, priority) {
     // Apelăm constructorul clasei de bază (Task) cu parametrii primiți
     // Aceasta este o formă de reutilizare a codului prin moștenire
+    _NotifyObservers(Task_Change::CREATED);
 }
 
 Simple_Task::Simple_Task(const Simple_Task& other)
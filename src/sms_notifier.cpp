@@ -16,17 +16,30 @@ SMS_Notifier::~SMS_Notifier() {
 bool SMS_Notifier::SendNotification(const std::string& recipient, const std::string& subject, const std::string& message) const {
     // Într-o implementare reală, această metodă ar conecta la un serviciu de SMS
     // Pentru această demonstrație, doar afișăm detaliile SMS-ului
-    
-    std::cout << "Sending SMS notification:" << std::endl;
-    std::cout << "  From: " << m_sender_phone << std::endl;
-    std::cout << "  To: " << recipient << std::endl;
-    // Pentru SMS-uri, includem subiectul în mesaj, deoarece SMS-urile nu au câmp de subiect separat
-    std::cout << "  Message: " << subject << ": " << message << std::endl;
+    // Textul este formatat întâi, apoi scris și golit o singură dată (nu la fiecare rând)
+    std::string text;
+    _Format(recipient, subject, message, text);
+    std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+    std::cout.flush();
     
     // Simulăm trimiterea cu succes
     return true;
 }
 
+size_t SMS_Notifier::SendNotifications(const std::vector<Notification>& notifications, std::vector<bool>& delivered) const {
+    // Tot lotul este scris cu o singură operație de ieșire
+    std::string text;
+    for (const Notification& notification : notifications) {
+        _Format(notification.recipient, notification.subject, notification.message, text);
+    }
+    std::cout.write(text.data(), static_cast<std::streamsize>(text.size()));
+    std::cout.flush();
+    
+    // Simulăm trimiterea cu succes
+    delivered.assign(notifications.size(), true);
+    return notifications.size();
+}
+
 std::string SMS_Notifier::GetNotificationType() const {
     // Returnează tipul notificării
     return "SMS";
@@ -42,4 +55,12 @@ void SMS_Notifier::SetSenderPhone(const std::string& sender_phone) {
     m_sender_phone = sender_phone;
 }
 
+void SMS_Notifier::_Format(const std::string& recipient, const std::string& subject, const std::string& message, std::string& out) const {
+    out += "Sending SMS notification:\n";
+    out += "  From: " + m_sender_phone + "\n";
+    out += "  To: " + recipient + "\n";
+    // Pentru SMS-uri, includem subiectul în mesaj, deoarece SMS-urile nu au câmp de subiect separat
+    out += "  Message: " + subject + ": " + message + "\n";
+}
+
 } // namespace Task_Management
@@ -0,0 +1,406 @@
+#include "smtp_transport.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+namespace Task_Management {
+
+namespace {
+
+/**
+ * Adaugă un text într-o comandă sau un antet, fără caracterele de sfârșit de rând
+ * Un destinatar sau un subiect cu CR/LF ar putea altfel injecta comenzi sau antete
+ */
+void AppendLine(const std::string& text, std::string& out) {
+    for (char c : text) {
+        out += (c == '\r' || c == '\n') ? ' ' : c;
+    }
+}
+
+/**
+ * Verifică dacă un rând din răspunsul la EHLO anunță extensia PIPELINING
+ */
+bool AnnouncesPipelining(const std::string& reply) {
+    static const char KEYWORD[] = "PIPELINING";
+    size_t length = sizeof(KEYWORD) - 1;
+    for (size_t start = 0; start + 4 + length <= reply.size();) {
+        size_t end = reply.find('\n', start);
+        if (end == std::string::npos) {
+            end = reply.size();
+        }
+        // Rândul are forma "250-PIPELINING" sau "250 PIPELINING"
+        if (end - start >= 4 + length && strncasecmp(reply.c_str() + start + 4, KEYWORD, length) == 0) {
+            return true;
+        }
+        start = end + 1;
+    }
+    return false;
+}
+
+inline bool IsPositive(int code) {
+    return code >= 200 && code < 300;
+}
+
+} // namespace
+
+Smtp_Transport::Smtp_Transport(const Smtp_Config& config)
+    : m_config(config),
+      m_connect_count(0) {
+    m_config.pool_size = std::max<size_t>(m_config.pool_size, 1);
+    m_config.max_messages_per_session = std::max<size_t>(m_config.max_messages_per_session, 1);
+}
+
+Smtp_Transport::~Smtp_Transport() {
+    for (auto& connection : m_connections) {
+        if (connection->fd >= 0) {
+            _Close(*connection, true);
+        }
+    }
+}
+
+size_t Smtp_Transport::Send(const std::string& sender, const std::vector<Notification>& notifications, std::vector<bool>& delivered) {
+    delivered.assign(notifications.size(), false);
+    if (notifications.empty()) {
+        return 0;
+    }
+
+    Connection* connection = _Acquire();
+    size_t index = 0;
+    while (index < notifications.size()) {
+        // Sesiunea este redeschisă după max_messages_per_session mesaje
+        bool fresh = false;
+        if (connection->fd >= 0 && connection->message_count >= m_config.max_messages_per_session) {
+            _Close(*connection, true);
+        }
+        if (connection->fd < 0) {
+            if (!_Open(*connection)) {
+                break;  // Serverul nu este disponibil; mesajele rămase nu sunt trimise
+            }
+            fresh = true;
+        }
+
+        size_t next = index;
+        if (_SendSession(*connection, sender, notifications, index, delivered, next)) {
+            index = next;
+            continue;
+        }
+
+        // Conexiunea a căzut. O conexiune păstrată în pool poate fi fost închisă de server
+        // între timp, deci reîncercăm pe una nouă; o conexiune nouă care cade fără niciun
+        // progres înseamnă că serverul nu poate primi mesaje acum.
+        _Close(*connection, false);
+        if (next == index && fresh) {
+            break;
+        }
+        index = next;
+    }
+    _Release(connection);
+
+    return static_cast<size_t>(std::count(delivered.begin(), delivered.end(), true));
+}
+
+std::uint64_t Smtp_Transport::GetConnectCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_connect_count;
+}
+
+Smtp_Transport::Connection* Smtp_Transport::_Acquire() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_released.wait(lock, [this]() { return !m_idle.empty() || m_connections.size() < m_config.pool_size; });
+    if (!m_idle.empty()) {
+        // Ultima conexiune eliberată este cea mai probabil încă deschisă de server
+        Connection* connection = m_idle.back();
+        m_idle.pop_back();
+        return connection;
+    }
+    m_connections.push_back(std::unique_ptr<Connection>(new Connection()));
+    return m_connections.back().get();
+}
+
+void Smtp_Transport::_Release(Connection* connection) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_idle.push_back(connection);
+    }
+    m_released.notify_one();
+}
+
+bool Smtp_Transport::_Open(Connection& connection) {
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses = nullptr;
+    std::string port = std::to_string(m_config.port);
+    if (getaddrinfo(m_config.host.c_str(), port.c_str(), &hints, &addresses) != 0) {
+        return false;
+    }
+
+    timeval timeout;
+    timeout.tv_sec = m_config.timeout_ms / 1000;
+    timeout.tv_usec = (m_config.timeout_ms % 1000) * 1000;
+    for (addrinfo* address = addresses; address && connection.fd < 0; address = address->ai_next) {
+        int fd = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (fd < 0) {
+            continue;
+        }
+        // Comenzile unui grup sunt scrise deodată, deci algoritmul lui Nagle doar ar întârzia
+        int enabled = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enabled, sizeof(enabled));
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        if (::connect(fd, address->ai_addr, address->ai_addrlen) == 0) {
+            connection.fd = fd;
+        } else {
+            ::close(fd);
+        }
+    }
+    freeaddrinfo(addresses);
+    if (connection.fd < 0) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_connect_count;
+    }
+    connection.input.clear();
+    connection.message_count = 0;
+    connection.pipelining = false;
+
+    // Salutul serverului, apoi EHLO (cu HELO ca variantă pentru serverele vechi)
+    int code = 0;
+    std::string reply;
+    std::string command;
+    if (!_ReadReply(connection, code) || code != 220) {
+        _Close(connection, false);
+        return false;
+    }
+    command = "EHLO ";
+    AppendLine(m_config.helo_name, command);
+    command += "\r\n";
+    if (!_Write(connection, command) || !_ReadReply(connection, code, &reply)) {
+        _Close(connection, false);
+        return false;
+    }
+    if (IsPositive(code)) {
+        connection.pipelining = AnnouncesPipelining(reply);
+        return true;
+    }
+    command = "HELO ";
+    AppendLine(m_config.helo_name, command);
+    command += "\r\n";
+    if (!_Write(connection, command) || !_ReadReply(connection, code) || !IsPositive(code)) {
+        _Close(connection, false);
+        return false;
+    }
+    return true;
+}
+
+void Smtp_Transport::_Close(Connection& connection, bool quit) {
+    if (connection.fd < 0) {
+        return;
+    }
+    if (quit) {
+        int code = 0;
+        if (_Write(connection, "QUIT\r\n")) {
+            _ReadReply(connection, code);
+        }
+    }
+    ::close(connection.fd);
+    connection.fd = -1;
+    connection.input.clear();
+}
+
+bool Smtp_Transport::_SendSession(Connection& connection, const std::string& sender, const std::vector<Notification>& notifications,
+                                  size_t first, std::vector<bool>& delivered, size_t& next) {
+    size_t remaining = m_config.max_messages_per_session - connection.message_count;
+    size_t last = first + std::min(remaining, notifications.size() - first);
+    std::string out;
+    int mail = 0;
+    int recipient = 0;
+    int data = 0;
+    int result = 0;
+    next = first;
+
+    if (!connection.pipelining) {
+        // Fără PIPELINING, fiecare comandă își așteaptă răspunsul
+        for (size_t i = first; i < last; ++i) {
+            out.clear();
+            _AppendEnvelope(sender, notifications[i].recipient, out);
+            size_t mail_end = out.find('\n') + 1;
+            size_t recipient_end = out.find('\n', mail_end) + 1;
+            if (!_Write(connection, out.substr(0, mail_end)) || !_ReadReply(connection, mail)) {
+                return false;
+            }
+            ++connection.message_count;
+            next = i + 1;  // De aici, un mesaj întrerupt este considerat eșuat, nu retrimis
+            if (IsPositive(mail)) {
+                if (!_Write(connection, out.substr(mail_end, recipient_end - mail_end)) || !_ReadReply(connection, recipient)) {
+                    return false;
+                }
+                if (IsPositive(recipient)) {
+                    if (!_Write(connection, out.substr(recipient_end)) || !_ReadReply(connection, data)) {
+                        return false;
+                    }
+                    if (data == 354) {
+                        out.clear();
+                        _AppendContent(sender, notifications[i], out);
+                        if (!_Write(connection, out) || !_ReadReply(connection, result)) {
+                            return false;
+                        }
+                        delivered[i] = IsPositive(result);
+                        continue;
+                    }
+                }
+                // Tranzacția începută este anulată înaintea mesajului următor
+                if (!_Write(connection, "RSET\r\n") || !_ReadReply(connection, result)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Cu PIPELINING, finalul conținutului unui mesaj pleacă împreună cu comenzile
+    // mesajului următor, deci fiecare mesaj costă un singur drum dus-întors
+    if (first < last) {
+        _AppendEnvelope(sender, notifications[first].recipient, out);
+        if (!_Write(connection, out)) {
+            return false;
+        }
+    }
+    for (size_t i = first; i < last; ++i) {
+        if (!_ReadReply(connection, mail) || !_ReadReply(connection, recipient) || !_ReadReply(connection, data)) {
+            return false;
+        }
+        ++connection.message_count;
+        next = i + 1;
+
+        // Serverul refuză DATA dacă MAIL FROM sau RCPT TO au eșuat
+        out.clear();
+        bool accepted = data == 354;
+        bool reset = !accepted && IsPositive(mail);
+        if (accepted) {
+            _AppendContent(sender, notifications[i], out);
+        } else if (reset) {
+            out += "RSET\r\n";
+        }
+        if (i + 1 < last) {
+            _AppendEnvelope(sender, notifications[i + 1].recipient, out);
+        }
+        if (!out.empty() && !_Write(connection, out)) {
+            return false;
+        }
+        if (accepted || reset) {
+            if (!_ReadReply(connection, result)) {
+                return false;
+            }
+            delivered[i] = accepted && IsPositive(result);
+        }
+    }
+    return true;
+}
+
+void Smtp_Transport::_AppendEnvelope(const std::string& sender, const std::string& recipient, std::string& out) {
+    out += "MAIL FROM:<";
+    AppendLine(sender, out);
+    out += ">\r\nRCPT TO:<";
+    AppendLine(recipient, out);
+    out += ">\r\nDATA\r\n";
+}
+
+void Smtp_Transport::_AppendContent(const std::string& sender, const Notification& notification, std::string& out) {
+    out += "From: <";
+    AppendLine(sender, out);
+    out += ">\r\nTo: <";
+    AppendLine(notification.recipient, out);
+    out += ">\r\nSubject: ";
+    AppendLine(notification.subject, out);
+    out += "\r\n\r\n";
+
+    // Rândurile se termină cu CRLF, iar un punct de la începutul unui rând este dublat,
+    // pentru ca serverul să nu îl confunde cu terminatorul mesajului
+    const std::string& message = notification.message;
+    bool line_start = true;
+    for (size_t i = 0; i < message.size(); ++i) {
+        char c = message[i];
+        if (line_start && c == '.') {
+            out += '.';
+        }
+        if (c == '\n') {
+            if (i == 0 || message[i - 1] != '\r') {
+                out += '\r';
+            }
+            line_start = true;
+        } else {
+            line_start = false;
+        }
+        out += c;
+    }
+    if (!line_start || message.empty()) {
+        out += "\r\n";
+    }
+    out += ".\r\n";
+}
+
+bool Smtp_Transport::_Write(Connection& connection, const std::string& data) {
+    const char* p = data.data();
+    size_t remaining = data.size();
+    while (remaining > 0) {
+        ssize_t written = ::send(connection.fd, p, remaining, MSG_NOSIGNAL);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            return false;
+        }
+        p += written;
+        remaining -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool Smtp_Transport::_ReadReply(Connection& connection, int& code, std::string* text) {
+    if (text) {
+        text->clear();
+    }
+    for (;;) {
+        // Un răspuns are forma "250-..." pe rândurile intermediare și "250 ..." pe ultimul
+        size_t end = connection.input.find('\n');
+        while (end == std::string::npos) {
+            char buffer[4096];
+            ssize_t received = ::recv(connection.fd, buffer, sizeof(buffer), 0);
+            if (received < 0 && errno == EINTR) {
+                continue;
+            }
+            if (received <= 0) {
+                return false;
+            }
+            connection.input.append(buffer, static_cast<size_t>(received));
+            end = connection.input.find('\n');
+        }
+
+        const std::string& input = connection.input;
+        if (end < 3 || input[0] < '0' || input[0] > '9' || input[1] < '0' || input[1] > '9' || input[2] < '0' || input[2] > '9') {
+            return false;
+        }
+        code = (input[0] - '0') * 100 + (input[1] - '0') * 10 + (input[2] - '0');
+        bool more = end > 3 && input[3] == '-';
+        if (text) {
+            text->append(input, 0, end + 1);
+        }
+        connection.input.erase(0, end + 1);
+        if (!more) {
+            return true;
+        }
+    }
+}
+
+} // namespace Task_Management
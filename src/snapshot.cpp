@@ -0,0 +1,1128 @@
+#include "snapshot.h"
+#include "task.h"
+#include "simple_task.h"
+#include "project_task.h"
+#include "recurring_task.h"
+#include "deadline_task.h"
+#include "user.h"
+#include "team_leader.h"
+#include "category.h"
+#include "task_list.h"
+#include "task_notes.h"
+#include "task_factory.h"
+#include "id_allocator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <typeinfo>
+#include <unordered_map>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Task_Management {
+
+// Definițiile membrilor statici constanți
+const char Snapshot::MAGIC[8] = {'T', 'M', 'S', 'N', 'A', 'P', '\r', '\n'};
+const std::uint32_t Snapshot::FORMAT_VERSION;
+const std::uint8_t Snapshot::END_MARKER;
+
+namespace {
+
+// Dimensiunea buffer-elor de citire și scriere
+const size_t BUFFER_SIZE = 1 << 20;
+
+// Rezervăm cel mult atâtea elemente după un număr citit din fișier,
+// pentru ca un fișier corupt să nu provoace o alocare uriașă
+const std::uint64_t MAX_RESERVE = 1 << 20;
+
+// Constantele sumei de control (numere prime mari, ca în XXH64)
+const std::uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+const std::uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+const std::uint64_t PRIME_3 = 0x165667B19E3779F9ULL;
+const std::uint64_t PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+
+inline std::uint64_t RotateLeft(std::uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline std::uint64_t LoadLittleEndian64(const unsigned char* bytes) {
+    // Compilatorul reduce bucla la o singură citire pe procesoarele little-endian
+    std::uint64_t value = 0;
+    for (int i = 7; i >= 0; --i) {
+        value = (value << 8) | bytes[i];
+    }
+    return value;
+}
+
+inline std::uint64_t ZigZagEncode(std::int64_t value) {
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+inline std::int64_t ZigZagDecode(std::uint64_t value) {
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+inline std::uint8_t StorageModeToByte(Task_Collection::Storage_Mode mode) {
+    return mode == Task_Collection::Storage_Mode::INDEXED ? 1 : 0;
+}
+
+/**
+ * Tabelă număr de ID -> obiect pentru un tip de entitate
+ * ID-urile sunt de obicei aproape consecutive, deci tabela folosește un vector
+ * indexat direct; pentru ID-uri foarte rare folosește o tabelă hash.
+ */
+template <typename T>
+class Id_Table {
+public:
+    Id_Table() : m_highest(0) {}
+
+    /**
+     * Construiește tabela; eșuează pentru pointeri null, tip greșit sau ID-uri duplicate
+     */
+    bool Build(const std::vector<T*>& entries, Entity_Kind kind) {
+        m_highest = 0;
+        for (const T* entry : entries) {
+            if (!entry || entry->GetId().GetKind() != kind || entry->GetId().GetNumber() == 0) {
+                return false;
+            }
+            m_highest = std::max(m_highest, entry->GetId().GetNumber());
+        }
+
+        if (m_highest <= entries.size() * 2 + 1024) {
+            m_dense.assign(static_cast<size_t>(m_highest) + 1, nullptr);
+            for (T* entry : entries) {
+                T*& slot = m_dense[static_cast<size_t>(entry->GetId().GetNumber())];
+                if (slot) {
+                    return false;
+                }
+                slot = entry;
+            }
+            return true;
+        }
+
+        m_sparse.reserve(entries.size());
+        for (T* entry : entries) {
+            if (!m_sparse.emplace(entry->GetId().GetNumber(), entry).second) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    T* Find(std::uint64_t number) const {
+        if (!m_dense.empty() || m_sparse.empty()) {
+            return number < m_dense.size() ? m_dense[static_cast<size_t>(number)] : nullptr;
+        }
+        auto it = m_sparse.find(number);
+        return it != m_sparse.end() ? it->second : nullptr;
+    }
+
+    std::uint64_t GetHighest() const {
+        return m_highest;
+    }
+
+private:
+    std::vector<T*> m_dense;                          // Indexat direct după număr
+    std::unordered_map<std::uint64_t, T*> m_sparse;   // Folosită când ID-urile sunt rare
+    std::uint64_t m_highest;                          // Cel mai mare număr din tabelă
+};
+
+/**
+ * Scrierea octeților în fișier printr-un buffer mare, cu suma de control
+ */
+class Byte_Writer {
+public:
+    explicit Byte_Writer(std::FILE* file)
+        : m_file(file), m_buffer(new char[BUFFER_SIZE]), m_size(0), m_failed(false) {}
+
+    void WriteByte(std::uint8_t value) {
+        _Ensure(1);
+        m_buffer[m_size++] = static_cast<char>(value);
+    }
+
+    void WriteFixed32(std::uint32_t value) {
+        _Ensure(4);
+        for (int i = 0; i < 4; ++i) {
+            m_buffer[m_size++] = static_cast<char>(value >> (8 * i));
+        }
+    }
+
+    void WriteVarint(std::uint64_t value) {
+        _Ensure(10);
+        while (value >= 0x80) {
+            m_buffer[m_size++] = static_cast<char>(value | 0x80);
+            value >>= 7;
+        }
+        m_buffer[m_size++] = static_cast<char>(value);
+    }
+
+    void WriteSigned(std::int64_t value) {
+        WriteVarint(ZigZagEncode(value));
+    }
+
+    void WriteBytes(const char* data, size_t size) {
+        if (size > BUFFER_SIZE - m_size) {
+            _Flush();
+            if (size >= BUFFER_SIZE) {
+                // Blocurile mari sunt scrise direct, fără copiere
+                _WriteOut(data, size);
+                return;
+            }
+        }
+        std::memcpy(m_buffer.get() + m_size, data, size);
+        m_size += size;
+    }
+
+    void WriteString(const std::string& text) {
+        WriteVarint(text.size());
+        WriteBytes(text.data(), text.size());
+    }
+
+    /**
+     * Scrie marcajul de sfârșit și suma de control
+     */
+    bool Finish() {
+        WriteByte(Snapshot::END_MARKER);
+        _Flush();
+
+        // Suma de control nu se include pe ea însăși
+        std::uint64_t checksum = m_checksum.Finish();
+        char trailer[8];
+        for (int i = 0; i < 8; ++i) {
+            trailer[i] = static_cast<char>(checksum >> (8 * i));
+        }
+        if (std::fwrite(trailer, 1, sizeof(trailer), m_file) != sizeof(trailer)) {
+            m_failed = true;
+        }
+        return !m_failed;
+    }
+
+private:
+    std::FILE* m_file;
+    std::unique_ptr<char[]> m_buffer;
+    size_t m_size;
+    bool m_failed;
+    Snapshot::Checksum m_checksum;
+
+    void _Ensure(size_t size) {
+        if (BUFFER_SIZE - m_size < size) {
+            _Flush();
+        }
+    }
+
+    void _Flush() {
+        _WriteOut(m_buffer.get(), m_size);
+        m_size = 0;
+    }
+
+    void _WriteOut(const char* data, size_t size) {
+        m_checksum.Update(data, size);
+        if (size > 0 && std::fwrite(data, 1, size, m_file) != size) {
+            m_failed = true;
+        }
+    }
+};
+
+/**
+ * Citirea octeților din fișier printr-un buffer mare, cu suma de control
+ * După prima eroare (sfârșit de fișier, varint invalid) toate citirile întorc 0
+ */
+class Byte_Reader {
+public:
+    explicit Byte_Reader(std::FILE* file)
+        : m_file(file), m_buffer(new char[BUFFER_SIZE]), m_pos(0), m_end(0),
+          m_hashed(0), m_at_eof(false), m_failed(false) {}
+
+    bool Failed() const {
+        return m_failed;
+    }
+
+    void Fail() {
+        m_failed = true;
+    }
+
+    std::uint8_t ReadByte() {
+        if (m_pos == m_end && !_Refill(1)) {
+            m_failed = true;
+            return 0;
+        }
+        return static_cast<std::uint8_t>(m_buffer[m_pos++]);
+    }
+
+    std::uint32_t ReadFixed32() {
+        std::uint32_t value = 0;
+        for (int i = 0; i < 4; ++i) {
+            value |= static_cast<std::uint32_t>(ReadByte()) << (8 * i);
+        }
+        return value;
+    }
+
+    std::uint64_t ReadVarint() {
+        // Calea obișnuită: varint-ul întreg se află deja în buffer
+        if (m_end - m_pos < 10) {
+            _Refill(10);
+        }
+
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (m_pos == m_end) {
+                break;
+            }
+            std::uint8_t byte = static_cast<std::uint8_t>(m_buffer[m_pos++]);
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        m_failed = true;
+        return 0;
+    }
+
+    std::int64_t ReadSigned() {
+        return ZigZagDecode(ReadVarint());
+    }
+
+    void ReadString(std::string& text) {
+        std::uint64_t length = ReadVarint();
+        text.clear();
+
+        // Copiem pe bucăți, deci o lungime coruptă eșuează la sfârșitul fișierului
+        // înainte de a aloca memorie pentru ea
+        while (length > 0 && !m_failed) {
+            if (m_pos == m_end && !_Refill(1)) {
+                m_failed = true;
+                return;
+            }
+            size_t chunk = static_cast<size_t>(std::min<std::uint64_t>(length, m_end - m_pos));
+            text.append(m_buffer.get() + m_pos, chunk);
+            m_pos += chunk;
+            length -= chunk;
+        }
+    }
+
+    /**
+     * Suma de control a tuturor octeților citiți până acum
+     */
+    std::uint64_t GetChecksum() {
+        m_checksum.Update(m_buffer.get() + m_hashed, m_pos - m_hashed);
+        m_hashed = m_pos;
+        return m_checksum.Finish();
+    }
+
+    /**
+     * Verifică dacă tot fișierul a fost citit
+     */
+    bool AtEnd() {
+        return m_pos == m_end && !_Refill(1);
+    }
+
+private:
+    std::FILE* m_file;
+    std::unique_ptr<char[]> m_buffer;
+    size_t m_pos;      // Următorul octet de citit
+    size_t m_end;      // Sfârșitul datelor valide din buffer
+    size_t m_hashed;   // Octeții dinaintea acestei poziții sunt deja în suma de control
+    bool m_at_eof;
+    bool m_failed;
+    Snapshot::Checksum m_checksum;
+
+    bool _Refill(size_t wanted) {
+        // Octeții consumați intră în suma de control înainte de a fi suprascriși
+        m_checksum.Update(m_buffer.get() + m_hashed, m_pos - m_hashed);
+
+        size_t remaining = m_end - m_pos;
+        std::memmove(m_buffer.get(), m_buffer.get() + m_pos, remaining);
+        m_pos = 0;
+        m_end = remaining;
+        m_hashed = 0;
+
+        while (m_end < wanted && !m_at_eof) {
+            size_t read = std::fread(m_buffer.get() + m_end, 1, BUFFER_SIZE - m_end, m_file);
+            if (read == 0) {
+                m_at_eof = true;
+            }
+            m_end += read;
+        }
+        return m_end >= wanted;
+    }
+};
+
+/**
+ * Închide automat fișierul la ieșirea din funcție
+ */
+struct File_Closer {
+    void operator()(std::FILE* file) const {
+        std::fclose(file);
+    }
+};
+
+/**
+ * Sincronizează pe disc directorul care conține un fișier (intrarea creată de rename)
+ * @param path Calea fișierului
+ * @return true dacă sincronizarea a reușit
+ */
+bool SyncDirectoryOf(const std::string& path) {
+    size_t slash = path.rfind('/');
+    std::string directory = slash == std::string::npos ? "." : (slash == 0 ? "/" : path.substr(0, slash));
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = ::fsync(fd) == 0;
+    return ::close(fd) == 0 && ok;
+}
+
+} // namespace
+
+//
+// Suma de control
+//
+
+Snapshot::Checksum::Checksum() : m_pending_size(0), m_total(0) {
+    m_lanes[0] = PRIME_1 + PRIME_2;
+    m_lanes[1] = PRIME_2;
+    m_lanes[2] = 0;
+    m_lanes[3] = 0 - PRIME_1;
+}
+
+void Snapshot::Checksum::Update(const char* data, size_t size) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+    m_total += size;
+
+    // Completăm mai întâi blocul început la apelul anterior
+    if (m_pending_size > 0) {
+        size_t fill = std::min(size, sizeof(m_pending) - m_pending_size);
+        std::memcpy(m_pending + m_pending_size, bytes, fill);
+        m_pending_size += fill;
+        bytes += fill;
+        size -= fill;
+        if (m_pending_size < sizeof(m_pending)) {
+            return;
+        }
+        _ProcessBlock(m_pending);
+        m_pending_size = 0;
+    }
+
+    // Blocurile complete sunt procesate direct din datele primite
+    while (size >= 32) {
+        _ProcessBlock(bytes);
+        bytes += 32;
+        size -= 32;
+    }
+
+    std::memcpy(m_pending, bytes, size);
+    m_pending_size = size;
+}
+
+std::uint64_t Snapshot::Checksum::Finish() const {
+    std::uint64_t hash = RotateLeft(m_lanes[0], 1) + RotateLeft(m_lanes[1], 7) +
+                         RotateLeft(m_lanes[2], 12) + RotateLeft(m_lanes[3], 18);
+    for (int i = 0; i < 4; ++i) {
+        hash = (hash ^ (RotateLeft(m_lanes[i] * PRIME_2, 31) * PRIME_1)) * PRIME_1 + PRIME_4;
+    }
+    hash += m_total;
+
+    // Octeții rămași, câte 8 și apoi unul câte unul
+    size_t pos = 0;
+    for (; pos + 8 <= m_pending_size; pos += 8) {
+        std::uint64_t word = RotateLeft(LoadLittleEndian64(m_pending + pos) * PRIME_2, 31) * PRIME_1;
+        hash = RotateLeft(hash ^ word, 27) * PRIME_1 + PRIME_4;
+    }
+    for (; pos < m_pending_size; ++pos) {
+        hash = RotateLeft(hash ^ (m_pending[pos] * PRIME_3), 11) * PRIME_1;
+    }
+
+    // Amestecarea finală a biților
+    hash ^= hash >> 33;
+    hash *= PRIME_2;
+    hash ^= hash >> 29;
+    hash *= PRIME_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+void Snapshot::Checksum::_ProcessBlock(const unsigned char* block) {
+    // Cele patru fluxuri sunt independente, deci procesorul le calculează în paralel
+    for (int i = 0; i < 4; ++i) {
+        m_lanes[i] = RotateLeft(m_lanes[i] + LoadLittleEndian64(block + 8 * i) * PRIME_2, 31) * PRIME_1;
+    }
+}
+
+//
+// Scrierea grafului
+//
+
+class Snapshot::Graph_Writer {
+public:
+    Graph_Writer(std::FILE* file, const Task_Graph& graph) : m_out(file), m_graph(graph) {}
+
+    bool Write() {
+        if (!m_users.Build(m_graph.users, Entity_Kind::USER) ||
+            !m_categories.Build(m_graph.categories, Entity_Kind::CATEGORY) ||
+            !m_tasks.Build(m_graph.tasks, Entity_Kind::TASK) ||
+            !m_task_lists.Build(m_graph.task_lists, Entity_Kind::TASK_LIST)) {
+            return false;
+        }
+
+        m_out.WriteBytes(MAGIC, sizeof(MAGIC));
+        m_out.WriteFixed32(FORMAT_VERSION);
+        m_out.WriteVarint(m_graph.users.size());
+        m_out.WriteVarint(m_graph.categories.size());
+        m_out.WriteVarint(m_graph.tasks.size());
+        m_out.WriteVarint(m_graph.task_lists.size());
+        m_out.WriteVarint(m_graph.notes.size());
+
+        bool ok = _WriteUsers() && _WriteCategories() && _WriteTasks() &&
+                  _WriteTaskLists() && _WriteLinks() && _WriteNotes();
+        return ok && m_out.Finish();
+    }
+
+private:
+    Byte_Writer m_out;
+    const Task_Graph& m_graph;
+    Id_Table<User> m_users;
+    Id_Table<Category> m_categories;
+    Id_Table<Task> m_tasks;
+    Id_Table<Task_List> m_task_lists;
+
+    /**
+     * Scrie ID-ul propriu al unui obiect, ca diferență față de cel anterior
+     */
+    void _WriteOwnId(const Entity_Id& id, std::uint64_t& previous) {
+        m_out.WriteSigned(static_cast<std::int64_t>(id.GetNumber() - previous));
+        previous = id.GetNumber();
+    }
+
+    /**
+     * Scrie o referință; eșuează dacă obiectul referit nu face parte din graf
+     */
+    template <typename T, typename U>
+    bool _WriteRef(const Id_Table<T>& table, const U* target) {
+        if (!target) {
+            m_out.WriteVarint(0);
+            return true;
+        }
+        std::uint64_t number = target->GetId().GetNumber();
+        if (table.Find(number) != target) {
+            return false;
+        }
+        m_out.WriteVarint(number);
+        return true;
+    }
+
+    template <typename T, typename U>
+    bool _WriteRefs(const Id_Table<T>& table, const std::vector<U*>& targets) {
+        m_out.WriteVarint(targets.size());
+        for (const U* target : targets) {
+            if (!target || !_WriteRef(table, target)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool _WriteUsers() {
+        std::uint64_t previous = 0;
+        for (const User* user : m_graph.users) {
+            const Team_Leader* leader = dynamic_cast<const Team_Leader*>(user);
+            m_out.WriteByte(static_cast<std::uint8_t>(leader ? User_Type::TEAM_LEADER : User_Type::USER));
+            _WriteOwnId(user->m_id, previous);
+            m_out.WriteString(user->m_name);
+            m_out.WriteString(user->m_email);
+            m_out.WriteByte(StorageModeToByte(user->m_assigned_tasks.GetStorageMode()));
+            if (leader) {
+                m_out.WriteString(leader->GetDepartment());
+            }
+        }
+        return true;
+    }
+
+    bool _WriteCategories() {
+        std::uint64_t previous = 0;
+        for (const Category* category : m_graph.categories) {
+            _WriteOwnId(category->m_id, previous);
+            m_out.WriteString(category->m_name);
+            m_out.WriteString(category->m_description);
+            m_out.WriteByte(StorageModeToByte(category->m_tasks.GetStorageMode()));
+        }
+        return true;
+    }
+
+    bool _WriteTasks() {
+        std::uint64_t previous = 0;
+        for (const Task* task : m_graph.tasks) {
+            const std::type_info& type = typeid(*task);
+            Task_Type task_type;
+            if (type == typeid(Simple_Task)) {
+                task_type = Task_Type::SIMPLE;
+            } else if (type == typeid(Project_Task)) {
+                task_type = Task_Type::PROJECT;
+            } else if (type == typeid(Recurring_Task)) {
+                task_type = Task_Type::RECURRING;
+            } else if (type == typeid(Deadline_Task)) {
+                task_type = Task_Type::DEADLINE;
+            } else {
+                return false;  // Tip de sarcină necunoscut formatului
+            }
+
+            m_out.WriteByte(static_cast<std::uint8_t>(task_type));
+            _WriteOwnId(task->m_id, previous);
+            m_out.WriteString(task->m_title);
+            m_out.WriteString(task->m_description);
+            m_out.WriteByte(static_cast<std::uint8_t>(task->m_priority));
+            m_out.WriteByte(static_cast<std::uint8_t>(task->m_status));
+            if (!_WriteRef(m_users, task->m_assigned_user) || !_WriteRefs(m_categories, task->m_categories)) {
+                return false;
+            }
+
+            // Câmpurile specifice fiecărui tip
+            switch (task_type) {
+            case Task_Type::SIMPLE:
+                break;
+            case Task_Type::PROJECT: {
+                const Project_Task* project = static_cast<const Project_Task*>(task);
+                m_out.WriteByte(StorageModeToByte(project->m_subtasks.GetStorageMode()));
+                break;
+            }
+            case Task_Type::RECURRING: {
+                const Recurring_Task* recurring = static_cast<const Recurring_Task*>(task);
+                m_out.WriteByte(static_cast<std::uint8_t>(recurring->m_pattern));
+                m_out.WriteSigned(recurring->m_interval);
+                m_out.WriteSigned(recurring->m_occurrences_completed);
+                m_out.WriteSigned(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    recurring->m_next_occurrence.time_since_epoch()).count());
+                m_out.WriteSigned(recurring->m_anchor_day);
+                break;
+            }
+            case Task_Type::DEADLINE: {
+                Date deadline = static_cast<const Deadline_Task*>(task)->GetDeadline();
+                m_out.WriteSigned(deadline.GetYear());
+                m_out.WriteSigned(deadline.GetMonth());
+                m_out.WriteSigned(deadline.GetDay());
+                break;
+            }
+            }
+            m_out.WriteVarint(task->m_creation_sequence);
+        }
+        return true;
+    }
+
+    bool _WriteTaskLists() {
+        std::uint64_t previous = 0;
+        for (const Task_List* task_list : m_graph.task_lists) {
+            _WriteOwnId(task_list->m_id, previous);
+            m_out.WriteString(task_list->m_name);
+            m_out.WriteByte(StorageModeToByte(task_list->m_tasks.GetStorageMode()));
+            if (!_WriteRefs(m_tasks, task_list->m_tasks.GetTasks())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool _WriteLinks() {
+        // Legăturile fiecărui utilizator: sarcinile atribuite și, pentru lideri, echipa
+        for (const User* user : m_graph.users) {
+            if (!_WriteRefs(m_tasks, user->m_assigned_tasks.GetTasks())) {
+                return false;
+            }
+            const Team_Leader* leader = dynamic_cast<const Team_Leader*>(user);
+            if (leader && !_WriteRefs(m_users, leader->GetTeamMembers())) {
+                return false;
+            }
+        }
+
+        // Sarcinile fiecărei categorii
+        for (const Category* category : m_graph.categories) {
+            if (!_WriteRefs(m_tasks, category->m_tasks.GetTasks())) {
+                return false;
+            }
+        }
+
+        // Sub-sarcinile fiecărui proiect, în ordinea sarcinilor
+        for (const Task* task : m_graph.tasks) {
+            const Project_Task* project = dynamic_cast<const Project_Task*>(task);
+            if (project && !_WriteRefs(m_tasks, project->m_subtasks.GetTasks())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool _WriteNotes() {
+        for (const Task_Notes* notes : m_graph.notes) {
+            if (!notes || !_WriteRef(m_tasks, notes->GetTask())) {
+                return false;
+            }
+            const std::vector<Note>& entries = notes->GetNotes();
+            m_out.WriteVarint(entries.size());
+            for (const Note& note : entries) {
+                m_out.WriteString(note.text);
+                m_out.WriteString(note.author);
+                m_out.WriteString(note.creation_date);
+                m_out.WriteByte(note.is_important ? 1 : 0);
+            }
+        }
+        return true;
+    }
+};
+
+//
+// Citirea grafului
+//
+
+class Snapshot::Graph_Reader {
+public:
+    Graph_Reader(std::FILE* file, Task_Factory* factory) : m_in(file), m_factory(factory), m_version(0) {}
+
+    ~Graph_Reader() {
+        // Dacă citirea nu s-a încheiat cu succes, distrugem tot ce am creat
+        // Proiectele sunt distruse primele, ca sub-sarcinile să nu mai aibă părinți
+        for (Task* task : m_graph.tasks) {
+            if (dynamic_cast<Project_Task*>(task)) {
+                _DestroyTask(task);
+            }
+        }
+        for (Task* task : m_graph.tasks) {
+            if (!dynamic_cast<Project_Task*>(task)) {
+                _DestroyTask(task);
+            }
+        }
+        for (Task_Notes* notes : m_graph.notes) {
+            delete notes;
+        }
+        for (Task_List* task_list : m_graph.task_lists) {
+            delete task_list;
+        }
+        for (Category* category : m_graph.categories) {
+            delete category;
+        }
+        for (User* user : m_graph.users) {
+            delete user;
+        }
+    }
+
+    bool Read() {
+        char magic[sizeof(MAGIC)];
+        for (size_t i = 0; i < sizeof(magic); ++i) {
+            magic[i] = static_cast<char>(m_in.ReadByte());
+        }
+        if (m_in.Failed() || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+            return false;
+        }
+        m_version = m_in.ReadFixed32();
+        if (m_version == 0 || m_version > FORMAT_VERSION) {
+            return false;
+        }
+
+        std::uint64_t user_count = m_in.ReadVarint();
+        std::uint64_t category_count = m_in.ReadVarint();
+        std::uint64_t task_count = m_in.ReadVarint();
+        std::uint64_t task_list_count = m_in.ReadVarint();
+        std::uint64_t notes_count = m_in.ReadVarint();
+
+        bool ok = _ReadUsers(user_count) && _ReadCategories(category_count) &&
+                  _ReadTasks(task_count) && _ReadTaskLists(task_list_count) &&
+                  _ReadLinks() && _ReadNotes(notes_count);
+        if (!ok || m_in.Failed() || m_in.ReadByte() != END_MARKER) {
+            return false;
+        }
+
+        // Suma de control acoperă tot ce precede cei 8 octeți finali
+        std::uint64_t expected = m_in.GetChecksum();
+        std::uint64_t stored = 0;
+        for (int i = 0; i < 8; ++i) {
+            stored |= static_cast<std::uint64_t>(m_in.ReadByte()) << (8 * i);
+        }
+        return !m_in.Failed() && stored == expected && m_in.AtEnd();
+    }
+
+    /**
+     * Predă obiectele citite apelantului și continuă generarea ID-urilor după ele
+     */
+    void Commit(Task_Graph& graph) {
+        Id_Allocator& allocator = Id_Allocator::GetInstance();
+        allocator.ResumeFrom(Entity_Id(Entity_Kind::USER, m_users.GetHighest()));
+        allocator.ResumeFrom(Entity_Id(Entity_Kind::CATEGORY, m_categories.GetHighest()));
+        allocator.ResumeFrom(Entity_Id(Entity_Kind::TASK, m_tasks.GetHighest()));
+        allocator.ResumeFrom(Entity_Id(Entity_Kind::TASK_LIST, m_task_lists.GetHighest()));
+
+        _Append(graph.users, m_graph.users);
+        _Append(graph.categories, m_graph.categories);
+        _Append(graph.tasks, m_graph.tasks);
+        _Append(graph.task_lists, m_graph.task_lists);
+        _Append(graph.notes, m_graph.notes);
+    }
+
+private:
+    Byte_Reader m_in;
+    Task_Factory* m_factory;
+    std::uint32_t m_version;  // Versiunea formatului fișierului citit
+    Task_Graph m_graph;  // Obiectele create; deținute de cititor până la Commit
+    Id_Table<User> m_users;
+    Id_Table<Category> m_categories;
+    Id_Table<Task> m_tasks;
+    Id_Table<Task_List> m_task_lists;
+    std::vector<Task*> m_refs_buffer;  // Refolosit la citirea listelor de referințe
+
+    template <typename T>
+    static void _Append(std::vector<T*>& target, std::vector<T*>& source) {
+        target.insert(target.end(), source.begin(), source.end());
+        source.clear();
+    }
+
+    template <typename T>
+    static void _Reserve(std::vector<T>& entries, std::uint64_t count) {
+        entries.reserve(static_cast<size_t>(std::min(count, MAX_RESERVE)));
+    }
+
+    template <typename T, typename... Args>
+    T* _CreateTask(Args&&... args) {
+        if (m_factory) {
+            return m_factory->Create<T>(std::forward<Args>(args)...);
+        }
+        return new T(std::forward<Args>(args)...);
+    }
+
+    void _DestroyTask(Task* task) {
+        if (m_factory) {
+            m_factory->Destroy(task);
+        } else {
+            delete task;
+        }
+    }
+
+    /**
+     * Citește ID-ul propriu al unui obiect, scris ca diferență față de cel anterior
+     */
+    bool _ReadOwnId(Entity_Kind kind, std::uint64_t& previous, Entity_Id& id) {
+        std::uint64_t number = previous + static_cast<std::uint64_t>(m_in.ReadSigned());
+        if (m_in.Failed() || number == 0 || number > Entity_Id::MAX_NUMBER) {
+            return false;
+        }
+        previous = number;
+        id = Entity_Id(kind, number);
+        return true;
+    }
+
+    /**
+     * Citește o referință; eșuează dacă obiectul referit nu există
+     */
+    template <typename T>
+    bool _ReadRef(const Id_Table<T>& table, T*& target) {
+        std::uint64_t number = m_in.ReadVarint();
+        target = number ? table.Find(number) : nullptr;
+        return !m_in.Failed() && (number == 0 || target != nullptr);
+    }
+
+    template <typename T>
+    bool _ReadRefs(const Id_Table<T>& table, std::vector<T*>& targets) {
+        std::uint64_t count = m_in.ReadVarint();
+        targets.clear();
+        _Reserve(targets, count);
+        for (std::uint64_t i = 0; i < count; ++i) {
+            T* target = table.Find(m_in.ReadVarint());
+            if (m_in.Failed() || !target) {
+                return false;
+            }
+            targets.push_back(target);
+        }
+        return !m_in.Failed();
+    }
+
+    bool _ReadStorageMode(Task_Collection::Storage_Mode& mode) {
+        std::uint8_t value = m_in.ReadByte();
+        mode = value == 1 ? Task_Collection::Storage_Mode::INDEXED : Task_Collection::Storage_Mode::ORDERED;
+        return !m_in.Failed() && value <= 1;
+    }
+
+    bool _ReadUsers(std::uint64_t count) {
+        _Reserve(m_graph.users, count);
+        std::uint64_t previous = 0;
+        std::string name;
+        std::string email;
+        std::string department;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            std::uint8_t type = m_in.ReadByte();
+            Entity_Id id;
+            Task_Collection::Storage_Mode mode;
+            if (!_ReadOwnId(Entity_Kind::USER, previous, id)) {
+                return false;
+            }
+            m_in.ReadString(name);
+            m_in.ReadString(email);
+            if (!_ReadStorageMode(mode)) {
+                return false;
+            }
+
+            User* user = nullptr;
+            if (type == static_cast<std::uint8_t>(User_Type::TEAM_LEADER)) {
+                m_in.ReadString(department);
+                user = new Team_Leader(name, email, department);
+            } else if (type == static_cast<std::uint8_t>(User_Type::USER)) {
+                user = new User(name, email);
+            } else {
+                return false;
+            }
+            m_graph.users.push_back(user);
+            user->m_id = id;
+            user->SetStorageMode(mode);
+        }
+        return !m_in.Failed() && m_users.Build(m_graph.users, Entity_Kind::USER);
+    }
+
+    bool _ReadCategories(std::uint64_t count) {
+        _Reserve(m_graph.categories, count);
+        std::uint64_t previous = 0;
+        std::string name;
+        std::string description;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            Entity_Id id;
+            Task_Collection::Storage_Mode mode;
+            if (!_ReadOwnId(Entity_Kind::CATEGORY, previous, id)) {
+                return false;
+            }
+            m_in.ReadString(name);
+            m_in.ReadString(description);
+            if (!_ReadStorageMode(mode)) {
+                return false;
+            }
+
+            Category* category = new Category(name, description);
+            m_graph.categories.push_back(category);
+            category->m_id = id;
+            category->SetStorageMode(mode);
+        }
+        return !m_in.Failed() && m_categories.Build(m_graph.categories, Entity_Kind::CATEGORY);
+    }
+
+    bool _ReadTasks(std::uint64_t count) {
+        _Reserve(m_graph.tasks, count);
+        std::uint64_t previous = 0;
+        std::string title;
+        std::string description;
+        std::vector<Category*> categories;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            std::uint8_t type = m_in.ReadByte();
+            Entity_Id id;
+            if (!_ReadOwnId(Entity_Kind::TASK, previous, id)) {
+                return false;
+            }
+            m_in.ReadString(title);
+            m_in.ReadString(description);
+            std::uint8_t priority = m_in.ReadByte();
+            std::uint8_t status = m_in.ReadByte();
+            User* assigned_user = nullptr;
+            if (!_ReadRef(m_users, assigned_user) || !_ReadRefs(m_categories, categories) ||
+                priority > static_cast<std::uint8_t>(Priority::URGENT) ||
+                status > static_cast<std::uint8_t>(TaskStatus::CANCELLED)) {
+                return false;
+            }
+
+            Task* task = _ReadTaskSpecific(type, title, description, static_cast<Priority>(priority));
+            if (!task) {
+                return false;
+            }
+            m_graph.tasks.push_back(task);
+            if (m_version >= 3) {
+                // Fișierele mai vechi păstrează ordinea citirii, dată de constructor
+                task->m_creation_sequence = m_in.ReadVarint();
+                Task::_ResumeCreationSequence(task->m_creation_sequence);
+            }
+            task->m_id = id;
+            task->m_status = static_cast<TaskStatus>(status);
+            task->m_assigned_user = assigned_user;
+            task->m_categories = categories;
+        }
+        return !m_in.Failed() && m_tasks.Build(m_graph.tasks, Entity_Kind::TASK);
+    }
+
+    /**
+     * Citește câmpurile specifice tipului și creează sarcina
+     * @return Sarcina creată sau nullptr dacă datele sunt invalide
+     */
+    Task* _ReadTaskSpecific(std::uint8_t type, const std::string& title, const std::string& description,
+                            Priority priority) {
+        switch (static_cast<Task_Type>(type)) {
+        case Task_Type::SIMPLE:
+            return _CreateTask<Simple_Task>(title, description, priority);
+        case Task_Type::PROJECT: {
+            Task_Collection::Storage_Mode mode;
+            if (!_ReadStorageMode(mode)) {
+                return nullptr;
+            }
+            Project_Task* project = _CreateTask<Project_Task>(title, description, priority);
+            project->SetStorageMode(mode);
+            return project;
+        }
+        case Task_Type::RECURRING: {
+            std::uint8_t pattern = m_in.ReadByte();
+            std::int64_t interval = m_in.ReadSigned();
+            std::int64_t occurrences = m_in.ReadSigned();
+            std::int64_t next_occurrence = m_in.ReadSigned();
+            std::int64_t anchor_day = m_version >= 2 ? m_in.ReadSigned() : 0;
+            if (m_in.Failed() || pattern > static_cast<std::uint8_t>(Recurring_Task::RecurrencePattern::YEARLY) ||
+                anchor_day < 0 || anchor_day > 31) {
+                return nullptr;
+            }
+            Recurring_Task* recurring = _CreateTask<Recurring_Task>(
+                title, description, priority,
+                static_cast<Recurring_Task::RecurrencePattern>(pattern), static_cast<int>(interval));
+            recurring->m_occurrences_completed = static_cast<int>(occurrences);
+            recurring->_SetNextOccurrence(std::chrono::system_clock::time_point(
+                std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::nanoseconds(next_occurrence))));
+            if (anchor_day != 0) {
+                recurring->m_anchor_day = static_cast<int>(anchor_day);
+            }
+            return recurring;
+        }
+        case Task_Type::DEADLINE: {
+            int year = static_cast<int>(m_in.ReadSigned());
+            int month = static_cast<int>(m_in.ReadSigned());
+            int day = static_cast<int>(m_in.ReadSigned());
+            if (m_in.Failed()) {
+                return nullptr;
+            }
+            return _CreateTask<Deadline_Task>(title, description, priority, Date(year, month, day));
+        }
+        }
+        return nullptr;
+    }
+
+    bool _ReadTaskLists(std::uint64_t count) {
+        _Reserve(m_graph.task_lists, count);
+        std::uint64_t previous = 0;
+        std::string name;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            Entity_Id id;
+            Task_Collection::Storage_Mode mode;
+            if (!_ReadOwnId(Entity_Kind::TASK_LIST, previous, id)) {
+                return false;
+            }
+            m_in.ReadString(name);
+            if (!_ReadStorageMode(mode) || !_ReadRefs(m_tasks, m_refs_buffer)) {
+                return false;
+            }
+
+            Task_List* task_list = new Task_List(name);
+            m_graph.task_lists.push_back(task_list);
+            task_list->m_id = id;
+            task_list->SetStorageMode(mode);
+            task_list->AddTasks(m_refs_buffer);
+        }
+        return !m_in.Failed() && m_task_lists.Build(m_graph.task_lists, Entity_Kind::TASK_LIST);
+    }
+
+    bool _ReadLinks() {
+        std::vector<User*> members;
+        for (User* user : m_graph.users) {
+            if (!_ReadRefs(m_tasks, m_refs_buffer)) {
+                return false;
+            }
+            user->AddAssignedTasks(m_refs_buffer);
+
+            Team_Leader* leader = dynamic_cast<Team_Leader*>(user);
+            if (leader) {
+                if (!_ReadRefs(m_users, members)) {
+                    return false;
+                }
+                for (User* member : members) {
+                    leader->AddTeamMember(member);
+                }
+            }
+        }
+
+        // Legăturile inverse (Task::m_categories) au fost deja citite cu sarcinile,
+        // deci completăm direct colecția categoriei
+        for (Category* category : m_graph.categories) {
+            if (!_ReadRefs(m_tasks, m_refs_buffer)) {
+                return false;
+            }
+            category->m_tasks.AddRange(m_refs_buffer.data(), m_refs_buffer.size());
+        }
+
+        for (Task* task : m_graph.tasks) {
+            Project_Task* project = dynamic_cast<Project_Task*>(task);
+            if (!project) {
+                continue;
+            }
+            if (!_ReadRefs(m_tasks, m_refs_buffer)) {
+                return false;
+            }
+            for (Task* subtask : m_refs_buffer) {
+                project->AddSubtask(subtask);
+            }
+        }
+        return true;
+    }
+
+    bool _ReadNotes(std::uint64_t count) {
+        _Reserve(m_graph.notes, count);
+        for (std::uint64_t i = 0; i < count; ++i) {
+            Task* task = nullptr;
+            if (!_ReadRef(m_tasks, task)) {
+                return false;
+            }
+            Task_Notes* notes = new Task_Notes(task);
+            m_graph.notes.push_back(notes);
+
+            std::uint64_t note_count = m_in.ReadVarint();
+            for (std::uint64_t j = 0; j < note_count && !m_in.Failed(); ++j) {
+                Note note;
+                m_in.ReadString(note.text);
+                m_in.ReadString(note.author);
+                m_in.ReadString(note.creation_date);
+                note.is_important = m_in.ReadByte() != 0;
+                notes->AddNote(note);
+            }
+        }
+        return !m_in.Failed();
+    }
+};
+
+//
+// Interfața publică
+//
+
+bool Snapshot::Save(const std::string& path, const Task_Graph& graph) {
+    // Scriem într-un fișier temporar, deci snapshot-ul anterior rămâne intact (și
+    // mapările Snapshot_View ale lui rămân valide) până la rename
+    std::string temporary_path = path + ".tmp";
+    std::unique_ptr<std::FILE, File_Closer> file(std::fopen(temporary_path.c_str(), "wb"));
+    if (!file) {
+        return false;
+    }
+    // Folosim propriul buffer de 1 MB, deci dezactivăm buffer-ul bibliotecii
+    std::setvbuf(file.get(), nullptr, _IONBF, 0);
+
+    Graph_Writer writer(file.get(), graph);
+    bool ok = writer.Write() && std::fflush(file.get()) == 0 && ::fsync(::fileno(file.get())) == 0;
+    ok = std::fclose(file.release()) == 0 && ok;
+    if (!ok || std::rename(temporary_path.c_str(), path.c_str()) != 0) {
+        std::remove(temporary_path.c_str());
+        return false;
+    }
+    // Fără sincronizarea directorului, după o cădere de tensiune numele poate indica tot
+    // fișierul vechi (sau niciunul)
+    return SyncDirectoryOf(path);
+}
+
+bool Snapshot::Load(const std::string& path, Task_Graph& graph, Task_Factory* factory) {
+    std::unique_ptr<std::FILE, File_Closer> file(std::fopen(path.c_str(), "rb"));
+    if (!file) {
+        return false;
+    }
+    std::setvbuf(file.get(), nullptr, _IONBF, 0);
+
+    Graph_Reader reader(file.get(), factory);
+    if (!reader.Read()) {
+        return false;
+    }
+    reader.Commit(graph);
+    return true;
+}
+
+} // namespace Task_Management
@@ -0,0 +1,732 @@
+#include "snapshot_view.h"
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Task_Management {
+
+namespace {
+
+/**
+ * Cursor de citire peste octeții mapați, cu verificarea limitelor
+ * După prima depășire toate citirile întorc 0 și failed rămâne true
+ */
+struct Cursor {
+    const unsigned char* pos;
+    const unsigned char* end;
+    bool failed;
+
+    Cursor(const unsigned char* pos, const unsigned char* end) : pos(pos), end(end), failed(false) {}
+
+    std::uint8_t Byte() {
+        if (pos == end) {
+            failed = true;
+            return 0;
+        }
+        return *pos++;
+    }
+
+    std::uint64_t Varint() {
+        std::uint64_t value = 0;
+        for (int shift = 0; shift < 64 && pos != end; shift += 7) {
+            std::uint8_t byte = *pos++;
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        failed = true;
+        return 0;
+    }
+
+    std::int64_t Signed() {
+        std::uint64_t value = Varint();
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    String_View String() {
+        std::uint64_t length = Varint();
+        if (length > static_cast<std::uint64_t>(end - pos)) {
+            failed = true;
+            return String_View();
+        }
+        String_View text(reinterpret_cast<const char*>(pos), static_cast<size_t>(length));
+        pos += length;
+        return text;
+    }
+
+    void SkipRefs() {
+        std::uint64_t count = Varint();
+        for (std::uint64_t i = 0; i < count && !failed; ++i) {
+            Varint();
+        }
+    }
+};
+
+/**
+ * Câmpurile unei sarcini, decodificate din fișier
+ */
+struct Task_Fields {
+    Snapshot::Task_Type type;
+    String_View title;
+    String_View description;
+    Priority priority;
+    TaskStatus status;
+    std::uint64_t assigned_user;          // Numărul ID-ului utilizatorului (0 = niciunul)
+    const unsigned char* categories;      // Începutul listei de categorii
+    const unsigned char* specific;        // Începutul câmpurilor specifice tipului
+};
+
+Task_Fields DecodeTask(const unsigned char* data, size_t size, std::uint64_t offset) {
+    // Înregistrarea a fost validată la deschidere, deci o putem decodifica direct
+    Cursor in(data + offset, data + size);
+    Task_Fields fields;
+    fields.type = static_cast<Snapshot::Task_Type>(in.Byte());
+    in.Varint();  // ID-ul, deja reținut în Record
+    fields.title = in.String();
+    fields.description = in.String();
+    fields.priority = static_cast<Priority>(in.Byte());
+    fields.status = static_cast<TaskStatus>(in.Byte());
+    fields.assigned_user = in.Varint();
+    fields.categories = in.pos;
+    in.SkipRefs();
+    fields.specific = in.pos;
+    return fields;
+}
+
+/**
+ * Câmpurile unui utilizator, decodificate din fișier
+ */
+struct User_Fields {
+    bool is_team_leader;
+    String_View name;
+    String_View email;
+    String_View department;
+};
+
+User_Fields DecodeUser(const unsigned char* data, size_t size, std::uint64_t offset) {
+    Cursor in(data + offset, data + size);
+    User_Fields fields;
+    fields.is_team_leader = in.Byte() == static_cast<std::uint8_t>(Snapshot::User_Type::TEAM_LEADER);
+    in.Varint();
+    fields.name = in.String();
+    fields.email = in.String();
+    in.Byte();  // Modul de stocare
+    if (fields.is_team_leader) {
+        fields.department = in.String();
+    }
+    return fields;
+}
+
+} // namespace
+
+//
+// String_View
+//
+
+bool String_View::Contains(const std::string& keyword, bool ignore_case) const {
+    return Contains(Text_Matcher(keyword, ignore_case));
+}
+
+bool String_View::operator==(const std::string& other) const {
+    return size == other.size() && (size == 0 || std::memcmp(data, other.data(), size) == 0);
+}
+
+std::ostream& operator<<(std::ostream& os, const String_View& text) {
+    os.write(text.data, static_cast<std::streamsize>(text.size));
+    return os;
+}
+
+//
+// Task_View
+//
+
+Entity_Id Task_View::GetId() const {
+    return Entity_Id(Entity_Kind::TASK, m_view->m_tasks[m_index].number);
+}
+
+Snapshot::Task_Type Task_View::GetType() const {
+    return static_cast<Snapshot::Task_Type>(m_view->m_data[m_view->m_tasks[m_index].offset]);
+}
+
+std::string Task_View::GetTaskType() const {
+    // Aceleași texte ca GetTaskType() din clasele derivate din Task
+    switch (GetType()) {
+        case Snapshot::Task_Type::SIMPLE: return "Simple Task";
+        case Snapshot::Task_Type::PROJECT: return "Project Task";
+        case Snapshot::Task_Type::RECURRING: return "Recurring Task";
+        case Snapshot::Task_Type::DEADLINE: return "Deadline Task";
+        default: return "Unknown";
+    }
+}
+
+String_View Task_View::GetTitle() const {
+    return DecodeTask(m_view->m_data, m_view->m_size, m_view->m_tasks[m_index].offset).title;
+}
+
+String_View Task_View::GetDescription() const {
+    return DecodeTask(m_view->m_data, m_view->m_size, m_view->m_tasks[m_index].offset).description;
+}
+
+Priority Task_View::GetPriority() const {
+    return DecodeTask(m_view->m_data, m_view->m_size, m_view->m_tasks[m_index].offset).priority;
+}
+
+TaskStatus Task_View::GetStatus() const {
+    return DecodeTask(m_view->m_data, m_view->m_size, m_view->m_tasks[m_index].offset).status;
+}
+
+User_View Task_View::GetAssignedUser() const {
+    std::uint64_t number = DecodeTask(m_view->m_data, m_view->m_size, m_view->m_tasks[m_index].offset).assigned_user;
+    size_t index = number ? m_view->m_user_index.Find(number) : Snapshot_View::NOT_FOUND;
+    return index != Snapshot_View::NOT_FOUND ? User_View(m_view, index) : User_View();
+}
+
+std::vector<Category_View> Task_View::GetCategories() const {
+    Task_Fields fields = DecodeTask(m_view->m_data, m_view->m_size, m_view->m_tasks[m_index].offset);
+    Cursor in(fields.categories, m_view->m_data + m_view->m_size);
+
+    std::uint64_t count = in.Varint();
+    std::vector<Category_View> categories;
+    categories.reserve(static_cast<size_t>(count));
+    for (std::uint64_t i = 0; i < count; ++i) {
+        size_t index = m_view->m_category_index.Find(in.Varint());
+        if (index != Snapshot_View::NOT_FOUND) {
+            categories.push_back(Category_View(m_view, index));
+        }
+    }
+    return categories;
+}
+
+std::vector<Task_View> Task_View::GetSubtasks() const {
+    std::uint64_t offset = m_view->m_task_links[m_index];
+    return offset ? m_view->_TasksAt(offset) : std::vector<Task_View>();
+}
+
+Date Task_View::GetDeadline() const {
+    Task_Fields fields = DecodeTask(m_view->m_data, m_view->m_size, m_view->m_tasks[m_index].offset);
+    if (fields.type != Snapshot::Task_Type::DEADLINE) {
+        return Date();
+    }
+    Cursor in(fields.specific, m_view->m_data + m_view->m_size);
+    int year = static_cast<int>(in.Signed());
+    int month = static_cast<int>(in.Signed());
+    int day = static_cast<int>(in.Signed());
+    return Date(year, month, day);
+}
+
+//
+// User_View
+//
+
+Entity_Id User_View::GetId() const {
+    return Entity_Id(Entity_Kind::USER, m_view->m_users[m_index].number);
+}
+
+String_View User_View::GetName() const {
+    return DecodeUser(m_view->m_data, m_view->m_size, m_view->m_users[m_index].offset).name;
+}
+
+String_View User_View::GetEmail() const {
+    return DecodeUser(m_view->m_data, m_view->m_size, m_view->m_users[m_index].offset).email;
+}
+
+bool User_View::IsTeamLeader() const {
+    return DecodeUser(m_view->m_data, m_view->m_size, m_view->m_users[m_index].offset).is_team_leader;
+}
+
+String_View User_View::GetDepartment() const {
+    return DecodeUser(m_view->m_data, m_view->m_size, m_view->m_users[m_index].offset).department;
+}
+
+std::vector<Task_View> User_View::GetAssignedTasks() const {
+    return m_view->_TasksAt(m_view->m_user_links[m_index]);
+}
+
+std::vector<User_View> User_View::GetTeamMembers() const {
+    if (!IsTeamLeader()) {
+        return std::vector<User_View>();
+    }
+    // Echipa urmează imediat după lista sarcinilor atribuite
+    Cursor in(m_view->m_data + m_view->m_user_links[m_index], m_view->m_data + m_view->m_size);
+    in.SkipRefs();
+    return m_view->_UsersAt(static_cast<std::uint64_t>(in.pos - m_view->m_data));
+}
+
+//
+// Category_View
+//
+
+Entity_Id Category_View::GetId() const {
+    return Entity_Id(Entity_Kind::CATEGORY, m_view->m_categories[m_index].number);
+}
+
+String_View Category_View::GetName() const {
+    Cursor in(m_view->m_data + m_view->m_categories[m_index].offset, m_view->m_data + m_view->m_size);
+    in.Varint();
+    return in.String();
+}
+
+String_View Category_View::GetDescription() const {
+    Cursor in(m_view->m_data + m_view->m_categories[m_index].offset, m_view->m_data + m_view->m_size);
+    in.Varint();
+    in.String();
+    return in.String();
+}
+
+std::vector<Task_View> Category_View::GetTasks() const {
+    return m_view->_TasksAt(m_view->m_category_links[m_index]);
+}
+
+size_t Category_View::GetTaskCount() const {
+    Cursor in(m_view->m_data + m_view->m_category_links[m_index], m_view->m_data + m_view->m_size);
+    return static_cast<size_t>(in.Varint());
+}
+
+//
+// Task_List_View
+//
+
+Entity_Id Task_List_View::GetId() const {
+    return Entity_Id(Entity_Kind::TASK_LIST, m_view->m_task_lists[m_index].number);
+}
+
+String_View Task_List_View::GetName() const {
+    Cursor in(m_view->m_data + m_view->m_task_lists[m_index].offset, m_view->m_data + m_view->m_size);
+    in.Varint();
+    return in.String();
+}
+
+std::vector<Task_View> Task_List_View::GetTasks() const {
+    // Sarcinile urmează după nume și modul de stocare
+    Cursor in(m_view->m_data + m_view->m_task_lists[m_index].offset, m_view->m_data + m_view->m_size);
+    in.Varint();
+    in.String();
+    in.Byte();
+    return m_view->_TasksAt(static_cast<std::uint64_t>(in.pos - m_view->m_data));
+}
+
+size_t Task_List_View::GetTaskCount() const {
+    Cursor in(m_view->m_data + m_view->m_task_lists[m_index].offset, m_view->m_data + m_view->m_size);
+    in.Varint();
+    in.String();
+    in.Byte();
+    return static_cast<size_t>(in.Varint());
+}
+
+//
+// Task_Notes_View
+//
+
+Task_View Task_Notes_View::GetTask() const {
+    Cursor in(m_view->m_data + m_view->m_task_notes[m_index], m_view->m_data + m_view->m_size);
+    std::uint64_t number = in.Varint();
+    size_t index = number ? m_view->m_task_index.Find(number) : Snapshot_View::NOT_FOUND;
+    return index != Snapshot_View::NOT_FOUND ? Task_View(m_view, index) : Task_View();
+}
+
+std::vector<Note_View> Task_Notes_View::GetNotes() const {
+    Cursor in(m_view->m_data + m_view->m_task_notes[m_index], m_view->m_data + m_view->m_size);
+    in.Varint();
+
+    std::uint64_t count = in.Varint();
+    std::vector<Note_View> notes;
+    notes.reserve(static_cast<size_t>(count));
+    for (std::uint64_t i = 0; i < count; ++i) {
+        Note_View note;
+        note.text = in.String();
+        note.author = in.String();
+        note.creation_date = in.String();
+        note.is_important = in.Byte() != 0;
+        notes.push_back(note);
+    }
+    return notes;
+}
+
+std::vector<Note_View> Task_Notes_View::SearchNotes(const std::string& keyword, bool ignore_case) const {
+    // Ca Task_Notes::SearchNotes, dar fără a copia textele
+    std::vector<Note_View> result;
+    Text_Matcher matcher(keyword, ignore_case);
+    for (const Note_View& note : GetNotes()) {
+        if (note.text.Contains(matcher)) {
+            result.push_back(note);
+        }
+    }
+    return result;
+}
+
+//
+// Snapshot_View
+//
+
+const size_t Snapshot_View::NOT_FOUND;
+
+void Snapshot_View::Id_Index::Build(const std::vector<Record>& records) {
+    Clear();
+    std::uint64_t highest = 0;
+    for (const Record& record : records) {
+        highest = std::max(highest, record.number);
+    }
+
+    // ID-urile aproape consecutive folosesc un vector indexat direct după număr
+    if (highest <= records.size() * 2 + 1024 && records.size() < UINT32_MAX) {
+        m_dense.assign(static_cast<size_t>(highest) + 1, UINT32_MAX);
+        for (size_t i = 0; i < records.size(); ++i) {
+            m_dense[static_cast<size_t>(records[i].number)] = static_cast<std::uint32_t>(i);
+        }
+        return;
+    }
+
+    m_sparse.reserve(records.size());
+    for (size_t i = 0; i < records.size(); ++i) {
+        m_sparse.emplace(records[i].number, i);
+    }
+}
+
+size_t Snapshot_View::Id_Index::Find(std::uint64_t number) const {
+    if (!m_dense.empty()) {
+        if (number >= m_dense.size() || m_dense[static_cast<size_t>(number)] == UINT32_MAX) {
+            return NOT_FOUND;
+        }
+        return m_dense[static_cast<size_t>(number)];
+    }
+    auto it = m_sparse.find(number);
+    return it != m_sparse.end() ? it->second : NOT_FOUND;
+}
+
+void Snapshot_View::Id_Index::Clear() {
+    m_dense.clear();
+    m_sparse.clear();
+}
+
+Snapshot_View::Snapshot_View() : m_data(nullptr), m_size(0) {
+    // Vederea este închisă până la Open()
+}
+
+Snapshot_View::~Snapshot_View() {
+    Close();
+}
+
+bool Snapshot_View::Open(const std::string& path, bool verify_checksum) {
+    Close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    // Maparea rămâne validă și după închiderea descriptorului
+    void* mapping = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    m_data = static_cast<const unsigned char*>(mapping);
+    m_size = static_cast<size_t>(info.st_size);
+
+    // Indexarea parcurge fișierul o singură dată, secvențial
+    ::madvise(mapping, m_size, MADV_SEQUENTIAL);
+    bool ok = _Index();
+    if (ok && verify_checksum) {
+        Snapshot::Checksum checksum;
+        checksum.Update(reinterpret_cast<const char*>(m_data), m_size - 8);
+        std::uint64_t stored = 0;
+        for (int i = 0; i < 8; ++i) {
+            stored |= static_cast<std::uint64_t>(m_data[m_size - 8 + i]) << (8 * i);
+        }
+        ok = stored == checksum.Finish();
+    }
+    if (!ok) {
+        Close();
+        return false;
+    }
+
+    // Interogările ulterioare accesează fișierul în ordine arbitrară
+    ::madvise(mapping, m_size, MADV_RANDOM);
+    return true;
+}
+
+void Snapshot_View::Close() {
+    if (m_data) {
+        ::munmap(const_cast<unsigned char*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+
+    m_users.clear();
+    m_categories.clear();
+    m_tasks.clear();
+    m_task_lists.clear();
+    m_task_notes.clear();
+    m_user_links.clear();
+    m_category_links.clear();
+    m_task_links.clear();
+    m_user_index.Clear();
+    m_category_index.Clear();
+    m_task_index.Clear();
+    m_task_list_index.Clear();
+}
+
+bool Snapshot_View::IsOpen() const {
+    return m_data != nullptr;
+}
+
+size_t Snapshot_View::GetUserCount() const {
+    return m_users.size();
+}
+
+size_t Snapshot_View::GetCategoryCount() const {
+    return m_categories.size();
+}
+
+size_t Snapshot_View::GetTaskCount() const {
+    return m_tasks.size();
+}
+
+size_t Snapshot_View::GetTaskListCount() const {
+    return m_task_lists.size();
+}
+
+size_t Snapshot_View::GetTaskNotesCount() const {
+    return m_task_notes.size();
+}
+
+User_View Snapshot_View::GetUser(size_t index) const {
+    return index < m_users.size() ? User_View(this, index) : User_View();
+}
+
+Category_View Snapshot_View::GetCategory(size_t index) const {
+    return index < m_categories.size() ? Category_View(this, index) : Category_View();
+}
+
+Task_View Snapshot_View::GetTask(size_t index) const {
+    return index < m_tasks.size() ? Task_View(this, index) : Task_View();
+}
+
+Task_List_View Snapshot_View::GetTaskList(size_t index) const {
+    return index < m_task_lists.size() ? Task_List_View(this, index) : Task_List_View();
+}
+
+Task_Notes_View Snapshot_View::GetTaskNotes(size_t index) const {
+    return index < m_task_notes.size() ? Task_Notes_View(this, index) : Task_Notes_View();
+}
+
+User_View Snapshot_View::FindUser(const Entity_Id& id) const {
+    size_t index = id.GetKind() == Entity_Kind::USER ? m_user_index.Find(id.GetNumber()) : NOT_FOUND;
+    return index != NOT_FOUND ? User_View(this, index) : User_View();
+}
+
+Category_View Snapshot_View::FindCategory(const Entity_Id& id) const {
+    size_t index = id.GetKind() == Entity_Kind::CATEGORY ? m_category_index.Find(id.GetNumber()) : NOT_FOUND;
+    return index != NOT_FOUND ? Category_View(this, index) : Category_View();
+}
+
+Task_View Snapshot_View::FindTask(const Entity_Id& id) const {
+    size_t index = id.GetKind() == Entity_Kind::TASK ? m_task_index.Find(id.GetNumber()) : NOT_FOUND;
+    return index != NOT_FOUND ? Task_View(this, index) : Task_View();
+}
+
+Task_List_View Snapshot_View::FindTaskList(const Entity_Id& id) const {
+    size_t index = id.GetKind() == Entity_Kind::TASK_LIST ? m_task_list_index.Find(id.GetNumber()) : NOT_FOUND;
+    return index != NOT_FOUND ? Task_List_View(this, index) : Task_List_View();
+}
+
+bool Snapshot_View::_Index() {
+    // Ultimii 8 octeți sunt suma de control
+    if (m_size < sizeof(Snapshot::MAGIC) + 4 + 8 ||
+        std::memcmp(m_data, Snapshot::MAGIC, sizeof(Snapshot::MAGIC)) != 0) {
+        return false;
+    }
+    Cursor in(m_data + sizeof(Snapshot::MAGIC), m_data + m_size - 8);
+
+    std::uint32_t version = 0;
+    for (int i = 0; i < 4; ++i) {
+        version |= static_cast<std::uint32_t>(in.Byte()) << (8 * i);
+    }
+    if (version == 0 || version > Snapshot::FORMAT_VERSION) {
+        return false;
+    }
+
+    std::uint64_t counts[5];
+    for (int i = 0; i < 5; ++i) {
+        counts[i] = in.Varint();
+        // Fiecare obiect ocupă cel puțin un octet, deci numărul nu poate depăși fișierul
+        if (counts[i] > m_size) {
+            return false;
+        }
+    }
+
+    // Utilizatorii
+    std::uint64_t previous = 0;
+    m_users.reserve(static_cast<size_t>(counts[0]));
+    for (std::uint64_t i = 0; i < counts[0] && !in.failed; ++i) {
+        Record record = {static_cast<std::uint64_t>(in.pos - m_data), 0};
+        std::uint8_t type = in.Byte();
+        record.number = previous += static_cast<std::uint64_t>(in.Signed());
+        in.String();
+        in.String();
+        in.Byte();
+        if (type == static_cast<std::uint8_t>(Snapshot::User_Type::TEAM_LEADER)) {
+            in.String();
+        } else if (type != static_cast<std::uint8_t>(Snapshot::User_Type::USER)) {
+            return false;
+        }
+        m_users.push_back(record);
+    }
+
+    // Categoriile
+    previous = 0;
+    m_categories.reserve(static_cast<size_t>(counts[1]));
+    for (std::uint64_t i = 0; i < counts[1] && !in.failed; ++i) {
+        Record record = {static_cast<std::uint64_t>(in.pos - m_data), 0};
+        record.number = previous += static_cast<std::uint64_t>(in.Signed());
+        in.String();
+        in.String();
+        in.Byte();
+        m_categories.push_back(record);
+    }
+
+    // Sarcinile
+    previous = 0;
+    m_tasks.reserve(static_cast<size_t>(counts[2]));
+    for (std::uint64_t i = 0; i < counts[2] && !in.failed; ++i) {
+        Record record = {static_cast<std::uint64_t>(in.pos - m_data), 0};
+        std::uint8_t type = in.Byte();
+        record.number = previous += static_cast<std::uint64_t>(in.Signed());
+        in.String();
+        in.String();
+        if (in.Byte() > static_cast<std::uint8_t>(Priority::URGENT) ||
+            in.Byte() > static_cast<std::uint8_t>(TaskStatus::CANCELLED)) {
+            return false;
+        }
+        in.Varint();
+        in.SkipRefs();
+        switch (static_cast<Snapshot::Task_Type>(type)) {
+            case Snapshot::Task_Type::SIMPLE:
+                break;
+            case Snapshot::Task_Type::PROJECT:
+                in.Byte();
+                break;
+            case Snapshot::Task_Type::RECURRING:
+                in.Byte();
+                in.Signed();
+                in.Signed();
+                in.Signed();
+                if (version >= 2) {
+                    in.Signed();  // Ziua de referință
+                }
+                break;
+            case Snapshot::Task_Type::DEADLINE:
+                in.Signed();
+                in.Signed();
+                in.Signed();
+                break;
+            default:
+                return false;
+        }
+        if (version >= 3) {
+            in.Varint();  // Numărul de ordine al creării
+        }
+        m_tasks.push_back(record);
+    }
+
+    // Listele de sarcini
+    previous = 0;
+    m_task_lists.reserve(static_cast<size_t>(counts[3]));
+    for (std::uint64_t i = 0; i < counts[3] && !in.failed; ++i) {
+        Record record = {static_cast<std::uint64_t>(in.pos - m_data), 0};
+        record.number = previous += static_cast<std::uint64_t>(in.Signed());
+        in.String();
+        in.Byte();
+        in.SkipRefs();
+        m_task_lists.push_back(record);
+    }
+
+    // Legăturile, în aceeași ordine ca la scriere
+    m_user_links.reserve(m_users.size());
+    for (size_t i = 0; i < m_users.size() && !in.failed; ++i) {
+        m_user_links.push_back(static_cast<std::uint64_t>(in.pos - m_data));
+        in.SkipRefs();
+        if (m_data[m_users[i].offset] == static_cast<std::uint8_t>(Snapshot::User_Type::TEAM_LEADER)) {
+            in.SkipRefs();
+        }
+    }
+    m_category_links.reserve(m_categories.size());
+    for (size_t i = 0; i < m_categories.size() && !in.failed; ++i) {
+        m_category_links.push_back(static_cast<std::uint64_t>(in.pos - m_data));
+        in.SkipRefs();
+    }
+    m_task_links.assign(m_tasks.size(), 0);
+    for (size_t i = 0; i < m_tasks.size() && !in.failed; ++i) {
+        if (m_data[m_tasks[i].offset] == static_cast<std::uint8_t>(Snapshot::Task_Type::PROJECT)) {
+            m_task_links[i] = static_cast<std::uint64_t>(in.pos - m_data);
+            in.SkipRefs();
+        }
+    }
+
+    // Notele
+    m_task_notes.reserve(static_cast<size_t>(counts[4]));
+    for (std::uint64_t i = 0; i < counts[4] && !in.failed; ++i) {
+        m_task_notes.push_back(static_cast<std::uint64_t>(in.pos - m_data));
+        in.Varint();
+        std::uint64_t note_count = in.Varint();
+        for (std::uint64_t j = 0; j < note_count && !in.failed; ++j) {
+            in.String();
+            in.String();
+            in.String();
+            in.Byte();
+        }
+    }
+
+    // După marcajul de sfârșit urmează exact suma de control
+    if (in.failed || in.Byte() != Snapshot::END_MARKER || in.pos != in.end) {
+        return false;
+    }
+
+    m_user_index.Build(m_users);
+    m_category_index.Build(m_categories);
+    m_task_index.Build(m_tasks);
+    m_task_list_index.Build(m_task_lists);
+    return true;
+}
+
+std::vector<Task_View> Snapshot_View::_TasksAt(std::uint64_t offset) const {
+    Cursor in(m_data + offset, m_data + m_size);
+    std::uint64_t count = in.Varint();
+
+    std::vector<Task_View> tasks;
+    tasks.reserve(static_cast<size_t>(count));
+    for (std::uint64_t i = 0; i < count; ++i) {
+        size_t index = m_task_index.Find(in.Varint());
+        if (index != NOT_FOUND) {
+            tasks.push_back(Task_View(this, index));
+        }
+    }
+    return tasks;
+}
+
+std::vector<User_View> Snapshot_View::_UsersAt(std::uint64_t offset) const {
+    Cursor in(m_data + offset, m_data + m_size);
+    std::uint64_t count = in.Varint();
+
+    std::vector<User_View> users;
+    users.reserve(static_cast<size_t>(count));
+    for (std::uint64_t i = 0; i < count; ++i) {
+        size_t index = m_user_index.Find(in.Varint());
+        if (index != NOT_FOUND) {
+            users.push_back(User_View(this, index));
+        }
+    }
+    return users;
+}
+
+} // namespace Task_Management
@@ -0,0 +1,30 @@
+#include "system_clock.h"
+#include "date.h"
+#include <ctime>
+
+namespace Task_Management {
+
+System_Clock& System_Clock::GetInstance() {
+    // Ceasul nu are stare, deci o singură instanță poate fi folosită peste tot
+    static System_Clock instance;
+    return instance;
+}
+
+std::int64_t System_Clock::GetTime() const {
+    return static_cast<std::int64_t>(std::time(nullptr));
+}
+
+int System_Clock::GetLocalDay(std::int64_t time, std::int64_t& next_day) const {
+    // localtime_r nu folosește bufferul static al lui localtime, deci este sigur între fire
+    std::time_t time_value = static_cast<std::time_t>(time);
+    std::tm local = {};
+    localtime_r(&time_value, &local);
+
+    // Ziua următoare începe după secundele rămase din ziua curentă
+    // (în zilele cu schimbarea orei, limita TICK_SECONDS a lui Today_Clock corectează diferența)
+    std::int64_t elapsed = local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+    next_day = time - elapsed + 24 * 3600;
+    return Date::DaysFromCivil(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday);
+}
+
+} // namespace Task_Management
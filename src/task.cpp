@@ -1,18 +1,42 @@
 #include "task.h"
-#include <sstream>
+#include "id_allocator.h"
+#include "project_task.h"
+#include "user.h"
+#include "category.h"
+#include "text_matcher.h"
+#include <algorithm>
+#include <ostream>
+#include <thread>
 
 namespace Task_Management {
 
-// Inițializarea membrului static
-// Aceasta se face în fișierul .cpp, nu în .h
-int Task::s_id_counter = 0;
+/**
+ * Lista publicată a observatorilor; nu se modifică după publicare, ci se înlocuiește
+ * cu o copie. RemoveObserver așteaptă ca numărul notificărilor care folosesc lista
+ * veche să ajungă la zero.
+ */
+struct Task::Observer_List {
+    std::vector<ITask_Observer*> observers;  // Observatorii, în ordinea înregistrării
+    std::atomic<std::size_t> users;          // Notificările în curs care folosesc lista
+
+    explicit Observer_List(const std::vector<ITask_Observer*>& list) : observers(list), users(0) {}
+};
+
+std::mutex Task::s_observers_mutex;
+std::shared_ptr<Task::Observer_List> Task::s_observers;
+std::atomic<std::size_t> Task::s_observer_count(0);
+std::atomic<std::uint64_t> Task::s_creation_counter(0);
 
 Task::Task(const std::string& title, const std::string& description, Priority priority)
     : m_title(title), 
       m_description(description), 
       m_priority(priority),
       m_status(TaskStatus::NOT_STARTED),  // Inițial, sarcina nu este începută
-      m_assigned_user(nullptr) {  // Inițial, nu este atribuit niciun utilizator
+      m_assigned_user(nullptr),  // Inițial, nu este atribuit niciun utilizator
+      m_reported_percentage(0.0),
+      m_reported_completed(false),
+      m_is_copy(false),
+      m_creation_sequence(s_creation_counter.fetch_add(1, std::memory_order_relaxed) + 1) {
     m_id = _GenerateId();  // Generăm un ID unic pentru sarcină
 }
 
@@ -23,42 +47,63 @@ Task::Task(const Task& other)
       m_priority(other.m_priority),
       m_status(other.m_status),
       m_assigned_user(other.m_assigned_user),
-      m_categories(other.m_categories) {
+      m_categories(other.m_categories),
+      m_reported_percentage(0.0),
+      m_reported_completed(false),
+      m_is_copy(true),
+      m_creation_sequence(other.m_creation_sequence) {
     // Constructor de copiere - copiază toate datele din obiectul other
+    // Copia nu este sub-sarcină în proiectele originalului, deci nu preia m_parent_projects
+    // și nu face parte din cozile originalului
 }
 
 Task::~Task() {
     // Implementarea destructorului virtual
-    // În acest caz simplu, nu avem resurse de eliberat
-    // Dar este important să fie virtual pentru clasele derivate
+    // Observatorii (ex: Mutation_Log, Ready_Queue) află de ștergere cât timp sarcina
+    // este încă legată, deci nu păstrează pointeri invalizi
+    _NotifyObservers(Task_Change::DELETED);
+    
+    // Ne eliminăm din proiectele părinte pentru ca acestea să nu rămână cu pointeri invalizi
+    _DetachFromParentProjects();
 }
 
-std::string Task::GetTitle() const {
+const std::string& Task::GetTitle() const {
     return m_title;  // Returnează titlul sarcinii
 }
 
 void Task::SetTitle(const std::string& title) {
     m_title = title;  // Setează titlul sarcinii
+    _NotifyObservers(Task_Change::TITLE);
 }
 
-std::string Task::GetDescription() const {
+const std::string& Task::GetDescription() const {
     return m_description;  // Returnează descrierea sarcinii
 }
 
 void Task::SetDescription(const std::string& description) {
     m_description = description;  // Setează descrierea sarcinii
+    _NotifyObservers(Task_Change::DESCRIPTION);
+}
+
+bool Task::ContainsText(const Text_Matcher& matcher) const {
+    return matcher.Matches(m_title) || matcher.Matches(m_description);
 }
 
-std::string Task::GetId() const {
+Entity_Id Task::GetId() const {
     return m_id;  // Returnează ID-ul unic al sarcinii
 }
 
+std::uint64_t Task::GetCreationSequence() const {
+    return m_creation_sequence;
+}
+
 Priority Task::GetPriority() const {
     return m_priority;  // Returnează prioritatea sarcinii
 }
 
 void Task::SetPriority(Priority priority) {
     m_priority = priority;  // Setează prioritatea sarcinii
+    _NotifyObservers(Task_Change::PRIORITY);
 }
 
 TaskStatus Task::GetStatus() const {
@@ -67,10 +112,13 @@ TaskStatus Task::GetStatus() const {
 
 void Task::SetStatus(TaskStatus status) {
     m_status = status;  // Setează statusul sarcinii
+    _NotifyParentProjects();  // Actualizăm agregatele proiectelor părinte
+    _NotifyObservers(Task_Change::STATUS);
 }
 
 void Task::AssignTo(User* user) {
     m_assigned_user = user;  // Atribuie sarcina unui utilizator
+    _NotifyObservers(Task_Change::ASSIGNED_USER, user ? user->GetId() : Entity_Id());
 }
 
 User* Task::GetAssignedUser() const {
@@ -79,12 +127,55 @@ User* Task::GetAssignedUser() const {
 
 void Task::AddCategory(Category* category) {
     m_categories.push_back(category);  // Adaugă o categorie la sarcină
+    _NotifyObservers(Task_Change::CATEGORY_ADDED, category ? category->GetId() : Entity_Id());
 }
 
 const std::vector<Category*>& Task::GetCategories() const {
     return m_categories;  // Returnează toate categoriile atribuite
 }
 
+void Task::AddObserver(ITask_Observer* observer) {
+    if (!observer) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(s_observers_mutex);
+    std::vector<ITask_Observer*> observers;
+    if (s_observers) {
+        observers = s_observers->observers;
+    }
+    if (std::find(observers.begin(), observers.end(), observer) != observers.end()) {
+        return;
+    }
+    observers.push_back(observer);
+    s_observers = std::make_shared<Observer_List>(observers);
+    s_observer_count.store(observers.size(), std::memory_order_release);
+}
+
+void Task::RemoveObserver(ITask_Observer* observer) {
+    std::shared_ptr<Observer_List> previous;
+    {
+        std::lock_guard<std::mutex> lock(s_observers_mutex);
+        if (!s_observers) {
+            return;
+        }
+        std::vector<ITask_Observer*> observers = s_observers->observers;
+        std::vector<ITask_Observer*>::iterator it = std::find(observers.begin(), observers.end(), observer);
+        if (it == observers.end()) {
+            return;
+        }
+        observers.erase(it);
+        previous = s_observers;
+        s_observers = std::make_shared<Observer_List>(observers);
+        s_observer_count.store(observers.size(), std::memory_order_release);
+    }
+
+    // Notificările începute înainte de înlocuire folosesc încă lista veche și pot apela
+    // observatorul; după ce se termină, observatorul poate fi distrus
+    while (previous->users.load(std::memory_order_acquire) != 0) {
+        std::this_thread::yield();
+    }
+}
+
 void Task::_WriteDetailsToStream(std::ostream& os) const {
     // Scrie detaliile de bază ale sarcinii în stream-ul de ieșire
     os << "ID: " << m_id << "\n";
@@ -129,6 +220,63 @@ void Task::_WriteDetailsToStream(std::ostream& os) const {
     os << "\n";
 }
 
+void Task::_NotifyParentProjects(std::ptrdiff_t delta_task_count) {
+    // Fără părinți nu avem ce actualiza (cazul obișnuit)
+    if (m_parent_projects.empty()) {
+        return;
+    }
+
+    // Pentru proiecte, aceste apeluri citesc valorile din cache, deci sunt O(1)
+    double percentage = GetCompletionPercentage();
+    bool completed = IsCompleted();
+    if (percentage == m_reported_percentage && completed == m_reported_completed && delta_task_count == 0) {
+        return;
+    }
+
+    // Trimitem părinților doar diferența față de ultima valoare raportată
+    double delta_percentage = percentage - m_reported_percentage;
+    int delta_completed = static_cast<int>(completed) - static_cast<int>(m_reported_completed);
+    m_reported_percentage = percentage;
+    m_reported_completed = completed;
+
+    for (Project_Task* parent : m_parent_projects) {
+        parent->_OnSubtaskChanged(delta_percentage, delta_completed, delta_task_count);
+    }
+}
+
+void Task::_DetachFromParentProjects() {
+    // În destructor nu putem apela funcțiile virtuale, deci părinții primesc
+    // ultimele valori raportate (m_reported_percentage, m_reported_completed)
+    while (!m_parent_projects.empty()) {
+        Project_Task* parent = m_parent_projects.back();
+        m_parent_projects.pop_back();
+        parent->_OnSubtaskDestroyed(this);
+    }
+}
+
+void Task::_NotifyObservers(Task_Change change, const Entity_Id& related) const {
+    // Fără observatori (cazul obișnuit) costul este o singură citire atomică
+    if (s_observer_count.load(std::memory_order_acquire) == 0) {
+        return;
+    }
+
+    // Lista curentă este reținută pe durata apelurilor, deci AddObserver și
+    // RemoveObserver pot rula în paralel (ex: constructorul unui Ready_Queue)
+    std::shared_ptr<Observer_List> list;
+    {
+        std::lock_guard<std::mutex> lock(s_observers_mutex);
+        if (!s_observers) {
+            return;
+        }
+        list = s_observers;
+        list->users.fetch_add(1, std::memory_order_relaxed);
+    }
+    for (ITask_Observer* observer : list->observers) {
+        observer->OnTaskChanged(*this, change, related);
+    }
+    list->users.fetch_sub(1, std::memory_order_release);
+}
+
 // Implementarea operatorului << suprascris
 // Aceasta este o funcție friend declarată în clasa Task
 std::ostream& operator<<(std::ostream& os, const Task& task) {
@@ -137,10 +285,17 @@ std::ostream& operator<<(std::ostream& os, const Task& task) {
 }
 
 // Metodă privată pentru generarea ID-urilor unice
-std::string Task::_GenerateId() {
-    std::stringstream ss;
-    ss << "TASK-" << ++s_id_counter;  // Incrementăm contorul static și îl includem în ID
-    return ss.str();  // Returnăm ID-ul ca string
+Entity_Id Task::_GenerateId() {
+    // ID-ul este un întreg compact; forma text "TASK-N" se produce doar la afișare
+    // Generatorul comun este thread-safe, deci obiectele pot fi create din mai multe fire
+    return Id_Allocator::GetInstance().Allocate(Entity_Kind::TASK);
+}
+
+void Task::_ResumeCreationSequence(std::uint64_t sequence) {
+    std::uint64_t current = s_creation_counter.load(std::memory_order_relaxed);
+    while (current < sequence &&
+           !s_creation_counter.compare_exchange_weak(current, sequence, std::memory_order_relaxed)) {
+    }
 }
 
 } // namespace Task_Management
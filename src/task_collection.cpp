@@ -0,0 +1,194 @@
+#include "task_collection.h"
+#include "task.h"
+#include <algorithm>
+
+namespace Task_Management {
+
+Task_Collection::Task_Collection(Storage_Mode mode)
+    : m_mode(mode) {
+    // Colecția începe goală; indexul este construit pe măsură ce adăugăm sarcini
+}
+
+Task_Collection::Storage_Mode Task_Collection::GetStorageMode() const {
+    return m_mode;
+}
+
+void Task_Collection::SetStorageMode(Storage_Mode mode) {
+    if (mode == m_mode) {
+        return;
+    }
+
+    m_mode = mode;
+    if (m_mode == Storage_Mode::INDEXED) {
+        _RebuildIndex();
+    } else {
+        // În modul ORDERED indexul nu mai este necesar
+        m_index.clear();
+    }
+}
+
+void Task_Collection::Add(Task* task) {
+    // Adaugă sarcina dacă pointerul nu este null
+    if (!task) {
+        return;
+    }
+
+    if (m_mode == Storage_Mode::INDEXED) {
+        m_index.emplace(task->GetId(), m_tasks.size());
+    }
+    m_tasks.push_back(task);
+}
+
+void Task_Collection::AddRange(Task* const* tasks, size_t count) {
+    // Intervalul poate proveni chiar din această colecție, iar rezervarea l-ar invalida
+    if (count > 0 && tasks >= m_tasks.data() && tasks < m_tasks.data() + m_tasks.size()) {
+        std::vector<Task*> copy(tasks, tasks + count);
+        AddRange(copy.data(), copy.size());
+        return;
+    }
+
+    // O singură rezervare pentru tot intervalul, în loc de realocări repetate;
+    // păstrăm creșterea geometrică pentru apeluri repetate cu intervale mici
+    size_t needed = m_tasks.size() + count;
+    if (needed > m_tasks.capacity()) {
+        Reserve(std::max(needed, m_tasks.capacity() * 2));
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        Task* task = tasks[i];
+        if (!task) {
+            continue;
+        }
+        if (m_mode == Storage_Mode::INDEXED) {
+            m_index.emplace(task->GetId(), m_tasks.size());
+        }
+        m_tasks.push_back(task);
+    }
+}
+
+void Task_Collection::Reserve(size_t count) {
+    m_tasks.reserve(count);
+    if (m_mode == Storage_Mode::INDEXED) {
+        m_index.reserve(count);
+    }
+}
+
+bool Task_Collection::Remove(const Entity_Id& task_id) {
+    return Extract(task_id) != nullptr;
+}
+
+Task* Task_Collection::Extract(const Entity_Id& task_id) {
+    if (m_mode == Storage_Mode::ORDERED) {
+        // Căutare liniară, păstrând ordinea elementelor rămase
+        auto it = std::find_if(m_tasks.begin(), m_tasks.end(),
+                              [&task_id](const Task* task) { return task->GetId() == task_id; });
+        if (it == m_tasks.end()) {
+            return nullptr;
+        }
+        Task* removed = *it;
+        m_tasks.erase(it);
+        return removed;
+    }
+
+    // Modul INDEXED: găsim poziția în O(1) și o eliminăm prin swap cu ultimul element
+    auto entry = m_index.find(task_id);
+    if (entry == m_index.end()) {
+        return nullptr;
+    }
+
+    Task* removed = m_tasks[entry->second];
+    _EraseIndexed(entry);
+    return removed;
+}
+
+bool Task_Collection::Remove(Task* task) {
+    if (!task) {
+        return false;
+    }
+
+    if (m_mode == Storage_Mode::ORDERED) {
+        auto it = std::find(m_tasks.begin(), m_tasks.end(), task);
+        if (it == m_tasks.end()) {
+            return false;
+        }
+        m_tasks.erase(it);
+        return true;
+    }
+
+    // Printre intrările cu același ID o căutăm pe cea care indică exact acest obiect
+    auto range = m_index.equal_range(task->GetId());
+    for (auto it = range.first; it != range.second; ++it) {
+        if (m_tasks[it->second] == task) {
+            _EraseIndexed(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void Task_Collection::_EraseIndexed(std::unordered_multimap<Entity_Id, size_t, Entity_Id_Hash>::iterator entry) {
+    size_t position = entry->second;
+    size_t last = m_tasks.size() - 1;
+    m_index.erase(entry);
+
+    if (position != last) {
+        Task* moved = m_tasks[last];
+        auto moved_entry = _FindIndexEntry(moved->GetId(), last);
+        if (moved_entry != m_index.end()) {
+            moved_entry->second = position;
+        }
+        m_tasks[position] = moved;
+    }
+    m_tasks.pop_back();
+}
+
+Task* Task_Collection::Find(const Entity_Id& task_id) const {
+    if (m_mode == Storage_Mode::INDEXED) {
+        auto entry = m_index.find(task_id);
+        return entry != m_index.end() ? m_tasks[entry->second] : nullptr;
+    }
+
+    auto it = std::find_if(m_tasks.begin(), m_tasks.end(),
+                          [&task_id](const Task* task) { return task->GetId() == task_id; });
+    return it != m_tasks.end() ? *it : nullptr;
+}
+
+const std::vector<Task*>& Task_Collection::GetTasks() const {
+    return m_tasks;
+}
+
+size_t Task_Collection::Size() const {
+    return m_tasks.size();
+}
+
+bool Task_Collection::IsEmpty() const {
+    return m_tasks.empty();
+}
+
+void Task_Collection::Clear() {
+    m_tasks.clear();
+    m_index.clear();
+}
+
+void Task_Collection::_RebuildIndex() {
+    m_index.clear();
+    m_index.reserve(m_tasks.size());
+    for (size_t i = 0; i < m_tasks.size(); ++i) {
+        m_index.emplace(m_tasks[i]->GetId(), i);
+    }
+}
+
+std::unordered_multimap<Entity_Id, size_t, Entity_Id_Hash>::iterator Task_Collection::_FindIndexEntry(const Entity_Id& task_id,
+                                                                                                     size_t position) {
+    // Aceeași sarcină (sau o copie cu același ID) poate apărea de mai multe ori,
+    // deci căutăm intrarea exactă printre cele cu ID-ul respectiv
+    auto range = m_index.equal_range(task_id);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == position) {
+            return it;
+        }
+    }
+    return m_index.end();
+}
+
+} // namespace Task_Management
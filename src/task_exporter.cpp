@@ -0,0 +1,349 @@
+#include "task_exporter.h"
+#include "task.h"
+#include "task_list.h"
+#include "category.h"
+#include "user.h"
+#include <cerrno>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unistd.h>
+
+namespace Task_Management {
+
+namespace {
+
+const char CSV_HEADER[] = "source,id,type,title,description,priority,status,completion,assigned_user,categories\r\n";
+
+/**
+ * Denumirile valorilor enumerațiilor, indexate după valoarea numerică
+ */
+const char* const PRIORITY_NAMES[] = { "LOW", "MEDIUM", "HIGH", "URGENT" };
+const char* const STATUS_NAMES[] = { "NOT_STARTED", "IN_PROGRESS", "COMPLETED", "DEFERRED", "CANCELLED" };
+
+/**
+ * Tabelă cu caracterele speciale pentru fiecare format, indexată după octet
+ * Evită comparațiile multiple pentru fiecare caracter al textelor
+ */
+struct Special_Chars {
+    bool csv[256];   // Caractere care impun ghilimele în CSV
+    bool json[256];  // Caractere care trebuie scrise ca secvență de escape în JSON
+
+    Special_Chars() {
+        for (int c = 0; c < 256; ++c) {
+            csv[c] = c == ',' || c == '"' || c == '\n' || c == '\r';
+            json[c] = c == '"' || c == '\\' || c < 0x20;
+        }
+    }
+};
+
+const Special_Chars SPECIAL_CHARS;
+
+inline bool NeedsCsvQuoting(char c) {
+    return SPECIAL_CHARS.csv[static_cast<unsigned char>(c)];
+}
+
+inline bool NeedsJsonEscape(char c) {
+    return SPECIAL_CHARS.json[static_cast<unsigned char>(c)];
+}
+
+} // namespace
+
+const size_t Task_Exporter::BUFFER_SIZE;
+
+Task_Exporter::Task_Exporter(int fd, Format format)
+    : m_fd(fd),
+      m_format(format),
+      m_buffer(BUFFER_SIZE),
+      m_used(0),
+      m_header_written(false),
+      m_failed(false),
+      m_row_count(0) {
+    // Bufferul este alocat o singură dată, pentru tot exportul
+}
+
+Task_Exporter::~Task_Exporter() {
+    Flush();
+}
+
+bool Task_Exporter::Export(const Task_List& task_list) {
+    return ExportTasks(task_list.GetTasks(), task_list.GetId());
+}
+
+bool Task_Exporter::Export(const Category& category) {
+    return ExportTasks(category.GetTasks(), category.GetId());
+}
+
+bool Task_Exporter::Export(const User& user) {
+    return ExportTasks(user.GetAssignedTasks(), user.GetId());
+}
+
+bool Task_Exporter::ExportTasks(const std::vector<Task*>& tasks, const Entity_Id& source) {
+    // Antetul CSV se scrie o singură dată, înaintea primului rând
+    if (m_format == Format::CSV && !m_header_written) {
+        _Append(CSV_HEADER, sizeof(CSV_HEADER) - 1);
+        m_header_written = true;
+    }
+
+    for (const Task* task : tasks) {
+        if (m_failed) {
+            return false;
+        }
+        if (task) {
+            _WriteRow(*task, source);
+        }
+    }
+    return !m_failed;
+}
+
+bool Task_Exporter::Flush() {
+    const char* data = m_buffer.data();
+    size_t remaining = m_used;
+    m_used = 0;
+    while (!m_failed && remaining > 0) {
+        ssize_t written = ::write(m_fd, data, remaining);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            m_failed = true;
+            break;
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+    return !m_failed;
+}
+
+bool Task_Exporter::HasFailed() const {
+    return m_failed;
+}
+
+std::uint64_t Task_Exporter::GetRowCount() const {
+    return m_row_count;
+}
+
+void Task_Exporter::_WriteRow(const Task& task, const Entity_Id& source) {
+    if (m_format == Format::CSV) {
+        _WriteCsvRow(task, source);
+    } else {
+        _WriteJsonRow(task, source);
+    }
+    ++m_row_count;
+}
+
+void Task_Exporter::_WriteCsvRow(const Task& task, const Entity_Id& source) {
+    // ID-urile și denumirile enumerațiilor nu conțin caractere care cer ghilimele
+    if (source.IsValid()) {
+        _AppendId(source);
+    }
+    _Append(",", 1);
+    _AppendId(task.GetId());
+    _Append(",", 1);
+    _AppendCsvField(task.GetTaskType());
+    _Append(",", 1);
+    _AppendCsvField(task.GetTitle());
+    _Append(",", 1);
+    _AppendCsvField(task.GetDescription());
+    _Append(",", 1);
+    const char* priority = PRIORITY_NAMES[static_cast<int>(task.GetPriority())];
+    _Append(priority, std::strlen(priority));
+    _Append(",", 1);
+    const char* status = STATUS_NAMES[static_cast<int>(task.GetStatus())];
+    _Append(status, std::strlen(status));
+    _Append(",", 1);
+    _AppendPercentage(task.GetCompletionPercentage());
+    _Append(",", 1);
+    const User* user = task.GetAssignedUser();
+    if (user) {
+        _AppendId(user->GetId());
+    }
+    _Append(",", 1);
+    const std::vector<Category*>& categories = task.GetCategories();
+    for (size_t i = 0; i < categories.size(); ++i) {
+        if (i > 0) {
+            _Append(";", 1);
+        }
+        _AppendId(categories[i]->GetId());
+    }
+    _Append("\r\n", 2);
+}
+
+void Task_Exporter::_WriteJsonRow(const Task& task, const Entity_Id& source) {
+    _Append("{\"source\":", 10);
+    if (source.IsValid()) {
+        _Append("\"", 1);
+        _AppendId(source);
+        _Append("\"", 1);
+    } else {
+        _Append("null", 4);
+    }
+    _Append(",\"id\":\"", 7);
+    _AppendId(task.GetId());
+    _Append("\",\"type\":", 9);
+    std::string type = task.GetTaskType();
+    _AppendJsonString(type.data(), type.size());
+    _Append(",\"title\":", 9);
+    const std::string& title = task.GetTitle();
+    _AppendJsonString(title.data(), title.size());
+    _Append(",\"description\":", 15);
+    const std::string& description = task.GetDescription();
+    _AppendJsonString(description.data(), description.size());
+    _Append(",\"priority\":\"", 13);
+    const char* priority = PRIORITY_NAMES[static_cast<int>(task.GetPriority())];
+    _Append(priority, std::strlen(priority));
+    _Append("\",\"status\":\"", 12);
+    const char* status = STATUS_NAMES[static_cast<int>(task.GetStatus())];
+    _Append(status, std::strlen(status));
+    _Append("\",\"completion\":", 15);
+    _AppendPercentage(task.GetCompletionPercentage());
+    _Append(",\"assigned_user\":", 17);
+    const User* user = task.GetAssignedUser();
+    if (user) {
+        _Append("\"", 1);
+        _AppendId(user->GetId());
+        _Append("\"", 1);
+    } else {
+        _Append("null", 4);
+    }
+    _Append(",\"categories\":[", 15);
+    const std::vector<Category*>& categories = task.GetCategories();
+    for (size_t i = 0; i < categories.size(); ++i) {
+        _Append(i > 0 ? ",\"" : "\"", i > 0 ? 2 : 1);
+        _AppendId(categories[i]->GetId());
+        _Append("\"", 1);
+    }
+    _Append("]}\n", 3);
+}
+
+void Task_Exporter::_Reserve(size_t size) {
+    if (m_used + size > m_buffer.size()) {
+        Flush();
+    }
+}
+
+void Task_Exporter::_Append(const char* data, size_t size) {
+    if (m_failed) {
+        return;
+    }
+    _Reserve(size);
+
+    // Un text mai mare decât bufferul este scris direct, fără copiere
+    if (size > m_buffer.size()) {
+        while (!m_failed && size > 0) {
+            ssize_t written = ::write(m_fd, data, size);
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            if (written <= 0) {
+                m_failed = true;
+                break;
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+        return;
+    }
+
+    std::memcpy(&m_buffer[m_used], data, size);
+    m_used += size;
+}
+
+void Task_Exporter::_AppendId(const Entity_Id& id) {
+    _Reserve(Entity_Id::MAX_TEXT_SIZE);
+    if (!m_failed) {
+        m_used += id.FormatTo(&m_buffer[m_used]);
+    }
+}
+
+void Task_Exporter::_AppendPercentage(double value) {
+    // Procentul are cel mult două zecimale; îl scriem ca întreg de sutimi, fără printf
+    if (!(value >= 0.0)) {
+        value = 0.0;
+    }
+    std::uint64_t hundredths = static_cast<std::uint64_t>(std::llround(std::min(value, 1e15) * 100.0));
+    std::uint64_t whole = hundredths / 100;
+    std::uint64_t fraction = hundredths % 100;
+
+    // Partea întreagă, scrisă de la coadă spre început
+    char digits[24];
+    char* end = digits + sizeof(digits);
+    char* p = end;
+    do {
+        *--p = static_cast<char>('0' + whole % 10);
+        whole /= 10;
+    } while (whole != 0);
+
+    // Zecimalele, fără zerourile de la final (50.5, nu 50.50)
+    char text[32];
+    size_t length = static_cast<size_t>(end - p);
+    std::memcpy(text, p, length);
+    if (fraction != 0) {
+        text[length++] = '.';
+        text[length++] = static_cast<char>('0' + fraction / 10);
+        if (fraction % 10 != 0) {
+            text[length++] = static_cast<char>('0' + fraction % 10);
+        }
+    }
+    _Append(text, length);
+}
+
+void Task_Exporter::_AppendCsvField(const std::string& text) {
+    // Cazul obișnuit: textul nu conține separatori, deci este copiat ca atare
+    bool needs_quoting = false;
+    for (char c : text) {
+        if (NeedsCsvQuoting(c)) {
+            needs_quoting = true;
+            break;
+        }
+    }
+    if (!needs_quoting) {
+        _Append(text.data(), text.size());
+        return;
+    }
+
+    // Câmpul este pus între ghilimele, iar ghilimelele din text sunt dublate
+    _Append("\"", 1);
+    const char* start = text.data();
+    const char* end = start + text.size();
+    for (const char* p = start; p != end; ++p) {
+        if (*p == '"') {
+            _Append(start, static_cast<size_t>(p - start + 1));
+            start = p;  // Ghilimeaua este scrisă încă o dată, cu restul textului
+        }
+    }
+    _Append(start, static_cast<size_t>(end - start));
+    _Append("\"", 1);
+}
+
+void Task_Exporter::_AppendJsonString(const char* data, size_t size) {
+    _Append("\"", 1);
+    const char* start = data;
+    const char* end = data + size;
+    for (const char* p = start; p != end; ++p) {
+        if (!NeedsJsonEscape(*p)) {
+            continue;
+        }
+
+        // Scriem porțiunea fără caractere speciale, apoi secvența de escape
+        _Append(start, static_cast<size_t>(p - start));
+        start = p + 1;
+        switch (*p) {
+            case '"': _Append("\\\"", 2); break;
+            case '\\': _Append("\\\\", 2); break;
+            case '\n': _Append("\\n", 2); break;
+            case '\r': _Append("\\r", 2); break;
+            case '\t': _Append("\\t", 2); break;
+            default: {
+                static const char HEX[] = "0123456789abcdef";
+                char escape[6] = {'\\', 'u', '0', '0', HEX[(*p >> 4) & 0xF], HEX[*p & 0xF]};
+                _Append(escape, sizeof(escape));
+                break;
+            }
+        }
+    }
+    _Append(start, static_cast<size_t>(end - start));
+    _Append("\"", 1);
+}
+
+} // namespace Task_Management
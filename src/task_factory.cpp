@@ -0,0 +1,50 @@
+#include "task_factory.h"
+#include <typeinfo>
+
+namespace Task_Management {
+
+Task_Factory::Task_Factory() {
+    // Pool-urile își alocă blocurile abia la prima creare
+}
+
+Task_Factory::~Task_Factory() {
+    // Sarcinile sunt deținute de fabrică, deci le distrugem aici
+    ReleaseAll();
+}
+
+bool Task_Factory::Destroy(Task* task) {
+    if (!task) {
+        return false;
+    }
+
+    // Tipul dinamic exact decide pool-ul din care provine sarcina
+    const std::type_info& type = typeid(*task);
+    if (type == typeid(Simple_Task)) {
+        m_simple_tasks.Destroy(static_cast<Simple_Task*>(task));
+    } else if (type == typeid(Project_Task)) {
+        m_project_tasks.Destroy(static_cast<Project_Task*>(task));
+    } else if (type == typeid(Recurring_Task)) {
+        m_recurring_tasks.Destroy(static_cast<Recurring_Task*>(task));
+    } else if (type == typeid(Deadline_Task)) {
+        m_deadline_tasks.Destroy(static_cast<Deadline_Task*>(task));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void Task_Factory::ReleaseAll() {
+    // Proiectele sunt distruse primele: astfel sub-sarcinile nu mai au părinți
+    // și nu trebuie eliminate una câte una din colecțiile proiectelor
+    m_project_tasks.ReleaseAll();
+    m_simple_tasks.ReleaseAll();
+    m_recurring_tasks.ReleaseAll();
+    m_deadline_tasks.ReleaseAll();
+}
+
+size_t Task_Factory::GetLiveCount() const {
+    return m_simple_tasks.GetLiveCount() + m_project_tasks.GetLiveCount() +
+           m_recurring_tasks.GetLiveCount() + m_deadline_tasks.GetLiveCount();
+}
+
+} // namespace Task_Management
@@ -0,0 +1,696 @@
+#include "task_importer.h"
+#include "simple_task.h"
+#include "deadline_task.h"
+#include "category.h"
+#include "user.h"
+#include "task_list.h"
+#include "task_factory.h"
+#include "work_stealing_pool.h"
+#include "date.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Task_Management {
+
+namespace {
+
+/**
+ * Valoarea unei coloane lipsă din antet
+ */
+const size_t MISSING_COLUMN = static_cast<size_t>(-1);
+
+/**
+ * Starea cititorului CSV după un caracter, folosită la găsirea granițelor bucăților
+ * Tranzițiile (CsvStep) urmează exact ReadRow, deci granițele cad între aceleași
+ * rânduri pe care le-ar citi un singur fir de la începutul fișierului.
+ */
+enum class Csv_State : std::uint8_t {
+    FIELD_START,  // La începutul unui câmp (după ',' sau la începutul rândului)
+    UNQUOTED,     // Într-un câmp fără ghilimele (sau după ghilimeaua de închidere)
+    QUOTED,       // Între ghilimele
+    QUOTE_SEEN,   // După o ghilimea din interiorul ghilimelelor (închidere sau "")
+    MALFORMED     // Rând invalid, citit până la următorul '\n'
+};
+
+const int CSV_STATE_COUNT = 5;
+
+/**
+ * Aplică un caracter stării cititorului
+ * @param row_end Primește true dacă rândul se termină la acest caracter
+ */
+inline Csv_State CsvStep(Csv_State state, char c, bool& row_end) {
+    row_end = false;
+    switch (state) {
+        case Csv_State::QUOTED:
+            return c == '"' ? Csv_State::QUOTE_SEEN : Csv_State::QUOTED;
+        case Csv_State::QUOTE_SEEN:
+            if (c == '"') {
+                return Csv_State::QUOTED;
+            }
+            break;
+        case Csv_State::MALFORMED:
+            row_end = c == '\n';
+            return row_end ? Csv_State::FIELD_START : Csv_State::MALFORMED;
+        case Csv_State::FIELD_START:
+            if (c == '"') {
+                return Csv_State::QUOTED;
+            }
+            break;
+        case Csv_State::UNQUOTED:
+            if (c == '"') {
+                return Csv_State::MALFORMED;
+            }
+            break;
+    }
+    if (c == '\n') {
+        row_end = true;
+        return Csv_State::FIELD_START;
+    }
+    return c == ',' ? Csv_State::FIELD_START : Csv_State::UNQUOTED;
+}
+
+/**
+ * Calculează starea cititorului după caracterele [pos, stop), pornind din starea dată
+ * Echivalent cu CsvStep aplicat fiecărui caracter, dar sare cu memchr de la o ghilimea
+ * la alta: în afara ghilimelelor, starea dinaintea unei ghilimele depinde doar de
+ * caracterul anterior (',' sau '\n' înseamnă început de câmp).
+ */
+Csv_State CsvSkip(Csv_State state, const char* pos, const char* stop) {
+    bool row_end;
+    while (pos != stop) {
+        size_t length = static_cast<size_t>(stop - pos);
+        switch (state) {
+            case Csv_State::QUOTED: {
+                const char* quote = static_cast<const char*>(std::memchr(pos, '"', length));
+                if (!quote) {
+                    return state;
+                }
+                state = Csv_State::QUOTE_SEEN;
+                pos = quote + 1;
+                break;
+            }
+            case Csv_State::QUOTE_SEEN:
+                state = CsvStep(state, *pos++, row_end);
+                break;
+            case Csv_State::MALFORMED: {
+                const char* newline = static_cast<const char*>(std::memchr(pos, '\n', length));
+                if (!newline) {
+                    return state;
+                }
+                state = Csv_State::FIELD_START;
+                pos = newline + 1;
+                break;
+            }
+            case Csv_State::FIELD_START:
+            case Csv_State::UNQUOTED: {
+                const char* quote = static_cast<const char*>(std::memchr(pos, '"', length));
+                const char* last = quote ? quote : stop;
+                if (last != pos) {
+                    state = last[-1] == ',' || last[-1] == '\n' ? Csv_State::FIELD_START : Csv_State::UNQUOTED;
+                }
+                if (!quote) {
+                    return state;
+                }
+                state = CsvStep(state, '"', row_end);
+                pos = quote + 1;
+                break;
+            }
+        }
+    }
+    return state;
+}
+
+/**
+ * Citește un rând CSV (RFC 4180) începând de la pos
+ * O ghilimea în interiorul unui câmp fără ghilimele (ex: 5" screen) sau după ghilimeaua
+ * de închidere a unui câmp face rândul invalid: restul rândului, până la următorul '\n',
+ * este ignorat, iar rândul este raportat prin malformed.
+ * @param fields Câmpurile rândului (vectorul și șirurile sunt refolosite între rânduri)
+ * @param field_count Primește numărul de câmpuri citite
+ * @param lines Primește numărul de linii noi parcurse (inclusiv cele din ghilimele)
+ * @param malformed Primește true dacă rândul conține o ghilimea în afara unui câmp între ghilimele
+ * @return Poziția de după rând, sau nullptr dacă o ghilimea nu este închisă
+ */
+const char* ReadRow(const char* pos, const char* end, std::vector<std::string>& fields, size_t& field_count,
+                    size_t& lines, bool& malformed) {
+    field_count = 0;
+    lines = 0;
+    malformed = false;
+    for (;;) {
+        if (field_count == fields.size()) {
+            fields.push_back(std::string());
+        }
+        std::string& field = fields[field_count++];
+        field.clear();
+
+        if (pos != end && *pos == '"') {
+            // Câmp între ghilimele: "" reprezintă o ghilimea, iar liniile noi fac parte din text
+            ++pos;
+            for (;;) {
+                const char* quote = static_cast<const char*>(std::memchr(pos, '"', static_cast<size_t>(end - pos)));
+                if (!quote) {
+                    return nullptr;
+                }
+                lines += static_cast<size_t>(std::count(pos, quote, '\n'));
+                field.append(pos, quote);
+                pos = quote + 1;
+                if (pos != end && *pos == '"') {
+                    field.push_back('"');
+                    ++pos;
+                    continue;
+                }
+                break;
+            }
+            // Eventualele caractere dintre ghilimeaua de închidere și separator sunt păstrate
+            while (pos != end && *pos != ',' && *pos != '\n' && *pos != '"') {
+                if (*pos != '\r') {
+                    field.push_back(*pos);
+                }
+                ++pos;
+            }
+        } else {
+            const char* start = pos;
+            while (pos != end && *pos != ',' && *pos != '\n' && *pos != '"') {
+                ++pos;
+            }
+            const char* stop = pos;
+            if (stop != start && stop[-1] == '\r') {
+                --stop;
+            }
+            field.assign(start, stop);
+        }
+
+        if (pos == end) {
+            return pos;
+        }
+        if (*pos == '"') {
+            malformed = true;
+            const char* newline = static_cast<const char*>(std::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+            if (!newline) {
+                return end;
+            }
+            ++lines;
+            return newline + 1;
+        }
+        if (*pos == '\n') {
+            ++lines;
+            return pos + 1;
+        }
+        ++pos;  // Separatorul ','
+    }
+}
+
+/**
+ * Elimină spațiile de la capete
+ */
+std::string Trim(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t");
+    if (begin == std::string::npos) {
+        return std::string();
+    }
+    size_t end = text.find_last_not_of(" \t");
+    return text.substr(begin, end - begin + 1);
+}
+
+/**
+ * Aduce un nume de valoare la forma enumerației (ex: "Not Started" -> "NOT_STARTED")
+ */
+std::string NormalizeToken(const std::string& text) {
+    std::string token = Trim(text);
+    for (char& c : token) {
+        if (c == ' ' || c == '-') {
+            c = '_';
+        } else if (c >= 'a' && c <= 'z') {
+            c = static_cast<char>(c - 'a' + 'A');
+        }
+    }
+    return token;
+}
+
+bool ParsePriority(const std::string& text, Priority& priority) {
+    static const char* const NAMES[] = { "LOW", "MEDIUM", "HIGH", "URGENT" };
+    std::string token = NormalizeToken(text);
+    if (token.empty()) {
+        priority = Priority::MEDIUM;
+        return true;
+    }
+    for (int i = 0; i < 4; ++i) {
+        if (token == NAMES[i]) {
+            priority = static_cast<Priority>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ParseStatus(const std::string& text, TaskStatus& status) {
+    static const char* const NAMES[] = { "NOT_STARTED", "IN_PROGRESS", "COMPLETED", "DEFERRED", "CANCELLED" };
+    std::string token = NormalizeToken(text);
+    if (token.empty()) {
+        status = TaskStatus::NOT_STARTED;
+        return true;
+    }
+    for (int i = 0; i < 5; ++i) {
+        if (token == NAMES[i]) {
+            status = static_cast<TaskStatus>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Citește o dată în forma AAAA-LL-ZZ
+ * @param parts Primește anul, luna și ziua
+ */
+bool ParseDate(const std::string& text, int parts[3]) {
+    std::string value = Trim(text);
+    if (value.size() != 10 || value[4] != '-' || value[7] != '-') {
+        return false;
+    }
+    const size_t starts[3] = {0, 5, 8};
+    const size_t lengths[3] = {4, 2, 2};
+    for (int i = 0; i < 3; ++i) {
+        parts[i] = 0;
+        for (size_t j = starts[i]; j < starts[i] + lengths[i]; ++j) {
+            if (value[j] < '0' || value[j] > '9') {
+                return false;
+            }
+            parts[i] = parts[i] * 10 + (value[j] - '0');
+        }
+    }
+    return Date(parts[0], parts[1], parts[2]).IsValid();
+}
+
+/**
+ * Adaugă un nume în tabela locală a unei bucăți și întoarce indexul lui
+ */
+std::uint32_t InternName(const std::string& name, std::unordered_map<std::string, std::uint32_t>& index,
+                         std::vector<std::string>& names) {
+    auto it = index.find(name);
+    if (it != index.end()) {
+        return it->second;
+    }
+    std::uint32_t id = static_cast<std::uint32_t>(names.size());
+    index.emplace(name, id);
+    names.push_back(name);
+    return id;
+}
+
+/**
+ * Închide maparea unui fișier la ieșirea din funcție
+ */
+struct Mapping {
+    void* data;
+    size_t size;
+
+    Mapping() : data(MAP_FAILED), size(0) {}
+    ~Mapping() {
+        if (data != MAP_FAILED) {
+            ::munmap(data, size);
+        }
+    }
+};
+
+} // namespace
+
+/**
+ * Pozițiile coloanelor recunoscute în antet
+ */
+struct Task_Importer::Columns {
+    size_t type;
+    size_t title;
+    size_t description;
+    size_t priority;
+    size_t status;
+    size_t deadline;
+    size_t assignee;
+    size_t categories;
+
+    Columns()
+        : type(MISSING_COLUMN), title(MISSING_COLUMN), description(MISSING_COLUMN), priority(MISSING_COLUMN),
+          status(MISSING_COLUMN), deadline(MISSING_COLUMN), assignee(MISSING_COLUMN), categories(MISSING_COLUMN) {}
+};
+
+/**
+ * Rezultatul analizei unei bucăți
+ * Numele sunt reținute local; indexurile lor sunt traduse în obiecte la final
+ */
+struct Task_Importer::Chunk_Result {
+    std::vector<Task*> tasks;                      // Sarcinile create, în ordinea rândurilor
+    std::vector<std::uint32_t> assignees;          // Pentru fiecare sarcină: indexul numelui + 1 (0 = niciunul)
+    std::vector<std::uint32_t> category_offsets;   // Începutul categoriilor fiecărei sarcini în category_refs
+    std::vector<std::uint32_t> category_refs;      // Indexurile numelor de categorii
+    std::vector<std::string> user_names;           // Numele distincte de utilizatori din bucată
+    std::vector<std::string> category_names;       // Numele distincte de categorii din bucată
+    std::vector<Import_Error> errors;              // Linia este relativă la începutul bucății
+    size_t line_count;                             // Numărul de linii din bucată
+    size_t row_count;                              // Numărul de rânduri de date
+
+    Chunk_Result() : line_count(0), row_count(0) {}
+};
+
+const size_t Task_Importer::CHUNK_SIZE;
+
+Task_Importer::Task_Importer(Task_Factory* factory, Work_Stealing_Pool* pool)
+    : m_factory(factory), m_pool(pool) {
+    // Utilizatorii și categoriile cunoscute se adaugă separat
+}
+
+void Task_Importer::AddKnownUser(User* user) {
+    if (user) {
+        m_users[user->GetName()] = user;
+    }
+}
+
+void Task_Importer::AddKnownCategory(Category* category) {
+    if (category) {
+        m_categories[category->GetName()] = category;
+    }
+}
+
+bool Task_Importer::ImportFile(const std::string& path, Task_List& task_list, Import_Result& result) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    // Maparea rămâne validă și după închiderea descriptorului
+    Mapping mapping;
+    mapping.size = static_cast<size_t>(info.st_size);
+    if (mapping.size > 0) {
+        mapping.data = ::mmap(nullptr, mapping.size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd);
+    if (mapping.size > 0 && mapping.data == MAP_FAILED) {
+        return false;
+    }
+    if (mapping.size > 0) {
+        ::madvise(mapping.data, mapping.size, MADV_SEQUENTIAL);
+    }
+    return ImportBuffer(mapping.size > 0 ? static_cast<const char*>(mapping.data) : "", mapping.size, task_list, result);
+}
+
+bool Task_Importer::ImportBuffer(const char* data, size_t size, Task_List& task_list, Import_Result& result) {
+    const char* end = data + size;
+
+    // Antetul: pozițiile coloanelor recunoscute
+    std::vector<std::string> fields;
+    size_t field_count = 0;
+    size_t header_lines = 0;
+    bool malformed = false;
+    const char* body = ReadRow(data, end, fields, field_count, header_lines, malformed);
+    if (!body || malformed || size == 0) {
+        return false;
+    }
+    Columns columns;
+    for (size_t i = 0; i < field_count; ++i) {
+        std::string name = NormalizeToken(fields[i]);
+        size_t* column = name == "TYPE" ? &columns.type
+                       : name == "TITLE" ? &columns.title
+                       : name == "DESCRIPTION" ? &columns.description
+                       : name == "PRIORITY" ? &columns.priority
+                       : name == "STATUS" ? &columns.status
+                       : name == "DEADLINE" ? &columns.deadline
+                       : name == "ASSIGNEE" ? &columns.assignee
+                       : name == "CATEGORIES" ? &columns.categories
+                       : nullptr;
+        if (column && *column == MISSING_COLUMN) {
+            *column = i;
+        }
+    }
+    if (columns.title == MISSING_COLUMN) {
+        return false;
+    }
+
+    // Împărțirea în bucăți: întâi calculăm, pentru fiecare bucată brută și fiecare stare
+    // posibilă de la începutul ei, starea cititorului de la sfârșitul ei
+    size_t body_size = static_cast<size_t>(end - body);
+    size_t chunk_count = std::max<size_t>(1, (body_size + CHUNK_SIZE - 1) / CHUNK_SIZE);
+    std::vector<std::array<Csv_State, CSV_STATE_COUNT>> end_states(chunk_count);
+    Work_Stealing_Pool::ParallelFor(m_pool, chunk_count, [&](size_t i) {
+        const char* begin = body + i * CHUNK_SIZE;
+        const char* stop = std::min(end, begin + CHUNK_SIZE);
+        for (int start = 0; start < CSV_STATE_COUNT; ++start) {
+            end_states[i][start] = CsvSkip(static_cast<Csv_State>(start), begin, stop);
+        }
+    });
+
+    // Înlănțuirea stărilor dă starea reală de la începutul fiecărei bucăți
+    std::vector<Csv_State> start_states(chunk_count, Csv_State::FIELD_START);
+    for (size_t i = 1; i < chunk_count; ++i) {
+        start_states[i] = end_states[i - 1][static_cast<int>(start_states[i - 1])];
+    }
+
+    // Fiecare bucată începe după primul sfârșit de rând din ea
+    std::vector<const char*> boundaries(chunk_count + 1, end);
+    boundaries[0] = body;
+    Work_Stealing_Pool::ParallelFor(m_pool, chunk_count - 1, [&](size_t i) {
+        const char* pos = body + (i + 1) * CHUNK_SIZE;
+        Csv_State state = start_states[i + 1];
+        bool row_end = false;
+        while (pos != end && !row_end) {
+            state = CsvStep(state, *pos, row_end);
+            ++pos;
+        }
+        boundaries[i + 1] = pos;
+    });
+
+    // Analiza și crearea sarcinilor, în paralel pe bucăți
+    std::vector<Chunk_Result> chunks(chunk_count);
+    Work_Stealing_Pool::ParallelFor(m_pool, chunk_count, [&](size_t i) {
+        _ParseChunk(boundaries[i], std::max(boundaries[i], boundaries[i + 1]), columns, chunks[i]);
+    });
+
+    // Unificarea numelor: fiecare utilizator și categorie lipsă este creat o singură dată
+    std::vector<User*> users;
+    std::vector<Category*> categories;
+    std::unordered_map<User*, size_t> user_slots;
+    std::unordered_map<Category*, size_t> category_slots;
+    std::vector<std::vector<size_t>> chunk_user_slots(chunk_count);
+    std::vector<std::vector<size_t>> chunk_category_slots(chunk_count);
+    for (size_t i = 0; i < chunk_count; ++i) {
+        for (const std::string& name : chunks[i].user_names) {
+            User*& user = m_users[name];
+            if (!user) {
+                user = new User(name, "");
+                result.created_users.push_back(user);
+            }
+            auto slot = user_slots.emplace(user, users.size());
+            if (slot.second) {
+                users.push_back(user);
+            }
+            chunk_user_slots[i].push_back(slot.first->second);
+        }
+        for (const std::string& name : chunks[i].category_names) {
+            Category*& category = m_categories[name];
+            if (!category) {
+                category = new Category(name, "");
+                result.created_categories.push_back(category);
+            }
+            auto slot = category_slots.emplace(category, categories.size());
+            if (slot.second) {
+                categories.push_back(category);
+            }
+            chunk_category_slots[i].push_back(slot.first->second);
+        }
+    }
+
+    // Legăturile sarcină -> utilizator / categorii țin doar de sarcină, deci se setează
+    // în paralel, cât timp sarcinile fiecărei bucăți sunt încă în cache. Câmpurile sunt
+    // scrise direct, ca la încărcarea unui Snapshot: observatorii au văzut doar crearea
+    // sarcinilor, nu și modificările lor
+    Work_Stealing_Pool::ParallelFor(m_pool, chunk_count, [&](size_t i) {
+        const Chunk_Result& chunk = chunks[i];
+        for (size_t t = 0; t < chunk.tasks.size(); ++t) {
+            Task* task = chunk.tasks[t];
+            if (chunk.assignees[t]) {
+                task->m_assigned_user = users[chunk_user_slots[i][chunk.assignees[t] - 1]];
+            }
+            task->m_categories.reserve(chunk.category_offsets[t + 1] - chunk.category_offsets[t]);
+            for (std::uint32_t r = chunk.category_offsets[t]; r < chunk.category_offsets[t + 1]; ++r) {
+                task->m_categories.push_back(categories[chunk_category_slots[i][chunk.category_refs[r]]]);
+            }
+        }
+    });
+
+    // Gruparea sarcinilor pe utilizatori și categorii, păstrând ordinea rândurilor
+    std::vector<std::vector<Task*>> user_tasks(users.size());
+    std::vector<std::vector<Task*>> category_tasks(categories.size());
+    size_t task_total = 0;
+    size_t line = header_lines + 1;
+    for (size_t i = 0; i < chunk_count; ++i) {
+        Chunk_Result& chunk = chunks[i];
+        for (size_t t = 0; t < chunk.tasks.size(); ++t) {
+            if (chunk.assignees[t]) {
+                user_tasks[chunk_user_slots[i][chunk.assignees[t] - 1]].push_back(chunk.tasks[t]);
+            }
+            for (std::uint32_t r = chunk.category_offsets[t]; r < chunk.category_offsets[t + 1]; ++r) {
+                category_tasks[chunk_category_slots[i][chunk.category_refs[r]]].push_back(chunk.tasks[t]);
+            }
+        }
+        for (const Import_Error& error : chunk.errors) {
+            result.errors.push_back(Import_Error{line + error.line, error.message});
+        }
+        line += chunk.line_count;
+        task_total += chunk.tasks.size();
+        result.row_count += chunk.row_count;
+    }
+
+    // Colecțiile primesc sarcinile în bloc; legăturile inverse au fost deja setate
+    for (size_t u = 0; u < users.size(); ++u) {
+        users[u]->AddAssignedTasks(user_tasks[u]);
+    }
+    for (size_t c = 0; c < categories.size(); ++c) {
+        categories[c]->m_tasks.AddRange(category_tasks[c].data(), category_tasks[c].size());
+    }
+
+    result.tasks.reserve(result.tasks.size() + task_total);
+    size_t first_new = result.tasks.size();
+    for (const Chunk_Result& chunk : chunks) {
+        result.tasks.insert(result.tasks.end(), chunk.tasks.begin(), chunk.tasks.end());
+    }
+    task_list.AddTasks(result.tasks.data() + first_new, task_total);
+    return true;
+}
+
+void Task_Importer::_ParseChunk(const char* begin, const char* end, const Columns& columns, Chunk_Result& chunk) {
+    std::vector<std::string> fields;
+    std::unordered_map<std::string, std::uint32_t> user_index;
+    std::unordered_map<std::string, std::uint32_t> category_index;
+    std::string error;
+    chunk.category_offsets.push_back(0);
+
+    const char* pos = begin;
+    while (pos != end) {
+        size_t row_line = chunk.line_count;
+        size_t field_count = 0;
+        size_t lines = 0;
+        bool malformed = false;
+        const char* next = ReadRow(pos, end, fields, field_count, lines, malformed);
+        if (!next) {
+            chunk.errors.push_back(Import_Error{row_line, "unterminated quoted field"});
+            chunk.line_count += static_cast<size_t>(std::count(pos, end, '\n'));
+            break;
+        }
+        chunk.line_count += lines;
+        pos = next;
+        if (malformed) {
+            ++chunk.row_count;
+            chunk.errors.push_back(Import_Error{row_line, "quote inside an unquoted field"});
+            continue;
+        }
+
+        // Rândurile goale sunt ignorate
+        if (field_count == 1 && fields[0].empty()) {
+            continue;
+        }
+        ++chunk.row_count;
+
+        // Câmpurile lipsă de la finalul rândului sunt considerate goale
+        for (size_t i = field_count; i < fields.size(); ++i) {
+            fields[i].clear();
+        }
+
+        Task* task = _CreateTask(fields, columns, error);
+        if (!task) {
+            chunk.errors.push_back(Import_Error{row_line, error});
+            continue;
+        }
+        chunk.tasks.push_back(task);
+
+        // Numele sunt reținute local; obiectele se caută o singură dată, la final
+        std::uint32_t assignee = 0;
+        if (columns.assignee < fields.size()) {
+            std::string name = Trim(fields[columns.assignee]);
+            if (!name.empty()) {
+                assignee = InternName(name, user_index, chunk.user_names) + 1;
+            }
+        }
+        chunk.assignees.push_back(assignee);
+
+        if (columns.categories < fields.size()) {
+            const std::string& list = fields[columns.categories];
+            size_t start = 0;
+            while (start <= list.size()) {
+                size_t stop = list.find(';', start);
+                if (stop == std::string::npos) {
+                    stop = list.size();
+                }
+                std::string name = Trim(list.substr(start, stop - start));
+                if (!name.empty()) {
+                    chunk.category_refs.push_back(InternName(name, category_index, chunk.category_names));
+                }
+                start = stop + 1;
+            }
+        }
+        chunk.category_offsets.push_back(static_cast<std::uint32_t>(chunk.category_refs.size()));
+    }
+}
+
+Task* Task_Importer::_CreateTask(const std::vector<std::string>& fields, const Columns& columns, std::string& error) {
+    static const std::string EMPTY;
+    const std::string& title = columns.title < fields.size() ? fields[columns.title] : EMPTY;
+    const std::string& description = columns.description < fields.size() ? fields[columns.description] : EMPTY;
+    const std::string& deadline_text = columns.deadline < fields.size() ? fields[columns.deadline] : EMPTY;
+
+    if (title.empty()) {
+        error = "missing title";
+        return nullptr;
+    }
+    Priority priority;
+    if (!ParsePriority(columns.priority < fields.size() ? fields[columns.priority] : EMPTY, priority)) {
+        error = "invalid priority '" + fields[columns.priority] + "'";
+        return nullptr;
+    }
+    TaskStatus status;
+    if (!ParseStatus(columns.status < fields.size() ? fields[columns.status] : EMPTY, status)) {
+        error = "invalid status '" + fields[columns.status] + "'";
+        return nullptr;
+    }
+
+    // Tipul implicit depinde de prezența termenului limită
+    std::string type = NormalizeToken(columns.type < fields.size() ? fields[columns.type] : EMPTY);
+    bool has_deadline = !Trim(deadline_text).empty();
+    bool is_deadline;
+    if (type.empty()) {
+        is_deadline = has_deadline;
+    } else if (type == "SIMPLE" || type == "SIMPLE_TASK") {
+        is_deadline = false;
+    } else if (type == "DEADLINE" || type == "DEADLINE_TASK") {
+        is_deadline = true;
+    } else {
+        error = "unsupported type '" + fields[columns.type] + "'";
+        return nullptr;
+    }
+
+    Task* task = nullptr;
+    if (is_deadline) {
+        int parts[3];
+        if (!ParseDate(deadline_text, parts)) {
+            error = has_deadline ? "invalid deadline '" + deadline_text + "'" : "missing deadline";
+            return nullptr;
+        }
+        Date deadline(parts[0], parts[1], parts[2]);
+        task = m_factory ? m_factory->Create<Deadline_Task>(title, description, priority, deadline)
+                         : new Deadline_Task(title, description, priority, deadline);
+    } else {
+        task = m_factory ? m_factory->Create<Simple_Task>(title, description, priority)
+                         : new Simple_Task(title, description, priority);
+    }
+    // Fără SetStatus: sarcina nouă nu are proiecte părinte, iar observatorii nu sunt notificați
+    task->m_status = status;
+    return task;
+}
+
+} // namespace Task_Management
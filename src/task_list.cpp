@@ -1,15 +1,15 @@
 #include "task_list.h"
+#include "id_allocator.h"
 #include "task.h"
 #include "inotifier.h"
+#include "text_matcher.h"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <iterator>
 
 namespace Task_Management {
 
-// Inițializarea membrului static
-int Task_List::s_id_counter = 0;
-
 Task_List::Task_List(const std::string& name)
     : m_name(name), m_notifier(nullptr) {
     // Generăm un ID unic pentru lista de sarcini
@@ -40,64 +40,78 @@ void Task_List::SetName(const std::string& name) {
     m_name = name;
 }
 
-std::string Task_List::GetId() const {
+Entity_Id Task_List::GetId() const {
     // Returnează ID-ul unic al listei de sarcini
     return m_id;
 }
 
 void Task_List::AddTask(Task* task) {
     // Adaugă o sarcină la listă dacă pointerul nu este null
-    if (task) {
-        m_tasks.push_back(task);
-    }
+    m_tasks.Add(task);
 }
 
-bool Task_List::RemoveTask(const std::string& task_id) {
-    // Caută sarcina cu ID-ul specificat
-    auto it = std::find_if(m_tasks.begin(), m_tasks.end(),
-                          [&task_id](const Task* task) { return task->GetId() == task_id; });
-    
-    // Dacă am găsit sarcina, o eliminăm și returnăm true
-    if (it != m_tasks.end()) {
-        m_tasks.erase(it);
-        return true;
-    }
-    
-    // Dacă nu am găsit sarcina, returnăm false
-    return false;
+void Task_List::AddTasks(Task* const* tasks, size_t count) {
+    // Adaugă toate sarcinile cu o singură rezervare de memorie
+    m_tasks.AddRange(tasks, count);
+}
+
+void Task_List::AddTasks(const std::vector<Task*>& tasks) {
+    AddTasks(tasks.data(), tasks.size());
+}
+
+bool Task_List::RemoveTask(const Entity_Id& task_id) {
+    // Eliminăm sarcina cu ID-ul specificat
+    // Colecția decide dacă folosește căutarea liniară sau indexul după ID
+    return m_tasks.Remove(task_id);
 }
 
 const std::vector<Task*>& Task_List::GetTasks() const {
     // Returnează toate sarcinile din listă
-    return m_tasks;
+    return m_tasks.GetTasks();
+}
+
+std::vector<Task*> Task_List::SearchTasks(const std::string& keyword, bool ignore_case) const {
+    // Cuvântul cheie este pregătit o singură dată pentru toate sarcinile
+    Text_Matcher matcher(keyword, ignore_case);
+    std::vector<Task*> matching_tasks;
+    const std::vector<Task*>& tasks = m_tasks.GetTasks();
+    std::copy_if(tasks.begin(), tasks.end(), std::back_inserter(matching_tasks),
+                 [&matcher](const Task* task) { return task->ContainsText(matcher); });
+    return matching_tasks;
+}
+
+void Task_List::SetStorageMode(Task_Collection::Storage_Mode mode) {
+    // Setează modul de stocare al colecției de sarcini
+    m_tasks.SetStorageMode(mode);
 }
 
 size_t Task_List::GetTaskCount() const {
     // Returnează numărul de sarcini din listă
-    return m_tasks.size();
+    return m_tasks.Size();
 }
 
 size_t Task_List::GetCompletedTaskCount() const {
     // Numără sarcinile finalizate folosind std::count_if din STL
     // Aceasta este o funcție care numără elementele care satisfac o condiție
-    return std::count_if(m_tasks.begin(), m_tasks.end(),
+    const std::vector<Task*>& tasks = m_tasks.GetTasks();
+    return std::count_if(tasks.begin(), tasks.end(),
                         [](const Task* task) { return task->IsCompleted(); });
 }
 
 double Task_List::GetCompletionPercentage() const {
     // Dacă lista este goală, returnăm 0%
-    if (m_tasks.empty()) {
+    if (m_tasks.IsEmpty()) {
         return 0.0;
     }
     
     // Calculăm procentul mediu de finalizare al tuturor sarcinilor
     double total_percentage = 0.0;
-    for (const auto& task : m_tasks) {
+    for (const auto& task : m_tasks.GetTasks()) {
         total_percentage += task->GetCompletionPercentage();
     }
     
     // Returnăm media
-    return total_percentage / m_tasks.size();
+    return total_percentage / m_tasks.Size();
 }
 
 void Task_List::DisplayDetails() const {
@@ -120,7 +134,7 @@ bool Task_List::SendNotification(const std::string& recipient, const std::string
     // Construim mesajul notificării
     std::stringstream message;
     message << "Task List: " << m_name << "\n";
-    message << "Total Tasks: " << m_tasks.size() << "\n";
+    message << "Total Tasks: " << m_tasks.Size() << "\n";
     message << "Completed Tasks: " << GetCompletedTaskCount() << "\n";
     message << "Completion Percentage: " << GetCompletionPercentage() << "%\n";
     
@@ -135,43 +149,41 @@ Task_List Task_List::operator+(const Task_List& other) const {
     Task_List combined(*this);
     
     // Adăugăm toate sarcinile din cealaltă listă
-    for (const auto& task : other.m_tasks) {
-        combined.AddTask(task);
-    }
+    combined.AddTasks(other.m_tasks.GetTasks());
     
     return combined;  // Returnăm noua listă combinată
 }
 
 // Implementarea operatorului << suprascris
 std::ostream& operator<<(std::ostream& os, const Task_List& task_list) {
-    os << "=== Task List Details ===" << std::endl;
-    os << "ID: " << task_list.m_id << std::endl;
-    os << "Name: " << task_list.m_name << std::endl;
-    os << "Tasks: " << task_list.m_tasks.size() << std::endl;
-    os << "Completed Tasks: " << task_list.GetCompletedTaskCount() << std::endl;
-    os << "Completion Percentage: " << task_list.GetCompletionPercentage() << "%" << std::endl;
+    const std::vector<Task*>& tasks = task_list.m_tasks.GetTasks();
+    os << "=== Task List Details ===" << "\n";
+    os << "ID: " << task_list.m_id << "\n";
+    os << "Name: " << task_list.m_name << "\n";
+    os << "Tasks: " << tasks.size() << "\n";
+    os << "Completed Tasks: " << task_list.GetCompletedTaskCount() << "\n";
+    os << "Completion Percentage: " << task_list.GetCompletionPercentage() << "%\n";
     
     // Afișează sarcinile din această listă
-    if (!task_list.m_tasks.empty()) {
-        os << "Tasks in this list:" << std::endl;
-        for (size_t i = 0; i < task_list.m_tasks.size(); ++i) {
-            os << "  " << (i + 1) << ". " << task_list.m_tasks[i]->GetTitle() 
-               << " [" << task_list.m_tasks[i]->GetTaskType() << "]"
-               << " - " << (task_list.m_tasks[i]->IsCompleted() ? "Completed" : "Not Completed")
-               << std::endl;
+    if (!tasks.empty()) {
+        os << "Tasks in this list:" << "\n";
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            os << "  " << (i + 1) << ". " << tasks[i]->GetTitle() 
+               << " [" << tasks[i]->GetTaskType() << "]"
+               << " - " << (tasks[i]->IsCompleted() ? "Completed" : "Not Completed")
+               << "\n";
         }
     }
     
-    os << "=======================" << std::endl;
+    os << "=======================" << "\n";
     return os;  // Returnăm stream-ul pentru a permite înlănțuirea
 }
 
 // Metodă privată pentru generarea ID-urilor unice
-std::string Task_List::_GenerateId() {
-    // Folosim un stringstream pentru a construi ID-ul
-    std::stringstream ss;
-    ss << "LIST-" << ++s_id_counter;  // Incrementăm contorul static și îl includem în ID
-    return ss.str();  // Returnăm ID-ul ca string
+Entity_Id Task_List::_GenerateId() {
+    // ID-ul este un întreg compact; forma text "LIST-N" se produce doar la afișare
+    // Generatorul comun este thread-safe, deci obiectele pot fi create din mai multe fire
+    return Id_Allocator::GetInstance().Allocate(Entity_Kind::TASK_LIST);
 }
 
 } // namespace Task_Management
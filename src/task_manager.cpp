@@ -0,0 +1,122 @@
+#include "task_manager.h"
+#include "task.h"
+#include "user.h"
+#include "category.h"
+#include "task_list.h"
+
+namespace Task_Management {
+
+Task_Manager::Task_Manager() {
+    // Constructor privat - registrele sunt inițializate automat ca goale
+}
+
+Task_Manager::~Task_Manager() {
+    // Implementarea destructorului
+    // Registrul nu deține obiectele, deci nu avem resurse de eliberat
+}
+
+Task_Manager& Task_Manager::GetInstance() {
+    // Variabila statică locală este construită o singură dată, la primul apel
+    // Standardul C++11 garantează că această inițializare este thread-safe
+    static Task_Manager instance;
+    return instance;
+}
+
+bool Task_Manager::AddTask(Task* task) {
+    // Înregistrăm sarcina dacă pointerul nu este null
+    if (!task) {
+        return false;
+    }
+    return m_tasks.Add(task->GetId(), task);
+}
+
+bool Task_Manager::RemoveTask(const Entity_Id& task_id) {
+    return m_tasks.Remove(task_id);
+}
+
+Task* Task_Manager::GetTask(const Entity_Id& task_id) const {
+    return m_tasks.Get(task_id);
+}
+
+size_t Task_Manager::GetTaskCount() const {
+    return m_tasks.Size();
+}
+
+bool Task_Manager::AddUser(User* user) {
+    // Înregistrăm utilizatorul dacă pointerul nu este null
+    if (!user) {
+        return false;
+    }
+    return m_users.Add(user->GetId(), user);
+}
+
+bool Task_Manager::RemoveUser(const Entity_Id& user_id) {
+    return m_users.Remove(user_id);
+}
+
+User* Task_Manager::GetUser(const Entity_Id& user_id) const {
+    return m_users.Get(user_id);
+}
+
+size_t Task_Manager::GetUserCount() const {
+    return m_users.Size();
+}
+
+bool Task_Manager::AddCategory(Category* category) {
+    // Înregistrăm categoria dacă pointerul nu este null
+    if (!category) {
+        return false;
+    }
+    return m_categories.Add(category->GetId(), category);
+}
+
+bool Task_Manager::RemoveCategory(const Entity_Id& category_id) {
+    return m_categories.Remove(category_id);
+}
+
+Category* Task_Manager::GetCategory(const Entity_Id& category_id) const {
+    return m_categories.Get(category_id);
+}
+
+size_t Task_Manager::GetCategoryCount() const {
+    return m_categories.Size();
+}
+
+bool Task_Manager::AddTaskList(Task_List* task_list) {
+    // Înregistrăm lista dacă pointerul nu este null
+    if (!task_list) {
+        return false;
+    }
+    return m_task_lists.Add(task_list->GetId(), task_list);
+}
+
+bool Task_Manager::RemoveTaskList(const Entity_Id& list_id) {
+    return m_task_lists.Remove(list_id);
+}
+
+Task_List* Task_Manager::GetTaskList(const Entity_Id& list_id) const {
+    return m_task_lists.Get(list_id);
+}
+
+size_t Task_Manager::GetTaskListCount() const {
+    return m_task_lists.Size();
+}
+
+void Task_Manager::ReserveTasks(size_t task_count) {
+    // Rezervăm spațiu în fiecare fragment pentru a evita rehash-urile
+    m_tasks.Reserve(task_count);
+}
+
+void Task_Manager::ForEachTask(const std::function<void(Task*)>& visitor) const {
+    m_tasks.ForEach(visitor);
+}
+
+void Task_Manager::Clear() {
+    // Golim toate registrele; obiectele rămân în grija apelantului
+    m_tasks.Clear();
+    m_users.Clear();
+    m_categories.Clear();
+    m_task_lists.Clear();
+}
+
+} // namespace Task_Management
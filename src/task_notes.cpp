@@ -4,12 +4,74 @@
 
 namespace Task_Management {
 
-Task_Notes::Task_Notes() : m_task(nullptr) {
+namespace {
+
+/**
+ * Octeții care fac parte dintr-un cuvânt: litere, cifre și octeții UTF-8 din afara ASCII
+ * (astfel încât literele cu diacritice nu despart cuvintele)
+ */
+inline bool IsWordByte(unsigned char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c >= 0x80;
+}
+
+/**
+ * Apelează function pentru fiecare cuvânt din text, cu literele ASCII transformate în litere mici
+ * @param word Buffer refolosit pentru cuvântul curent
+ */
+template <typename Function>
+void ForEachWord(const std::string& text, std::string& word, Function function) {
+    word.clear();
+    for (char c : text) {
+        unsigned char byte = static_cast<unsigned char>(c);
+        if (IsWordByte(byte)) {
+            word += (byte >= 'A' && byte <= 'Z') ? static_cast<char>(byte + ('a' - 'A')) : c;
+        } else if (!word.empty()) {
+            function(word);
+            word.clear();
+        }
+    }
+    if (!word.empty()) {
+        function(word);
+    }
+}
+
+/**
+ * Păstrează în result doar pozițiile care apar și în postings (ambele crescătoare)
+ * Lista mai lungă este parcursă cu pași exponențiali, deci costul depinde în principal
+ * de lungimea listei mai scurte
+ */
+void Intersect(std::vector<size_t>& result, const std::vector<std::uint32_t>& postings) {
+    size_t kept = 0;
+    size_t low = 0;
+    size_t count = postings.size();
+    for (size_t position : result) {
+        size_t step = 1;
+        size_t high = low;
+        while (high < count && postings[high] < position) {
+            low = high + 1;
+            high += step;
+            step *= 2;
+        }
+        low = static_cast<size_t>(std::lower_bound(postings.begin() + low, postings.begin() + std::min(high + 1, count), position) - postings.begin());
+        if (low == count) {
+            break;
+        }
+        if (postings[low] == position) {
+            result[kept++] = position;
+            ++low;
+        }
+    }
+    result.resize(kept);
+}
+
+} // namespace
+
+Task_Notes::Task_Notes() : m_task(nullptr), m_indexed(false) {
     // Constructor implicit - inițializează membrul m_task cu nullptr
     // Vectorul m_notes este inițializat automat ca gol
 }
 
-Task_Notes::Task_Notes(Task* task) : m_task(task) {
+Task_Notes::Task_Notes(Task* task) : m_task(task), m_indexed(false) {
     // Constructor cu parametru - inițializează membrul m_task cu valoarea primită
     // Vectorul m_notes este inițializat automat ca gol
 }
@@ -23,6 +85,11 @@ Task_Notes::~Task_Notes() {
 void Task_Notes::AddNote(const Note& note) {
     // Adaugă o notă la colecția de note
     m_notes.push_back(note);
+    
+    // Indexul este actualizat doar cu cuvintele notei noi
+    if (m_indexed) {
+        _IndexNote(m_notes.size() - 1);
+    }
 }
 
 void Task_Notes::AddNote(const std::string& text, const std::string& author, 
@@ -50,18 +117,101 @@ std::vector<Note> Task_Notes::GetImportantNotes() const {
     return important_notes;
 }
 
-std::vector<Note> Task_Notes::SearchNotes(const std::string& keyword) const {
+std::vector<Note> Task_Notes::SearchNotes(const std::string& keyword, bool ignore_case) const {
     // Caută note care conțin un anumit cuvânt cheie
     std::vector<Note> matching_notes;
     
+    // Cuvântul cheie este pregătit o singură dată pentru toate notele
+    Text_Matcher matcher(keyword, ignore_case);
+    
     // Folosim std::copy_if pentru a copia doar notele care conțin cuvântul cheie
     std::copy_if(m_notes.begin(), m_notes.end(), 
                 std::back_inserter(matching_notes),
-                [&keyword](const Note& note) { return note.ContainsKeyword(keyword); });
+                [&matcher](const Note& note) { return note.ContainsKeyword(matcher); });
     
     return matching_notes;
 }
 
+std::vector<size_t> Task_Notes::FindNotes(const std::string& keyword) const {
+    return FindNotes(std::vector<std::string>(1, keyword));
+}
+
+std::vector<size_t> Task_Notes::FindNotes(const std::vector<std::string>& keywords) const {
+    std::vector<size_t> result;
+    
+    // Cuvintele distincte ale interogării, în aceeași formă ca în index
+    std::vector<std::string> words;
+    std::string word;
+    for (const std::string& keyword : keywords) {
+        ForEachWord(keyword, word, [&words](const std::string& found) {
+            if (std::find(words.begin(), words.end(), found) == words.end()) {
+                words.push_back(found);
+            }
+        });
+    }
+    if (words.empty()) {
+        return result;
+    }
+    
+    if (!m_indexed) {
+        // Fără index, fiecare notă este împărțită în cuvinte și comparată cu interogarea
+        std::vector<bool> matched;
+        for (size_t i = 0; i < m_notes.size(); ++i) {
+            matched.assign(words.size(), false);
+            size_t matched_count = 0;
+            ForEachWord(m_notes[i].text, word, [&](const std::string& found) {
+                for (size_t w = 0; w < words.size(); ++w) {
+                    if (!matched[w] && words[w] == found) {
+                        matched[w] = true;
+                        ++matched_count;
+                    }
+                }
+            });
+            if (matched_count == words.size()) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+    
+    // Listele sunt intersectate începând cu cea mai scurtă
+    std::vector<const std::vector<std::uint32_t>*> lists;
+    for (const std::string& query_word : words) {
+        auto entry = m_index.find(query_word);
+        if (entry == m_index.end()) {
+            return result;  // Un cuvânt care nu apare în nicio notă
+        }
+        lists.push_back(&entry->second);
+    }
+    std::sort(lists.begin(), lists.end(),
+              [](const std::vector<std::uint32_t>* a, const std::vector<std::uint32_t>* b) { return a->size() < b->size(); });
+    result.assign(lists[0]->begin(), lists[0]->end());
+    for (size_t i = 1; i < lists.size() && !result.empty(); ++i) {
+        Intersect(result, *lists[i]);
+    }
+    return result;
+}
+
+void Task_Notes::EnableIndex() {
+    if (m_indexed) {
+        return;
+    }
+    m_indexed = true;
+    m_index.clear();
+    for (size_t i = 0; i < m_notes.size(); ++i) {
+        _IndexNote(i);
+    }
+}
+
+void Task_Notes::DisableIndex() {
+    m_indexed = false;
+    std::unordered_map<std::string, std::vector<std::uint32_t>>().swap(m_index);
+}
+
+bool Task_Notes::IsIndexed() const {
+    return m_indexed;
+}
+
 void Task_Notes::DisplayNotes() const {
     // Afișează toate notele
     std::cout << "Notes for task: " << (m_task ? m_task->GetTitle() : "Unassigned") << std::endl;
@@ -87,4 +237,17 @@ Task* Task_Notes::GetTask() const {
     return m_task;
 }
 
+void Task_Notes::_IndexNote(size_t position) {
+    // Notele sunt indexate în ordinea adăugării, deci listele rămân crescătoare;
+    // un cuvânt repetat în aceeași notă apare o singură dată în listă
+    std::uint32_t note = static_cast<std::uint32_t>(position);
+    std::string word;
+    ForEachWord(m_notes[position].text, word, [this, note](const std::string& found) {
+        std::vector<std::uint32_t>& postings = m_index[found];
+        if (postings.empty() || postings.back() != note) {
+            postings.push_back(note);
+        }
+    });
+}
+
 } // namespace Task_Management
@@ -1,5 +1,6 @@
 #include "team_leader.h"
 #include <iostream>
+#include <algorithm>
 
 namespace Task_Management {
 
@@ -38,7 +39,7 @@ void Team_Leader::AddTeamMember(User* member) {
     }
 }
 
-bool Team_Leader::RemoveTeamMember(const std::string& member_id) {
+bool Team_Leader::RemoveTeamMember(const Entity_Id& member_id) {
     // Caută membrul cu ID-ul specificat
     auto it = std::find_if(m_team_members.begin(), m_team_members.end(),
                           [&member_id](const User* member) { return member->GetId() == member_id; });
@@ -66,19 +67,19 @@ size_t Team_Leader::GetTeamSize() const {
 void Team_Leader::DisplayDetails() const {
     // Suprascrierea metodei din clasa de bază pentru a afișa detalii specifice
     // Aceasta este o demonstrație de polimorfism
-    std::cout << "=== Team Leader Details ===" << std::endl;
+    std::cout << "=== Team Leader Details ===" << "\n";
     _WriteDetailsToStream(std::cout);
     
     // Afișează membrii echipei
     if (!m_team_members.empty()) {
-        std::cout << "Team members:" << std::endl;
+        std::cout << "Team members:" << "\n";
         for (size_t i = 0; i < m_team_members.size(); ++i) {
             std::cout << "  " << (i + 1) << ". " << m_team_members[i]->GetName() 
-                      << " [" << m_team_members[i]->GetId() << "]" << std::endl;
+                      << " [" << m_team_members[i]->GetId() << "]" << "\n";
         }
     }
     
-    std::cout << "==========================" << std::endl;
+    std::cout << "==========================" << "\n";
 }
 
 std::string Team_Leader::GetUserType() const {
@@ -92,8 +93,8 @@ void Team_Leader::_WriteDetailsToStream(std::ostream& os) const {
     User::_WriteDetailsToStream(os);
     
     // Apoi adăugăm detaliile specifice acestei clase
-    os << "Department: " << m_department << std::endl;
-    os << "Team Size: " << m_team_members.size() << std::endl;
+    os << "Department: " << m_department << "\n";
+    os << "Team Size: " << m_team_members.size() << "\n";
 }
 
 } // namespace Task_Management
@@ -0,0 +1,255 @@
+#include "text_matcher.h"
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TEXT_MATCHER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace Task_Management {
+
+const size_t Text_Matcher::NOT_FOUND;
+
+namespace {
+
+/**
+ * Datele cuvântului cheie transmise variantelor de căutare
+ */
+struct Pattern {
+    const char* keyword;        // Cuvântul cheie (cu litere mici dacă ignore_case)
+    size_t size;                // Lungimea cuvântului (cel puțin 1)
+    unsigned char first;        // Primul octet
+    unsigned char last;         // Ultimul octet
+    unsigned char first_fold;   // Masca aplicată octeților comparați cu primul octet
+    unsigned char last_fold;    // Masca aplicată octeților comparați cu ultimul octet
+    bool ignore_case;           // Literele ASCII sunt comparate fără diferențe
+};
+
+typedef size_t (*Find_Function)(const Pattern& pattern, const char* text, size_t size);
+
+inline bool IsAsciiLetter(unsigned char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+inline unsigned char ToLower(unsigned char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c + ('a' - 'A')) : c;
+}
+
+/**
+ * Verifică potrivirea completă a cuvântului la o poziție candidată
+ * Primul și ultimul octet au fost deja verificați de filtru
+ */
+inline bool MatchesAt(const Pattern& pattern, const char* candidate) {
+    if (pattern.size <= 2) {
+        return true;
+    }
+    if (!pattern.ignore_case) {
+        return std::memcmp(candidate + 1, pattern.keyword + 1, pattern.size - 2) == 0;
+    }
+    for (size_t i = 1; i + 1 < pattern.size; ++i) {
+        if (ToLower(static_cast<unsigned char>(candidate[i])) != static_cast<unsigned char>(pattern.keyword[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Varianta scalară; folosită și pentru textele mai scurte decât un bloc vectorial
+ * @param start Prima poziție verificată
+ */
+size_t FindScalarFrom(const Pattern& pattern, const char* text, size_t size, size_t start) {
+    if (size < pattern.size) {
+        return Text_Matcher::NOT_FOUND;
+    }
+    size_t offset = pattern.size - 1;
+    if (pattern.first_fold == 0) {
+        // Primul octet este comparat exact, deci candidații sunt găsiți cu memchr
+        const char* end = text + size - offset;
+        const char* candidate = text + start;
+        while (candidate < end) {
+            candidate = static_cast<const char*>(std::memchr(candidate, pattern.first, static_cast<size_t>(end - candidate)));
+            if (candidate == nullptr) {
+                break;
+            }
+            if ((static_cast<unsigned char>(candidate[offset]) | pattern.last_fold) == pattern.last &&
+                MatchesAt(pattern, candidate)) {
+                return static_cast<size_t>(candidate - text);
+            }
+            ++candidate;
+        }
+        return Text_Matcher::NOT_FOUND;
+    }
+    for (size_t i = start; i + offset < size; ++i) {
+        // Masca 0x20 transformă o literă mare în literă mică (și nu schimbă literele mici)
+        if ((static_cast<unsigned char>(text[i]) | pattern.first_fold) == pattern.first &&
+            (static_cast<unsigned char>(text[i + offset]) | pattern.last_fold) == pattern.last &&
+            MatchesAt(pattern, text + i)) {
+            return i;
+        }
+    }
+    return Text_Matcher::NOT_FOUND;
+}
+
+size_t FindScalar(const Pattern& pattern, const char* text, size_t size) {
+    return FindScalarFrom(pattern, text, size, 0);
+}
+
+#ifdef TEXT_MATCHER_X86
+
+/**
+ * Varianta SSE2 (disponibilă pe orice procesor x86-64), blocuri de 16 octeți
+ * Finalul textului este tratat tot vectorial, printr-un ultim bloc suprapus
+ */
+__attribute__((target("sse2")))
+size_t FindSse2(const Pattern& pattern, const char* text, size_t size) {
+    size_t offset = pattern.size - 1;
+    if (size < offset + 16) {
+        return FindScalarFrom(pattern, text, size, 0);
+    }
+    const __m128i first = _mm_set1_epi8(static_cast<char>(pattern.first));
+    const __m128i last = _mm_set1_epi8(static_cast<char>(pattern.last));
+    const __m128i first_fold = _mm_set1_epi8(static_cast<char>(pattern.first_fold));
+    const __m128i last_fold = _mm_set1_epi8(static_cast<char>(pattern.last_fold));
+    size_t end = size - offset;  // Pozițiile candidate sunt [0, end)
+    size_t i = 0;
+    for (;;) {
+        unsigned skip = 0;
+        if (i + 16 > end) {
+            // Ultimul bloc este suprapus peste cel anterior; pozițiile deja verificate sunt ignorate
+            if (i >= end) {
+                return Text_Matcher::NOT_FOUND;
+            }
+            skip = static_cast<unsigned>(i - (end - 16));
+            i = end - 16;
+        }
+        __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + offset));
+        __m128i equal_first = _mm_cmpeq_epi8(_mm_or_si128(block_first, first_fold), first);
+        __m128i equal_last = _mm_cmpeq_epi8(_mm_or_si128(block_last, last_fold), last);
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(equal_first, equal_last)));
+        mask &= ~((1u << skip) - 1);
+        while (mask != 0) {
+            unsigned bit = static_cast<unsigned>(__builtin_ctz(mask));
+            if (MatchesAt(pattern, text + i + bit)) {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+        i += 16;
+    }
+}
+
+/**
+ * Varianta AVX2, blocuri de 32 de octeți
+ */
+__attribute__((target("avx2")))
+size_t FindAvx2(const Pattern& pattern, const char* text, size_t size) {
+    size_t offset = pattern.size - 1;
+    if (size < offset + 32) {
+        return FindSse2(pattern, text, size);
+    }
+    const __m256i first = _mm256_set1_epi8(static_cast<char>(pattern.first));
+    const __m256i last = _mm256_set1_epi8(static_cast<char>(pattern.last));
+    const __m256i first_fold = _mm256_set1_epi8(static_cast<char>(pattern.first_fold));
+    const __m256i last_fold = _mm256_set1_epi8(static_cast<char>(pattern.last_fold));
+    size_t end = size - offset;
+    size_t i = 0;
+    for (;;) {
+        unsigned skip = 0;
+        if (i + 32 > end) {
+            if (i >= end) {
+                return Text_Matcher::NOT_FOUND;
+            }
+            skip = static_cast<unsigned>(i - (end - 32));
+            i = end - 32;
+        }
+        __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+        __m256i block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i + offset));
+        __m256i equal_first = _mm256_cmpeq_epi8(_mm256_or_si256(block_first, first_fold), first);
+        __m256i equal_last = _mm256_cmpeq_epi8(_mm256_or_si256(block_last, last_fold), last);
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_and_si256(equal_first, equal_last)));
+        // skip < 32, deci deplasarea este definită
+        mask &= ~((1u << skip) - 1);
+        while (mask != 0) {
+            unsigned bit = static_cast<unsigned>(__builtin_ctz(mask));
+            if (MatchesAt(pattern, text + i + bit)) {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+        i += 32;
+    }
+}
+
+#endif
+
+/**
+ * Alege varianta de căutare potrivită procesorului, o singură dată
+ */
+Find_Function SelectFind(const char** name) {
+#ifdef TEXT_MATCHER_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        *name = "avx2";
+        return &FindAvx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        *name = "sse2";
+        return &FindSse2;
+    }
+#endif
+    *name = "scalar";
+    return &FindScalar;
+}
+
+struct Find_Selection {
+    const char* name;
+    Find_Function function;
+
+    Find_Selection() : name(nullptr), function(SelectFind(&name)) {}
+};
+
+const Find_Selection& GetFindSelection() {
+    static const Find_Selection selection;
+    return selection;
+}
+
+} // namespace
+
+Text_Matcher::Text_Matcher(const std::string& keyword, bool ignore_case)
+    : m_keyword(keyword),
+      m_ignore_case(ignore_case),
+      m_first_fold(0),
+      m_last_fold(0) {
+    if (m_ignore_case) {
+        for (char& c : m_keyword) {
+            c = static_cast<char>(ToLower(static_cast<unsigned char>(c)));
+        }
+        if (!m_keyword.empty()) {
+            m_first_fold = IsAsciiLetter(static_cast<unsigned char>(m_keyword.front())) ? 0x20 : 0;
+            m_last_fold = IsAsciiLetter(static_cast<unsigned char>(m_keyword.back())) ? 0x20 : 0;
+        }
+    }
+}
+
+size_t Text_Matcher::Find(const char* text, size_t size) const {
+    if (m_keyword.empty()) {
+        return 0;
+    }
+    Pattern pattern;
+    pattern.keyword = m_keyword.data();
+    pattern.size = m_keyword.size();
+    pattern.first = static_cast<unsigned char>(m_keyword.front());
+    pattern.last = static_cast<unsigned char>(m_keyword.back());
+    pattern.first_fold = m_first_fold;
+    pattern.last_fold = m_last_fold;
+    pattern.ignore_case = m_ignore_case;
+    return GetFindSelection().function(pattern, text, size);
+}
+
+const char* Text_Matcher::GetImplementationName() {
+    return GetFindSelection().name;
+}
+
+} // namespace Task_Management
@@ -0,0 +1,79 @@
+#include "today_clock.h"
+#include "system_clock.h"
+#include "date.h"
+#include <algorithm>
+
+namespace Task_Management {
+
+const std::int64_t Today_Clock::TICK_SECONDS;
+
+Today_Clock::Today_Clock()
+    : m_clock(&System_Clock::GetInstance()),
+      m_sequence(0),
+      m_valid_from(0),
+      m_valid_until(0),
+      m_day_number(0) {
+    // Intervalul gol [0, 0) forțează calculul datei la prima citire
+}
+
+Today_Clock& Today_Clock::GetInstance() {
+    // Inițializarea variabilei statice locale este thread-safe începând cu C++11
+    static Today_Clock instance;
+    return instance;
+}
+
+void Today_Clock::SetClock(IClock* clock) {
+    std::lock_guard<std::mutex> lock(m_refresh_mutex);
+    m_clock.store(clock ? clock : &System_Clock::GetInstance());
+    _Store(0, 0, 0);
+}
+
+int Today_Clock::GetDayNumber() {
+    std::int64_t now = m_clock.load(std::memory_order_acquire)->GetTime();
+
+    // Citire fără lacăt: valoarea este folosită doar dacă secvența nu s-a schimbat între timp
+    std::uint32_t sequence = m_sequence.load(std::memory_order_acquire);
+    if ((sequence & 1) == 0) {
+        std::int64_t valid_from = m_valid_from.load(std::memory_order_relaxed);
+        std::int64_t valid_until = m_valid_until.load(std::memory_order_relaxed);
+        int day_number = m_day_number.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_sequence.load(std::memory_order_relaxed) == sequence && now >= valid_from && now < valid_until) {
+            return day_number;
+        }
+    }
+    return _Refresh(now);
+}
+
+Date Today_Clock::GetDate() {
+    return Date::FromDayNumber(GetDayNumber());
+}
+
+int Today_Clock::_Refresh(std::int64_t now) {
+    std::lock_guard<std::mutex> lock(m_refresh_mutex);
+
+    // Alt fir poate să fi actualizat deja data cât timp am așteptat lacătul
+    std::int64_t valid_from = m_valid_from.load(std::memory_order_relaxed);
+    std::int64_t valid_until = m_valid_until.load(std::memory_order_relaxed);
+    if (now >= valid_from && now < valid_until) {
+        return m_day_number.load(std::memory_order_relaxed);
+    }
+
+    std::int64_t next_day = 0;
+    int day_number = m_clock.load(std::memory_order_relaxed)->GetLocalDay(now, next_day);
+    _Store(now, std::min(next_day, now + TICK_SECONDS), day_number);
+    return day_number;
+}
+
+void Today_Clock::_Store(std::int64_t valid_from, std::int64_t valid_until, int day_number) {
+    // Secvența impară anunță cititorii că valoarea este în curs de modificare
+    std::uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_valid_from.store(valid_from, std::memory_order_relaxed);
+    m_valid_until.store(valid_until, std::memory_order_relaxed);
+    m_day_number.store(day_number, std::memory_order_relaxed);
+    m_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+} // namespace Task_Management
@@ -1,14 +1,11 @@
 #include "user.h"
+#include "id_allocator.h"
 #include "task.h"
 #include <iostream>
-#include <sstream>
 #include <algorithm>
 
 namespace Task_Management {
 
-// Inițializarea membrului static
-int User::s_id_counter = 0;
-
 User::User(const std::string& name, const std::string& email)
     : m_name(name), m_email(email) {
     // Generăm un ID unic pentru utilizator
@@ -49,41 +46,44 @@ void User::SetEmail(const std::string& email) {
     m_email = email;
 }
 
-std::string User::GetId() const {
+Entity_Id User::GetId() const {
     // Returnează ID-ul unic al utilizatorului
     return m_id;
 }
 
 void User::AddAssignedTask(Task* task) {
     // Adaugă o sarcină la lista de sarcini atribuite dacă pointerul nu este null
-    if (task) {
-        m_assigned_tasks.push_back(task);
-    }
+    m_assigned_tasks.Add(task);
 }
 
-bool User::RemoveAssignedTask(const std::string& task_id) {
-    // Caută sarcina cu ID-ul specificat
-    auto it = std::find_if(m_assigned_tasks.begin(), m_assigned_tasks.end(),
-                          [&task_id](const Task* task) { return task->GetId() == task_id; });
-    
-    // Dacă am găsit sarcina, o eliminăm și returnăm true
-    if (it != m_assigned_tasks.end()) {
-        m_assigned_tasks.erase(it);
-        return true;
-    }
-    
-    // Dacă nu am găsit sarcina, returnăm false
-    return false;
+void User::AddAssignedTasks(Task* const* tasks, size_t count) {
+    // Adaugă toate sarcinile cu o singură rezervare de memorie
+    m_assigned_tasks.AddRange(tasks, count);
+}
+
+void User::AddAssignedTasks(const std::vector<Task*>& tasks) {
+    AddAssignedTasks(tasks.data(), tasks.size());
+}
+
+bool User::RemoveAssignedTask(const Entity_Id& task_id) {
+    // Eliminăm sarcina cu ID-ul specificat
+    // Colecția decide dacă folosește căutarea liniară sau indexul după ID
+    return m_assigned_tasks.Remove(task_id);
 }
 
 const std::vector<Task*>& User::GetAssignedTasks() const {
     // Returnează toate sarcinile atribuite utilizatorului
-    return m_assigned_tasks;
+    return m_assigned_tasks.GetTasks();
+}
+
+void User::SetStorageMode(Task_Collection::Storage_Mode mode) {
+    // Setează modul de stocare al sarcinilor atribuite
+    m_assigned_tasks.SetStorageMode(mode);
 }
 
 size_t User::GetAssignedTaskCount() const {
     // Returnează numărul de sarcini atribuite utilizatorului
-    return m_assigned_tasks.size();
+    return m_assigned_tasks.Size();
 }
 
 void User::DisplayDetails() const {
@@ -99,36 +99,36 @@ std::string User::GetUserType() const {
 
 void User::_WriteDetailsToStream(std::ostream& os) const {
     // Scrie detaliile utilizatorului în stream-ul de ieșire
-    os << "ID: " << m_id << std::endl;
-    os << "Name: " << m_name << std::endl;
-    os << "Email: " << m_email << std::endl;
-    os << "Type: " << GetUserType() << std::endl;
-    os << "Assigned Tasks: " << m_assigned_tasks.size() << std::endl;
+    os << "ID: " << m_id << "\n";
+    os << "Name: " << m_name << "\n";
+    os << "Email: " << m_email << "\n";
+    os << "Type: " << GetUserType() << "\n";
+    os << "Assigned Tasks: " << m_assigned_tasks.Size() << "\n";
 }
 
 // Implementarea operatorului << suprascris
 std::ostream& operator<<(std::ostream& os, const User& user) {
-    os << "=== User Details ===" << std::endl;
+    os << "=== User Details ===" << "\n";
     user._WriteDetailsToStream(os);
     
     // Afișează sarcinile atribuite acestui utilizator
-    if (!user.m_assigned_tasks.empty()) {
-        os << "Tasks assigned to this user:" << std::endl;
-        for (size_t i = 0; i < user.m_assigned_tasks.size(); ++i) {
-            os << "  " << (i + 1) << ". " << user.m_assigned_tasks[i]->GetTitle() << std::endl;
+    const std::vector<Task*>& tasks = user.m_assigned_tasks.GetTasks();
+    if (!tasks.empty()) {
+        os << "Tasks assigned to this user:" << "\n";
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            os << "  " << (i + 1) << ". " << tasks[i]->GetTitle() << "\n";
         }
     }
     
-    os << "===================" << std::endl;
+    os << "===================" << "\n";
     return os;  // Returnăm stream-ul pentru a permite înlănțuirea
 }
 
 // Metodă privată pentru generarea ID-urilor unice
-std::string User::_GenerateId() {
-    // Folosim un stringstream pentru a construi ID-ul
-    std::stringstream ss;
-    ss << "USER-" << ++s_id_counter;  // Incrementăm contorul static și îl includem în ID
-    return ss.str();  // Returnăm ID-ul ca string
+Entity_Id User::_GenerateId() {
+    // ID-ul este un întreg compact; forma text "USER-N" se produce doar la afișare
+    // Generatorul comun este thread-safe, deci obiectele pot fi create din mai multe fire
+    return Id_Allocator::GetInstance().Allocate(Entity_Kind::USER);
 }
 
 } // namespace Task_Management
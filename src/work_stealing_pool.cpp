@@ -0,0 +1,143 @@
+#include "work_stealing_pool.h"
+#include <chrono>
+
+namespace Task_Management {
+
+namespace {
+
+// Pool-ul și indexul cozii firului curent (nullptr pentru firele din afara oricărui pool)
+thread_local const Work_Stealing_Pool* t_current_pool = nullptr;
+thread_local size_t t_current_index = 0;
+
+} // namespace
+
+Work_Stealing_Pool::Work_Stealing_Pool(size_t thread_count)
+    : m_stopping(false), m_queued(0) {
+    if (thread_count == 0) {
+        thread_count = std::thread::hardware_concurrency();
+        if (thread_count == 0) {
+            thread_count = 1;
+        }
+    }
+
+    // Ultima coadă primește lucrările pornite din afara pool-ului
+    for (size_t i = 0; i <= thread_count; ++i) {
+        m_queues.push_back(std::unique_ptr<Job_Queue>(new Job_Queue()));
+    }
+
+    for (size_t i = 0; i < thread_count; ++i) {
+        m_threads.push_back(std::thread(&Work_Stealing_Pool::_WorkerLoop, this, i));
+    }
+}
+
+Work_Stealing_Pool::~Work_Stealing_Pool() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_stopping.store(true);
+    }
+    m_wake.notify_all();
+
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+size_t Work_Stealing_Pool::GetThreadCount() const {
+    return m_queues.size() - 1;
+}
+
+void Work_Stealing_Pool::Run(Job_Group& group, std::function<void()> job) {
+    group.m_pending.fetch_add(1, std::memory_order_relaxed);
+
+    Job_Queue& queue = *m_queues[_CurrentQueueIndex()];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        Job entry;
+        entry.function = std::move(job);
+        entry.group = &group;
+        queue.jobs.push_back(std::move(entry));
+        queue.size.store(queue.jobs.size(), std::memory_order_relaxed);
+    }
+
+    m_queued.fetch_add(1, std::memory_order_release);
+    m_wake.notify_one();
+}
+
+void Work_Stealing_Pool::Wait(Job_Group& group) {
+    size_t self = _CurrentQueueIndex();
+
+    // Cât timp grupul nu s-a terminat, ajutăm la execuția altor lucrări
+    while (group.m_pending.load(std::memory_order_acquire) != 0) {
+        if (!_TryRunOne(self)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool Work_Stealing_Pool::ShouldSplit() const {
+    return m_queues[_CurrentQueueIndex()]->size.load(std::memory_order_relaxed) < 2;
+}
+
+void Work_Stealing_Pool::_WorkerLoop(size_t index) {
+    t_current_pool = this;
+    t_current_index = index;
+
+    while (!m_stopping.load()) {
+        if (_TryRunOne(index)) {
+            continue;
+        }
+
+        // Nicio lucrare disponibilă: așteptăm o notificare (cu timeout, ca plasă de siguranță)
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+        m_wake.wait_for(lock, std::chrono::milliseconds(1), [this] {
+            return m_stopping.load() || m_queued.load(std::memory_order_acquire) > 0;
+        });
+    }
+}
+
+bool Work_Stealing_Pool::_TryRunOne(size_t self) {
+    Job job;
+    bool found = false;
+
+    // Mai întâi coada proprie, de la capăt (ultima lucrare adăugată)
+    {
+        Job_Queue& own = *m_queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            own.size.store(own.jobs.size(), std::memory_order_relaxed);
+            found = true;
+        }
+    }
+
+    // Apoi furăm de la începutul cozilor celorlalte fire
+    for (size_t offset = 1; !found && offset < m_queues.size(); ++offset) {
+        Job_Queue& victim = *m_queues[(self + offset) % m_queues.size()];
+        if (victim.size.load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty()) {
+            job = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            victim.size.store(victim.jobs.size(), std::memory_order_relaxed);
+            found = true;
+        }
+    }
+
+    if (!found) {
+        return false;
+    }
+
+    m_queued.fetch_sub(1, std::memory_order_relaxed);
+    job.function();
+    job.group->m_pending.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+size_t Work_Stealing_Pool::_CurrentQueueIndex() const {
+    return t_current_pool == this ? t_current_index : m_queues.size() - 1;
+}
+
+} // namespace Task_Management
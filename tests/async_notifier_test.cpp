@@ -0,0 +1,272 @@
+/**
+ * Verificarea lui Async_Notifier cu un notificator care poate fi oprit (Gate_Notifier)
+ *
+ * Verificări:
+ * - BLOCK: cu coada plină, apelantul așteaptă până când firul de trimitere eliberează
+ *   un loc; nicio notificare nu se pierde, iar ordinea este păstrată;
+ * - DROP: cu coada plină, notificarea este respinsă imediat (DROPPED, prin callback și
+ *   prin std::future), iar celelalte sunt trimise;
+ * - COALESCE: notificările care nu încap așteaptă în depășire, iar una nouă cu același
+ *   destinatar și subiect o înlocuiește pe cea veche (COALESCED), păstrându-i locul;
+ * - Flush: după revenire, toate notificările acceptate au fost tratate, inclusiv cu
+ *   mai multe fire de trimitere; eșecurile notificatorului sunt raportate ca FAILED;
+ * - destructorul trimite toate notificările rămase, cu inelul și depășirea pline.
+ *
+ * Compilare (din rădăcina proiectului):
+ *   g++ -std=c++11 -O2 -pthread -I./include tests/async_notifier_test.cpp \
+ *       $(find src -name '*.cpp' ! -name main.cpp) -o async_notifier_test
+ *
+ * Utilizare: ./async_notifier_test
+ * Codul de ieșire este 0 dacă toate verificările au trecut.
+ */
+
+#include "async_notifier.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <future>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Task_Management;
+
+namespace {
+
+int g_failures = 0;  // Numărul verificărilor eșuate
+
+void Check(bool condition, const char* description) {
+    if (!condition) {
+        ++g_failures;
+        std::printf("FAILED: %s\n", description);
+    }
+}
+
+/**
+ * Notificator care reține mesajele trimise și care, cât timp este închis, ține firul
+ * de trimitere blocat în SendNotification; mesajele cu subiectul "fail" eșuează
+ */
+class Gate_Notifier : public INotifier {
+public:
+    explicit Gate_Notifier(bool open) : m_open(open), m_entered(0) {}
+
+    bool SendNotification(const std::string& recipient, const std::string& subject,
+                          const std::string& message) const override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        ++m_entered;
+        m_changed.notify_all();
+        m_changed.wait(lock, [this]() { return m_open; });
+        m_messages.push_back(recipient + "|" + subject + "|" + message);
+        return subject != "fail";
+    }
+
+    std::string GetNotificationType() const override {
+        return "Gate";
+    }
+
+    void Open() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_open = true;
+        m_changed.notify_all();
+    }
+
+    /**
+     * Așteaptă până când firul de trimitere a ajuns la a count-a notificare
+     */
+    void WaitEntered(size_t count) const {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_changed.wait(lock, [this, count]() { return m_entered >= count; });
+    }
+
+    std::vector<std::string> GetMessages() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_messages;
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    mutable std::condition_variable m_changed;
+    bool m_open;
+    mutable size_t m_entered;
+    mutable std::vector<std::string> m_messages;
+};
+
+std::string Message(size_t index) {
+    return "user" + std::to_string(index) + "@example.com|subject|message " + std::to_string(index);
+}
+
+void SendNumbered(const Async_Notifier& notifier, size_t first, size_t count) {
+    for (size_t i = first; i < first + count; ++i) {
+        notifier.SendNotification("user" + std::to_string(i) + "@example.com", "subject",
+                                  "message " + std::to_string(i));
+    }
+}
+
+/**
+ * Ocupă firul de trimitere cu o notificare (blocată la poartă) și umple inelul
+ * @return Numărul de notificări trimise
+ */
+size_t FillQueue(const Async_Notifier& notifier, const Gate_Notifier& gate) {
+    SendNumbered(notifier, 0, 1);
+    gate.WaitEntered(1);
+    SendNumbered(notifier, 1, notifier.GetCapacity());
+    return notifier.GetCapacity() + 1;
+}
+
+bool InOrder(const std::vector<std::string>& messages, size_t count) {
+    if (messages.size() != count) {
+        return false;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (messages[i] != Message(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TestBlock() {
+    Gate_Notifier gate(false);
+    Async_Notifier notifier(&gate, 4, Async_Notifier::Overflow_Policy::BLOCK);
+    Check(notifier.GetCapacity() == 4, "BLOCK: capacity is kept when it is a power of 2");
+    size_t sent = FillQueue(notifier, gate);
+
+    std::atomic<bool> returned(false);
+    std::thread sender([&]() {
+        SendNumbered(notifier, sent, 1);
+        returned = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    Check(!returned, "BLOCK: the sender waits while the queue is full");
+    gate.Open();
+    sender.join();
+    Check(returned, "BLOCK: the sender resumes once a slot is free");
+    notifier.Flush();
+    Check(InOrder(gate.GetMessages(), sent + 1), "BLOCK: every notification is delivered, in order");
+    Check(notifier.GetDroppedCount() == 0, "BLOCK: nothing is dropped");
+}
+
+void TestDrop() {
+    Gate_Notifier gate(false);
+    Async_Notifier notifier(&gate, 4, Async_Notifier::Overflow_Policy::DROP);
+    size_t sent = FillQueue(notifier, gate);
+
+    Async_Notifier::Delivery_Status status = Async_Notifier::Delivery_Status::DELIVERED;
+    Notification rejected;
+    rejected.recipient = "late@example.com";
+    rejected.subject = "subject";
+    rejected.message = "late";
+    bool accepted = notifier.Send(rejected, [&status](Async_Notifier::Delivery_Status result) { status = result; });
+    Check(!accepted, "DROP: a full queue rejects the notification");
+    Check(status == Async_Notifier::Delivery_Status::DROPPED, "DROP: the callback reports DROPPED");
+
+    std::future<Async_Notifier::Delivery_Status> future = notifier.SendAsync(rejected);
+    Check(future.wait_for(std::chrono::seconds(0)) == std::future_status::ready &&
+              future.get() == Async_Notifier::Delivery_Status::DROPPED,
+          "DROP: the future is ready with DROPPED");
+    Check(notifier.GetDroppedCount() == 2, "DROP: dropped notifications are counted");
+
+    gate.Open();
+    notifier.Flush();
+    Check(InOrder(gate.GetMessages(), sent), "DROP: accepted notifications are delivered, in order");
+}
+
+void TestCoalesce() {
+    Gate_Notifier gate(false);
+    Async_Notifier notifier(&gate, 4, Async_Notifier::Overflow_Policy::COALESCE);
+    size_t sent = FillQueue(notifier, gate);
+
+    Notification first;
+    first.recipient = "late@example.com";
+    first.subject = "status";
+    first.message = "old";
+    Notification other = first;
+    other.recipient = "other@example.com";
+    Notification second = first;
+    second.message = "new";
+
+    std::future<Async_Notifier::Delivery_Status> superseded = notifier.SendAsync(first);
+    Check(notifier.Send(other, Async_Notifier::Delivery_Callback()), "COALESCE: a full ring still accepts");
+    std::future<Async_Notifier::Delivery_Status> latest = notifier.SendAsync(second);
+    Check(superseded.wait_for(std::chrono::seconds(0)) == std::future_status::ready &&
+              superseded.get() == Async_Notifier::Delivery_Status::COALESCED,
+          "COALESCE: the replaced notification reports COALESCED");
+    Check(notifier.GetCoalescedCount() == 1, "COALESCE: replaced notifications are counted");
+
+    gate.Open();
+    notifier.Flush();
+    Check(latest.get() == Async_Notifier::Delivery_Status::DELIVERED, "COALESCE: the newer notification is delivered");
+    std::vector<std::string> messages = gate.GetMessages();
+    bool ring_in_order = messages.size() == sent + 2;
+    for (size_t i = 0; ring_in_order && i < sent; ++i) {
+        ring_in_order = messages[i] == Message(i);
+    }
+    Check(ring_in_order, "COALESCE: the ring is delivered first, in order");
+    Check(ring_in_order && messages[sent] == "late@example.com|status|new" &&
+              messages[sent + 1] == "other@example.com|status|old",
+          "COALESCE: the newer content keeps the place of the replaced notification");
+}
+
+void TestFlush() {
+    Gate_Notifier gate(true);
+    Async_Notifier notifier(&gate, 64, Async_Notifier::Overflow_Policy::BLOCK, 4);
+
+    std::vector<std::future<Async_Notifier::Delivery_Status>> results;
+    for (size_t i = 0; i < 1000; ++i) {
+        Notification notification;
+        notification.recipient = "user@example.com";
+        notification.subject = i % 10 == 0 ? "fail" : "subject";
+        notification.message = std::to_string(i);
+        results.push_back(notifier.SendAsync(notification));
+    }
+    notifier.Flush();
+    Check(gate.GetMessages().size() == results.size(), "Flush: every accepted notification was handled");
+
+    bool statuses = true;
+    for (size_t i = 0; i < results.size(); ++i) {
+        Async_Notifier::Delivery_Status expected =
+            i % 10 == 0 ? Async_Notifier::Delivery_Status::FAILED : Async_Notifier::Delivery_Status::DELIVERED;
+        statuses = statuses && results[i].wait_for(std::chrono::seconds(0)) == std::future_status::ready &&
+                   results[i].get() == expected;
+    }
+    Check(statuses, "Flush: results are ready, failures are reported as FAILED");
+
+    notifier.Flush();  // Fără notificări noi, revine imediat
+}
+
+void TestDestruction(Async_Notifier::Overflow_Policy policy, const char* description) {
+    Gate_Notifier gate(false);
+    size_t sent = 0;
+    std::thread opener;
+    {
+        Async_Notifier notifier(&gate, 4, policy);
+        sent = FillQueue(notifier, gate);
+        if (policy == Async_Notifier::Overflow_Policy::COALESCE) {
+            // Depășirea este și ea plină
+            SendNumbered(notifier, sent, notifier.GetCapacity());
+            sent += notifier.GetCapacity();
+        }
+        // Poarta se deschide după ce destructorul a început
+        opener = std::thread([&gate]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            gate.Open();
+        });
+    }
+    opener.join();
+    Check(InOrder(gate.GetMessages(), sent), description);
+}
+
+} // namespace
+
+int main() {
+    TestBlock();
+    TestDrop();
+    TestCoalesce();
+    TestFlush();
+    TestDestruction(Async_Notifier::Overflow_Policy::BLOCK, "destructor delivers a full ring");
+    TestDestruction(Async_Notifier::Overflow_Policy::COALESCE, "destructor delivers a full ring and overflow");
+    std::printf("%s (%d failed checks)\n", g_failures == 0 ? "OK" : "FAILED", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}
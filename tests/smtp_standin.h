@@ -0,0 +1,202 @@
+#pragma once
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Task_Management {
+
+/**
+ * Clasa Smtp_Standin - server SMTP minimal, în același proces, pentru teste
+ *
+ * Ascultă pe 127.0.0.1, pe un port ales de sistem (GetPort), și tratează fiecare
+ * conexiune într-un fir separat. Acceptă EHLO, MAIL, RCPT, DATA, RSET și QUIT, reține
+ * conținutul mesajelor primite (cu dublarea punctelor anulată) și poate simula:
+ * - PIPELINING anunțat sau nu în răspunsul la EHLO;
+ * - o întârziere înaintea fiecărui grup de răspunsuri (latența rețelei), triplă pentru
+ *   salutul unei conexiuni noi;
+ * - respingerea destinatarilor care conțin "bad" (550 la RCPT, 554 la DATA);
+ * - închiderea conexiunii după un număr fix de mesaje.
+ */
+class Smtp_Standin {
+public:
+    /**
+     * Constructor - pornește serverul
+     * @param pipelining true dacă răspunsul la EHLO anunță PIPELINING
+     * @param reply_delay Întârzierea dinaintea fiecărui grup de răspunsuri
+     * @param close_after Numărul de mesaje după care serverul închide conexiunea (0 = niciodată)
+     */
+    Smtp_Standin(bool pipelining, std::chrono::microseconds reply_delay = std::chrono::microseconds(0),
+                 size_t close_after = 0)
+        : m_pipelining(pipelining), m_reply_delay(reply_delay), m_close_after(close_after),
+          m_port(0), m_stopping(false), m_active_sessions(0) {
+        m_listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+        int on = 1;
+        setsockopt(m_listen_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        sockaddr_in address = sockaddr_in();
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        bind(m_listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        listen(m_listen_fd, 64);
+        socklen_t length = sizeof(address);
+        getsockname(m_listen_fd, reinterpret_cast<sockaddr*>(&address), &length);
+        m_port = ntohs(address.sin_port);
+        m_acceptor = std::thread(&Smtp_Standin::_AcceptLoop, this);
+    }
+
+    /**
+     * Destructor - oprește serverul și așteaptă terminarea sesiunilor
+     */
+    ~Smtp_Standin() {
+        m_stopping = true;
+        shutdown(m_listen_fd, SHUT_RDWR);
+        close(m_listen_fd);
+        m_acceptor.join();
+        while (m_active_sessions.load() > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    /**
+     * Obține portul pe care ascultă serverul
+     * @return Portul
+     */
+    std::uint16_t GetPort() const { return m_port; }
+
+    /**
+     * Obține conținutul mesajelor primite (antete și corp, rânduri terminate cu '\n')
+     * @return Mesajele, în ordinea primirii
+     */
+    std::vector<std::string> GetMessages() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_messages;
+    }
+
+private:
+    bool m_pipelining;                      // Răspunsul la EHLO anunță PIPELINING
+    std::chrono::microseconds m_reply_delay; // Întârzierea dinaintea fiecărui grup de răspunsuri
+    size_t m_close_after;                   // Mesajele după care conexiunea este închisă
+    int m_listen_fd;                        // Socket-ul de ascultare
+    std::uint16_t m_port;                   // Portul ales de sistem
+    std::atomic<bool> m_stopping;           // Destructorul a fost apelat
+    std::atomic<int> m_active_sessions;     // Sesiunile încă deschise
+    std::thread m_acceptor;                 // Firul care acceptă conexiunile
+    mutable std::mutex m_mutex;             // Protejează m_messages
+    std::vector<std::string> m_messages;    // Mesajele primite
+
+    void _AcceptLoop() {
+        for (;;) {
+            int fd = accept(m_listen_fd, nullptr, nullptr);
+            if (fd < 0 || m_stopping) {
+                if (fd >= 0) {
+                    close(fd);
+                }
+                return;
+            }
+            ++m_active_sessions;
+            std::thread(&Smtp_Standin::_Session, this, fd).detach();
+        }
+    }
+
+    /**
+     * Trimite răspunsurile adunate, după întârzierea simulată
+     */
+    void _Reply(int fd, std::string& replies) {
+        if (replies.empty()) {
+            return;
+        }
+        if (m_reply_delay.count() > 0) {
+            std::this_thread::sleep_for(m_reply_delay);
+        }
+        send(fd, replies.data(), replies.size(), MSG_NOSIGNAL);
+        replies.clear();
+    }
+
+    void _Session(int fd) {
+        // Deschiderea unei conexiuni costă mai multe drumuri dus-întors (TCP, salutul serverului)
+        if (m_reply_delay.count() > 0) {
+            std::this_thread::sleep_for(2 * m_reply_delay);
+        }
+        std::string replies = "220 standin\r\n";
+        _Reply(fd, replies);
+
+        std::string input;
+        std::string body;
+        bool in_data = false;
+        bool rejected_recipient = false;
+        size_t message_count = 0;
+        char buffer[65536];
+        bool open = true;
+        while (open) {
+            ssize_t received = recv(fd, buffer, sizeof(buffer), 0);
+            if (received <= 0) {
+                break;
+            }
+            input.append(buffer, static_cast<size_t>(received));
+
+            // Toate comenzile primite împreună primesc răspunsurile împreună, ca la un server real
+            size_t end;
+            while (open && (end = input.find("\r\n")) != std::string::npos) {
+                std::string line = input.substr(0, end);
+                input.erase(0, end + 2);
+                if (in_data) {
+                    if (line == ".") {
+                        in_data = false;
+                        {
+                            std::lock_guard<std::mutex> lock(m_mutex);
+                            m_messages.push_back(body);
+                        }
+                        replies += "250 ok\r\n";
+                        if (m_close_after != 0 && ++message_count % m_close_after == 0) {
+                            open = false;  // Simulează o conexiune închisă de server
+                        }
+                    } else {
+                        body += (!line.empty() && line[0] == '.') ? line.substr(1) : line;
+                        body += '\n';
+                    }
+                } else if (line.compare(0, 4, "EHLO") == 0) {
+                    replies += m_pipelining ? "250-standin\r\n250-PIPELINING\r\n250 8BITMIME\r\n" : "250 standin\r\n";
+                } else if (line.compare(0, 4, "MAIL") == 0) {
+                    rejected_recipient = false;
+                    replies += "250 ok\r\n";
+                } else if (line.compare(0, 4, "RCPT") == 0) {
+                    rejected_recipient = line.find("bad") != std::string::npos;
+                    replies += rejected_recipient ? "550 no such user\r\n" : "250 ok\r\n";
+                } else if (line == "DATA") {
+                    if (rejected_recipient) {
+                        replies += "554 no valid recipients\r\n";
+                    } else {
+                        replies += "354 go ahead\r\n";
+                        in_data = true;
+                        body.clear();
+                    }
+                } else if (line == "RSET") {
+                    replies += "250 ok\r\n";
+                } else if (line == "QUIT") {
+                    replies += "221 bye\r\n";
+                    open = false;
+                } else {
+                    replies += "500 unknown command\r\n";
+                }
+            }
+            _Reply(fd, replies);
+        }
+        close(fd);
+        --m_active_sessions;
+    }
+
+    // Copierea este interzisă - serverul deține socket-ul și firele
+    Smtp_Standin(const Smtp_Standin&) = delete;
+    Smtp_Standin& operator=(const Smtp_Standin&) = delete;
+};
+
+} // namespace Task_Management
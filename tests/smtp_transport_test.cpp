@@ -0,0 +1,165 @@
+/**
+ * Verificarea și măsurarea lui Smtp_Transport față de serverul Smtp_Standin
+ *
+ * Verificări (cu și fără PIPELINING):
+ * - destinatarii respinși sunt raportați individual, fără a afecta celelalte mesaje;
+ * - punctele de la începutul rândurilor sunt dublate, iar "\r\n" și "\n" devin CRLF;
+ * - o conexiune închisă de server este redeschisă automat;
+ * - Email_Notifier trimite prin transport, inclusiv din firele unui Async_Notifier;
+ * - un server inaccesibil produce erori, nu blocări.
+ *
+ * Măsurătoarea trimite 1000 de mesaje cu o latență simulată de 200 us pentru fiecare
+ * grup de răspunsuri: o conexiune pentru fiecare mesaj, conexiune persistentă fără
+ * PIPELINING și conexiune persistentă cu PIPELINING.
+ *
+ * Compilare (din rădăcina proiectului):
+ *   g++ -std=c++11 -O2 -pthread -I./include tests/smtp_transport_test.cpp \
+ *       $(find src -name '*.cpp' ! -name main.cpp) -o smtp_transport_test
+ *
+ * Utilizare: ./smtp_transport_test [--bench]
+ * Codul de ieșire este 0 dacă toate verificările au trecut.
+ */
+
+#include "smtp_standin.h"
+#include "smtp_transport.h"
+#include "email_notifier.h"
+#include "async_notifier.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Task_Management;
+
+namespace {
+
+int g_failures = 0;  // Numărul verificărilor eșuate
+
+void Check(bool condition, const char* description) {
+    if (!condition) {
+        ++g_failures;
+        std::printf("FAILED: %s\n", description);
+    }
+}
+
+/**
+ * Mesaje de test; fiecare al 13-lea destinatar (începând cu al 6-lea) este respins
+ */
+std::vector<Notification> MakeNotifications(size_t count, bool with_rejected) {
+    std::vector<Notification> notifications(count);
+    for (size_t i = 0; i < count; ++i) {
+        bool rejected = with_rejected && i % 13 == 5;
+        notifications[i].recipient = (rejected ? "bad" : "user") + std::to_string(i) + "@example.com";
+        notifications[i].subject = "Subject " + std::to_string(i);
+        notifications[i].message = "first line\n.dot line\r\nlast " + std::to_string(i);
+    }
+    return notifications;
+}
+
+void TestTransport(bool pipelining) {
+    // Serverul închide conexiunea după fiecare 7 mesaje
+    Smtp_Standin server(pipelining, std::chrono::microseconds(0), 7);
+    Smtp_Config config;
+    config.port = server.GetPort();
+    config.max_messages_per_session = 50;
+    Smtp_Transport transport(config);
+
+    std::vector<Notification> notifications = MakeNotifications(200, true);
+    std::vector<bool> delivered;
+    size_t accepted = transport.Send("tasks@example.com", notifications, delivered);
+
+    size_t expected = 0;
+    bool per_message = delivered.size() == notifications.size();
+    for (size_t i = 0; per_message && i < notifications.size(); ++i) {
+        bool should_deliver = i % 13 != 5;
+        expected += should_deliver ? 1 : 0;
+        per_message = delivered[i] == should_deliver;
+    }
+    Check(per_message, "rejected recipients are reported per message");
+    Check(accepted == expected, "accepted count matches the delivered flags");
+
+    std::vector<std::string> messages = server.GetMessages();
+    Check(messages.size() == expected, "server received every accepted message");
+    Check(!messages.empty() &&
+              messages[0] == "From: <tasks@example.com>\nTo: <user0@example.com>\nSubject: Subject 0\n\n"
+                             "first line\n.dot line\nlast 0\n",
+          "headers, dot-stuffing and line endings survive the round trip");
+    Check(transport.GetConnectCount() > 1, "closed connections are reopened");
+
+    std::printf("pipelining=%d: %zu/%zu delivered, %llu connects\n", pipelining ? 1 : 0, accepted,
+                notifications.size(), static_cast<unsigned long long>(transport.GetConnectCount()));
+}
+
+void TestEmailNotifier() {
+    Smtp_Standin server(true);
+    Smtp_Config config;
+    config.port = server.GetPort();
+    config.pool_size = 2;
+    Smtp_Transport transport(config);
+    Email_Notifier notifier("tasks@example.com");
+    notifier.SetTransport(&transport);
+
+    {
+        Async_Notifier async_notifier(&notifier, 1024, Async_Notifier::Overflow_Policy::BLOCK, 2);
+        for (int i = 0; i < 500; ++i) {
+            async_notifier.SendNotification("user@example.com", "subject", "message");
+        }
+    }
+    Check(server.GetMessages().size() == 500, "Async_Notifier + Email_Notifier deliver every message");
+    Check(transport.GetConnectCount() <= config.pool_size, "connections are reused across batches");
+    Check(notifier.SendNotification("user@example.com", "single", "message"), "single notification is delivered");
+}
+
+void TestServerDown() {
+    Smtp_Config config;
+    config.port = 1;  // Niciun server nu ascultă aici
+    Smtp_Transport transport(config);
+    std::vector<bool> delivered;
+    Check(transport.Send("tasks@example.com", MakeNotifications(3, false), delivered) == 0,
+          "an unreachable server delivers nothing");
+    Check(delivered.size() == 3 && !delivered[0] && !delivered[1] && !delivered[2],
+          "an unreachable server marks every message as failed");
+}
+
+void Benchmark() {
+    struct Case {
+        const char* name;
+        bool pipelining;
+        size_t messages_per_session;
+    };
+    const Case cases[] = {
+        {"one connection per message", true, 1},
+        {"persistent, no pipelining", false, 100000},
+        {"persistent + pipelining", true, 100000},
+    };
+    std::vector<Notification> notifications = MakeNotifications(1000, false);
+    for (const Case& test_case : cases) {
+        Smtp_Standin server(test_case.pipelining, std::chrono::microseconds(200));
+        Smtp_Config config;
+        config.port = server.GetPort();
+        config.max_messages_per_session = test_case.messages_per_session;
+        Smtp_Transport transport(config);
+
+        std::vector<bool> delivered;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        size_t accepted = transport.Send("tasks@example.com", notifications, delivered);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::printf("%-28s %zu messages in %6.0f ms = %6.0f msg/s, %llu connects\n", test_case.name, accepted, ms,
+                    accepted * 1000.0 / ms, static_cast<unsigned long long>(transport.GetConnectCount()));
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    TestTransport(false);
+    TestTransport(true);
+    TestEmailNotifier();
+    TestServerDown();
+    if (argc > 1 && std::strcmp(argv[1], "--bench") == 0) {
+        Benchmark();
+    }
+    std::printf("%s (%d failed checks)\n", g_failures == 0 ? "OK" : "FAILED", g_failures);
+    return g_failures == 0 ? 0 : 1;
+}